@@ -0,0 +1,107 @@
+/**
+ * @file benchmark_Integrator.cpp
+ * @author Finn Lasse Buessen
+ * @brief Micro-benchmark of the implicit frequency integration with type-erased and with inlined integrands.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+#include "lib/Integrator.hpp"
+#include "lib/ValueBundle.hpp"
+
+/**
+ * @brief Minimal stand-in for the SpinParser class, which initializes the frequency discretization.
+ */
+class SpinParser
+{
+public:
+	SpinParser(FrequencyDiscretization *f)
+	{
+		FrgCommon::_frequency = f;
+	}
+
+	~SpinParser()
+	{
+		delete FrgCommon::_frequency;
+	}
+};
+
+namespace
+{
+	/**
+	 * @brief Measure the average runtime of the integration over all frequencies outside of the cutoff windows.
+	 *
+	 * @tparam Integrand Callable type void(float, ValueSuperbundle<float, 4> &).
+	 * @param integrand Integrand function.
+	 * @param size Number of elements in each ValueBundle.
+	 * @param repetitions Number of integrations.
+	 * @return double Runtime per integration in nanoseconds.
+	 */
+	template <class Integrand> double measure(const Integrand &integrand, const int64_t size, const int repetitions)
+	{
+		ValueSuperbundle<float, 4> integrandBuffer(size);
+		ValueSuperbundle<float, 4> rangeBuffer(size);
+		ValueSuperbundle<float, 4> accumulator(size);
+
+		for (int r = 0; r < repetitions / 10; ++r) ImplicitIntegrator::integrateOutsideCutoff(2.0f, 0.5f, integrand, integrandBuffer, rangeBuffer, accumulator);
+
+		auto start = std::chrono::steady_clock::now();
+		for (int r = 0; r < repetitions; ++r) ImplicitIntegrator::integrateOutsideCutoff(2.0f, 0.5f, integrand, integrandBuffer, rangeBuffer, accumulator);
+		auto end = std::chrono::steady_clock::now();
+
+		//keep the result alive
+		volatile float sink = accumulator.bundle(0)[0];
+		(void)sink;
+
+		return std::chrono::duration<double, std::nano>(end - start).count() / repetitions;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	//typical numbers of lattice sites per vertex bundle
+	std::vector<int64_t> sizes({ 1, 16, 64, 256, 1024 });
+	if (argc > 1)
+	{
+		sizes.clear();
+		for (int i = 1; i < argc; ++i) sizes.push_back(std::atoll(argv[i]));
+	}
+
+	//logarithmic frequency mesh with 64 positive frequencies
+	std::vector<float> frequencies;
+	for (int i = 0; i < 64; ++i) frequencies.push_back(0.01f * std::pow(1.15f, float(i)));
+	SpinParser spinParser(new FrequencyDiscretization(frequencies));
+
+	printf("%8s %22s %22s %8s\n", "size", "std::function [ns]", "template [ns]", "speedup");
+	for (int64_t size : sizes)
+	{
+		ValueSuperbundle<float, 4> vertex(size);
+		for (int n = 0; n < 4; ++n)
+		{
+			for (int64_t i = 0; i < size; ++i) vertex.bundle(n)[i] = 1.0f / float(1 + i + n);
+		}
+
+		//integrand with the structure of the Katanin kernels: a bundle operation followed by a scalar weight
+		auto kernel = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+		{
+			returnBuffer.reset();
+			for (int n = 0; n < 4; ++n) returnBuffer.bundle(n) += vertex.bundle(n) * vertex.bundle(3 - n);
+			returnBuffer *= 1.0f / (1.0f + wp * wp);
+		};
+		std::function<void(float, ValueSuperbundle<float, 4> &)> typeErasedKernel = kernel;
+
+		const int repetitions = int(std::max<int64_t>(200, 200000 / std::max<int64_t>(size, 1)));
+		double timeTypeErased = measure(typeErasedKernel, size, repetitions);
+		double timeTemplate = measure(kernel, size, repetitions);
+		printf("%8lld %22.1f %22.1f %8.2f\n", static_cast<long long>(size), timeTypeErased, timeTemplate, timeTypeErased / timeTemplate);
+	}
+
+	return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file benchmark_LatticeBubble.cpp
+ * @author Finn Lasse Buessen
+ * @brief Micro-benchmark of the direct and the momentum space evaluation of the lattice bubble on Bravais lattices of increasing range.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "lib/Log.hpp"
+#include "LatticeModelFactory.hpp"
+#include "LatticeBubble.hpp"
+
+namespace
+{
+	/**
+	 * @brief Construct a square or simple cubic lattice with nearest neighbor Heisenberg interactions.
+	 *
+	 * @param dimension Spatial dimension, either 2 or 3.
+	 * @param range Lattice range.
+	 * @return Lattice* Lattice, which must be deleted by the caller.
+	 */
+	Lattice *newLattice(const int dimension, const int range)
+	{
+		LatticeModelFactory::LatticeUnitCell uc;
+		uc.basisSites.push_back(geometry::Vec3<double>(0.0, 0.0, 0.0));
+		uc.latticeVectors.push_back(geometry::Vec3<double>(1.0, 0.0, 0.0));
+		uc.latticeVectors.push_back(geometry::Vec3<double>(0.0, 1.0, 0.0));
+		uc.latticeVectors.push_back(geometry::Vec3<double>(0.0, 0.0, 1.0));
+
+		LatticeModelFactory::SpinModelUnitCell model;
+		for (int d = 0; d < dimension; ++d)
+		{
+			uc.latticeBonds.push_back(LatticeModelFactory::LatticeBond(0, 0, (d == 0) ? 1 : 0, (d == 1) ? 1 : 0, (d == 2) ? 1 : 0));
+			LatticeModelFactory::SpinInteraction interaction(LatticeModelFactory::LatticeSite(0, 0, 0, 0), LatticeModelFactory::LatticeSite((d == 0) ? 1 : 0, (d == 1) ? 1 : 0, (d == 2) ? 1 : 0, 0));
+			for (int mu = 0; mu < 3; ++mu) interaction.interactionStrength[mu][mu] = 1.0f;
+			model.interactions.push_back(interaction);
+		}
+
+		std::pair<Lattice *, SpinModel *> product = LatticeModelFactory::newLatticeModel(uc, model, range);
+		delete product.second;
+		return product.first;
+	}
+
+	/**
+	 * @brief Measure the average runtime per call of a function.
+	 *
+	 * @tparam F Callable type void().
+	 * @param f Function.
+	 * @return double Runtime per call in microseconds.
+	 */
+	template <class F> double measure(const F &f)
+	{
+		f();
+
+		//repeat until the total runtime is long enough to be measured reliably
+		int repetitions = 1;
+		while (true)
+		{
+			auto start = std::chrono::steady_clock::now();
+			for (int r = 0; r < repetitions; ++r) f();
+			auto end = std::chrono::steady_clock::now();
+
+			double time = std::chrono::duration<double, std::micro>(end - start).count();
+			if (time > 2e5 || repetitions >= (1 << 20)) return time / repetitions;
+			repetitions *= 2;
+		}
+	}
+
+	/**
+	 * @brief Measure the direct and the momentum space evaluation of a lattice bubble with n components and print a table row.
+	 *
+	 * @tparam n Number of components.
+	 * @param lattice Lattice.
+	 * @param plan Fourier plan of the lattice.
+	 * @param name Name of the lattice.
+	 * @param range Lattice range.
+	 */
+	template <int n> void benchmark(const Lattice &lattice, const LatticeBubble::FourierPlan &plan, const char *name, const int range)
+	{
+		const int size = lattice.size;
+		ValueSuperbundle<float, n> a(size);
+		ValueSuperbundle<float, n> b(size);
+		ValueSuperbundle<float, n> result(size);
+		for (int c = 0; c < n; ++c)
+		{
+			for (int rid = 0; rid < size; ++rid)
+			{
+				a.bundle(c)[rid] = 1.0f / float(1 + rid + c);
+				b.bundle(c)[rid] = 0.25f * float(c) - 0.125f * float(rid % 5);
+			}
+		}
+
+		std::vector<float> siteMajorA(n * size);
+		std::vector<float> siteMajorB(n * size);
+		double direct = measure([&]()
+		{
+			LatticeBubble::transpose(a, siteMajorA.data());
+			LatticeBubble::transpose(b, siteMajorB.data());
+			LatticeBubble::product(lattice.getOverlapTable(), siteMajorA.data(), siteMajorB.data(), result);
+		});
+
+		ScratchArena arena;
+		double fourier = measure([&]() { plan.product(a, b, result, arena); });
+
+		const std::array<int, 3> &dimensions = plan.dimensions();
+		printf("%-7s %6d %2d %8d %11lld %4dx%4dx%4d %12.1f %12.1f %9.3f %9.3f %s\n", name, range, n, size, static_cast<long long>(lattice.getOverlapTable().entries), dimensions[0], dimensions[1], dimensions[2],
+			direct, fourier, direct / fourier, plan.directCost(n) / plan.fourierCost(n), plan.isFavorable(n) ? "fft" : "direct");
+		fflush(stdout);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	//typical and large lattice ranges of two- and three-dimensional lattices
+	std::vector<std::pair<int, int>> lattices({ { 2, 8 }, { 2, 16 }, { 2, 24 }, { 2, 32 }, { 2, 48 }, { 2, 64 }, { 3, 4 }, { 3, 6 }, { 3, 8 }, { 3, 10 } });
+	if (argc > 2)
+	{
+		lattices.clear();
+		for (int i = 2; i < argc; ++i) lattices.push_back(std::pair<int, int>((std::string(argv[1]) == "cubic") ? 3 : 2, std::atoi(argv[i])));
+	}
+
+	Log::log << Log::setDisplayLogLevel(Log::LogLevel::None);
+	printf("%-7s %6s %2s %8s %11s %14s %12s %12s %9s %9s %s\n", "lattice", "range", "n", "sites", "overlap", "supercell", "direct [us]", "fft [us]", "speedup", "estimate", "choice");
+	for (auto &l : lattices)
+	{
+		Lattice *lattice = newLattice(l.first, l.second);
+		LatticeBubble::FourierPlan plan(*lattice);
+		const char *name = (l.first == 2) ? "square" : "cubic";
+		benchmark<2>(*lattice, plan, name, l.second);
+		benchmark<4>(*lattice, plan, name, l.second);
+		delete lattice;
+	}
+
+	return 0;
+}
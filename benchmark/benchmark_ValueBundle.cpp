@@ -0,0 +1,92 @@
+/**
+ * @file benchmark_ValueBundle.cpp
+ * @author Finn Lasse Buessen
+ * @brief Micro-benchmark of the ValueBundle arithmetic kernels for all supported instruction sets.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "lib/SimdKernels.hpp"
+#include "lib/ValueBundle.hpp"
+
+namespace
+{
+	/**
+	 * @brief Measure the average runtime per call of a kernel.
+	 *
+	 * @param kernel Kernel.
+	 * @param y Array which is modified.
+	 * @param x1 First array operand.
+	 * @param x2 Second array operand.
+	 * @param size Number of elements.
+	 * @param repetitions Number of calls.
+	 * @return double Runtime per call in nanoseconds.
+	 */
+	double measure(const SimdKernels::Kernel kernel, float *y, const float *x1, const float *x2, const int64_t size, const int repetitions)
+	{
+		//alternate the sign of the scalar operand to keep the values bounded
+		for (int r = 0; r < repetitions / 10; ++r) kernel(y, x1, x2, (r % 2 == 0) ? 1.0f : -1.0f, size);
+
+		auto start = std::chrono::steady_clock::now();
+		for (int r = 0; r < repetitions; ++r) kernel(y, x1, x2, (r % 2 == 0) ? 1.0f : -1.0f, size);
+		auto end = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::nano>(end - start).count() / repetitions;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	//typical numbers of lattice sites per vertex bundle
+	std::vector<int64_t> sizes({ 64, 256, 1024, 4096 });
+	if (argc > 1)
+	{
+		sizes.clear();
+		for (int i = 1; i < argc; ++i) sizes.push_back(std::atoll(argv[i]));
+	}
+
+	const char *operationNames[SimdKernels::numberOfOperations] = { "multAdd(a, x)", "multAdd(x, x)", "multAdd(a, x, x)", "multSub(a, x)", "multSub(x, x)", "multSub(a, x, x)", "operator+=", "operator-=", "operator*=", "operator/=" };
+
+	printf("active instruction set: %s\n\n", SimdKernels::name(SimdKernels::instructionSet()));
+	printf("%-18s %8s", "operation", "size");
+	for (int s = 0; s < SimdKernels::numberOfInstructionSets; ++s)
+	{
+		if (SimdKernels::isSupported(static_cast<SimdKernels::InstructionSet>(s))) printf(" %12s [ns] %8s", SimdKernels::name(static_cast<SimdKernels::InstructionSet>(s)), "speedup");
+	}
+	printf("\n");
+
+	for (int64_t size : sizes)
+	{
+		ValueSuperbundle<float, 3> data(size);
+		for (int64_t i = 0; i < size; ++i)
+		{
+			data.bundle(0)[i] = 1.0f;
+			data.bundle(1)[i] = 0.5f + 0.25f * float(i % 7);
+			data.bundle(2)[i] = 1.0f + 0.125f * float(i % 5);
+		}
+		const int repetitions = int(std::max<int64_t>(1000, 2000000 / std::max<int64_t>(size, 1)));
+
+		for (int o = 0; o < SimdKernels::numberOfOperations; ++o)
+		{
+			printf("%-18s %8lld", operationNames[o], static_cast<long long>(size));
+			double reference = 0.0;
+			for (int s = 0; s < SimdKernels::numberOfInstructionSets; ++s)
+			{
+				SimdKernels::InstructionSet instructionSet = static_cast<SimdKernels::InstructionSet>(s);
+				if (!SimdKernels::isSupported(instructionSet)) continue;
+
+				double time = measure(SimdKernels::kernel(static_cast<SimdKernels::Operation>(o), instructionSet), data.bundle(0).data(), data.bundle(1).data(), data.bundle(2).data(), size, repetitions);
+				if (instructionSet == SimdKernels::InstructionSet::Scalar) reference = time;
+				printf(" %17.1f %8.2f", time, reference / time);
+			}
+			printf("\n");
+		}
+	}
+
+	return 0;
+}
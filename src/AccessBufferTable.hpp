@@ -0,0 +1,114 @@
+/**
+ * @file AccessBufferTable.hpp
+ * @author Finn Lasse Buessen
+ * @brief Tabulated two-particle vertex access buffers at the frequency mesh points of an integration variable.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cmath>
+#include <vector>
+#include "FrgCommon.hpp"
+
+/**
+ * @brief Table of two-particle vertex access buffers for the positive and negative frequency mesh points of an integration variable.
+ * @details The frequency integrals of the flow equations are mostly evaluated at frequency mesh points. For fixed external frequencies, the access buffers
+ * which are required by an integration kernel only depend on the mesh point of the integration variable. The table generates them for the mesh points inside
+ * the integration range ahead of the integration in a single tight loop, such that the integration kernel only needs to look up precomputed frequency offsets and weights.
+ *
+ * A table is owned by a single thread. Since the storage is retained when the table is reset, a table is best kept per thread and reused for all integrations of the thread.
+ * Lookups are expected in ascending order of the integration variable, as issued by the ImplicitIntegrator routines,
+ * such that mesh points are identified by a single comparison in most cases. Frequencies which are not tabulated mesh points are generated on the fly.
+ *
+ * @tparam AccessBuffer Access buffer type.
+ * @tparam n Number of access buffers per frequency mesh point.
+ */
+template <class AccessBuffer, int n> class AccessBufferTable
+{
+public:
+	/**
+	 * @brief Construct an empty AccessBufferTable object. All lookups are generated on the fly until AccessBufferTable::generate() is called.
+	 */
+	AccessBufferTable() : _cursor(0), _isGenerated(false) {}
+
+	/**
+	 * @brief Discard the tabulated access buffers, while retaining the storage. All lookups are generated on the fly until AccessBufferTable::generate() is called.
+	 */
+	void reset()
+	{
+		_isGenerated = false;
+	}
+
+	/**
+	 * @brief Generate the access buffers for the frequency mesh points wp inside the integration range of ImplicitIntegrator::integrateOutsideCutoff(), i.e. |wp| >= cutoff and |wp + shift| >= cutoff.
+	 *
+	 * @tparam Generator Callable type void(float, AccessBuffer *).
+	 * @param generator Function which writes the n access buffers for the specified integration frequency to the specified array.
+	 * @param shift Transfer frequency by which the second cutoff window is shifted.
+	 * @param cutoff Frequency cutoff.
+	 */
+	template <class Generator> void generate(const Generator &generator, const float shift, const float cutoff)
+	{
+		const FrequencyDiscretization &frequency = FrgCommon::frequency();
+
+		_buffers.resize(2 * frequency.size * n);
+		_isTabulated.resize(2 * frequency.size);
+		for (int i = 0; i < 2 * frequency.size; ++i)
+		{
+			float wp = frequency._dataNegative[i];
+			_isTabulated[i] = (std::abs(wp) >= cutoff && std::abs(wp + shift) >= cutoff);
+			if (_isTabulated[i]) generator(wp, &_buffers[i * n]);
+		}
+		_cursor = 0;
+		_isGenerated = true;
+	}
+
+	/**
+	 * @brief Retrieve the access buffers for the specified integration frequency.
+	 *
+	 * @tparam Generator Callable type void(float, AccessBuffer *).
+	 * @param wp Integration frequency.
+	 * @param generator Function which writes the n access buffers for the specified integration frequency to the specified array. Used if wp is not a tabulated mesh point.
+	 * @param fallback Array of n access buffers, which is used as storage if wp is not a tabulated mesh point.
+	 * @return const AccessBuffer* Pointer to the n access buffers.
+	 */
+	template <class Generator> const AccessBuffer *get(const float wp, const Generator &generator, AccessBuffer *fallback)
+	{
+		int node = _find(wp);
+		if (node < 0)
+		{
+			generator(wp, fallback);
+			return fallback;
+		}
+		return &_buffers[node * n];
+	}
+
+private:
+	/**
+	 * @brief Find the tabulated mesh point of a frequency.
+	 *
+	 * @param wp Frequency.
+	 * @return int Index of the mesh point in FrequencyDiscretization::_dataNegative, or -1 if the frequency is not a tabulated mesh point.
+	 */
+	int _find(const float wp)
+	{
+		if (!_isGenerated) return -1;
+
+		const FrequencyDiscretization &frequency = FrgCommon::frequency();
+		if (_cursor < 2 * frequency.size && frequency._dataNegative[_cursor] == wp) return _isTabulated[_cursor] ? _cursor++ : -1;
+
+		float absWp = (wp < 0) ? -wp : wp;
+		int offset = frequency.offset(absWp);
+		if (frequency._data[offset] != absWp) return -1;
+
+		int node = (wp < 0) ? frequency.size - 1 - offset : frequency.size + offset;
+		_cursor = node + 1;
+		return _isTabulated[node] ? node : -1;
+	}
+
+	int _cursor; ///< Mesh point which is expected to be looked up next.
+	bool _isGenerated; ///< Specifies whether the access buffers have been generated since the last reset.
+	std::vector<AccessBuffer> _buffers; ///< Access buffers, stored consecutively for each mesh point in the order of FrequencyDiscretization::_dataNegative.
+	std::vector<char> _isTabulated; ///< _isTabulated[i] specifies whether the access buffers of mesh point i lie inside the integration range and have been generated.
+};
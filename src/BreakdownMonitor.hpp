@@ -0,0 +1,153 @@
+/**
+ * @file BreakdownMonitor.hpp
+ * @author Finn Lasse Buessen
+ * @brief Detection of flow breakdowns which signal spontaneous symmetry breaking.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cmath>
+#include "lib/Exception.hpp"
+#include "EffectiveAction.hpp"
+
+/**
+ * @brief Monitor which detects a breakdown of the RG flow.
+ * @details In the presence of a magnetic ordering instability, the two-particle vertex, and with it the susceptibility, diverges at a finite cutoff.
+ * The monitor tracks the maximum norm N of the vertex across integration steps and evaluates its logarithmic growth rate g = -d(ln N) / d(ln cutoff).
+ * In the paramagnetic regime, the vertex saturates and g approaches zero, whereas a power-law divergence N ~ (cutoff - cutoff_c)^(-gamma)
+ * yields a growth rate g = gamma * cutoff / (cutoff - cutoff_c) which grows without bounds.
+ * A breakdown is detected once g exceeds the specified maximum growth rate.
+ * On finite frequency and lattice resolutions, the divergence is typically regularized, and the breakdown instead manifests itself as a kink in the flow,
+ * where the steady increase of g is interrupted. If a kink threshold k is specified, a breakdown is therefore also detected
+ * once g has exceeded one (the vertex grows at least as fast as 1/cutoff) and subsequently drops below its peak value by a factor k.
+ * The breakdown cutoff is then identified with the cutoff of the peak growth rate.
+ */
+struct BreakdownMonitor
+{
+public:
+	/**
+	 * @brief Construct a new BreakdownMonitor object.
+	 *
+	 * @param maxGrowthRate Maximum logarithmic growth rate of the vertex norm before a breakdown is detected.
+	 * @param maxKink Maximum ratio between the peak growth rate and the current growth rate before a breakdown is detected. A value of zero disables kink detection.
+	 * @param terminate Indicates whether the calculation should be terminated once a breakdown is detected.
+	 */
+	BreakdownMonitor(const float maxGrowthRate, const float maxKink, const bool terminate) : _maxGrowthRate(maxGrowthRate), _maxKink(maxKink), _terminate(terminate), _hasSample(false), _cutoff(0.0f), _norm(0.0f), _growthRate(NAN), _peakGrowthRate(0.0f), _peakCutoff(NAN), _breakdownCutoff(NAN)
+	{
+		if (!(maxGrowthRate > 0.0f)) throw Exception(Exception::Type::ArgumentError, "Maximum growth rate of the breakdown monitor must be positive");
+		if (!(maxKink == 0.0f || maxKink > 1.0f)) throw Exception(Exception::Type::ArgumentError, "Kink threshold of the breakdown monitor must be zero or greater than one");
+	}
+
+	/**
+	 * @brief Add a sample of the vertex norm at the specified cutoff and test for a breakdown.
+	 * @details Samples must be added in order of decreasing cutoff. Samples which are not finite are ignored.
+	 *
+	 * @param cutoff Cutoff value of the sample.
+	 * @param norm Vertex norm at the specified cutoff.
+	 * @return bool Returns true if a breakdown is detected at the current sample, otherwise returns false.
+	 */
+	bool update(const float cutoff, const float norm)
+	{
+		if (!std::isfinite(norm) || !(norm > 0.0f)) return false;
+		if (!_hasSample || !(cutoff < _cutoff))
+		{
+			_hasSample = true;
+			_cutoff = cutoff;
+			_norm = norm;
+			return false;
+		}
+
+		float growthRate = -(std::log(norm) - std::log(_norm)) / (std::log(cutoff) - std::log(_cutoff));
+		_cutoff = cutoff;
+		_norm = norm;
+		_growthRate = growthRate;
+		if (growthRate > _peakGrowthRate)
+		{
+			_peakGrowthRate = growthRate;
+			_peakCutoff = cutoff;
+		}
+
+		//test for power-law divergence
+		if (growthRate > _maxGrowthRate)
+		{
+			_breakdownCutoff = cutoff;
+			return true;
+		}
+
+		//test for kink
+		if (_maxKink > 0.0f && _peakGrowthRate > 1.0f && growthRate * _maxKink < _peakGrowthRate)
+		{
+			_breakdownCutoff = _peakCutoff;
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Add a sample of the vertex norm of the specified effective action and test for a breakdown.
+	 *
+	 * @param state Effective action to sample.
+	 * @return bool Returns true if a breakdown is detected at the current sample, otherwise returns false.
+	 */
+	bool update(const EffectiveAction &state)
+	{
+		return update(state.cutoff, state.vertexNorm());
+	}
+
+	/**
+	 * @brief Retrieve the most recent logarithmic growth rate of the vertex norm.
+	 *
+	 * @return float Logarithmic growth rate. Returns NaN if fewer than two samples have been added.
+	 */
+	float growthRate() const
+	{
+		return _growthRate;
+	}
+
+	/**
+	 * @brief Retrieve the cutoff at which the largest growth rate has been encountered so far.
+	 * @details A breakdown which is detected in the future occurs at or below this cutoff.
+	 *
+	 * @return float Cutoff of the peak growth rate. Returns NaN if fewer than two samples have been added.
+	 */
+	float peakCutoff() const
+	{
+		return _peakCutoff;
+	}
+
+	/**
+	 * @brief Retrieve the cutoff at which the most recently detected breakdown occurred.
+	 * @details For power-law divergences, this is the cutoff at which the growth rate exceeded its maximum.
+	 * For kinks, this is the cutoff of the peak growth rate, which may lie several samples before the detection.
+	 *
+	 * @return float Breakdown cutoff. Returns NaN if no breakdown has been detected.
+	 */
+	float breakdownCutoff() const
+	{
+		return _breakdownCutoff;
+	}
+
+	/**
+	 * @brief Query whether the calculation should be terminated once a breakdown is detected.
+	 *
+	 * @return bool Returns true if the calculation should be terminated, otherwise returns false.
+	 */
+	bool terminate() const
+	{
+		return _terminate;
+	}
+
+private:
+	float _maxGrowthRate; ///< Maximum logarithmic growth rate of the vertex norm.
+	float _maxKink; ///< Maximum ratio of growth rates in consecutive steps, or zero if kink detection is disabled.
+	bool _terminate; ///< True if the calculation should be terminated once a breakdown is detected.
+	bool _hasSample; ///< True if a previous sample has been added.
+	float _cutoff; ///< Cutoff of the previous sample.
+	float _norm; ///< Vertex norm of the previous sample.
+	float _growthRate; ///< Growth rate between the two previous samples.
+	float _peakGrowthRate; ///< Largest growth rate encountered so far.
+	float _peakCutoff; ///< Cutoff at which the largest growth rate was encountered.
+	float _breakdownCutoff; ///< Cutoff of the detected breakdown.
+};
@@ -8,6 +8,7 @@
 
 #pragma once
 #include <vector>
+#include <string>
 #include "lib/Exception.hpp"
 
 #pragma region CutoffIterator
@@ -78,19 +79,53 @@ private:
 struct CutoffDiscretization
 {
 public:
+	static const int maxMultistepOrder = 4; ///< ֵ֧ Adams-Bashforth ಽ߽,ͬʱʷڴ. 
+
 	/**
 	 * @brief ӽֵֹбһµĽֹɢ. 
 	 * 
 	 * @param values ɢĽֵֹб. 
+	 * @param multistepOrder ɢʱʹõ Adams-Bashforth ಽĽ. 1 Ӧʽŷ. 
 	 */
-	CutoffDiscretization(const std::vector<float> &values)
+	CutoffDiscretization(const std::vector<float> &values, const int multistepOrder = 1)
 	{
 		//ȷɢ㹻Ľֵֹ
 		if (values.size() < 2) throw Exception(Exception::Type::ArgumentError, "ֹɢƵֵ");
+		if (multistepOrder < 1 || multistepOrder > maxMultistepOrder) throw Exception(Exception::Type::ArgumentError, "ಽĽ 1  " + std::to_string(maxMultistepOrder) + " ֮");
 
 		_size = int(values.size());
 		_data = new float[values.size()];
 		memcpy(_data, values.data(), values.size() * sizeof(float));
+		_multistepOrder = multistepOrder;
+		_isAdaptive = false;
+		_initialStep = 0.0f;
+		_tolerance = 0.0f;
+	}
+
+	/**
+	 * @brief һµӦֹɢ. 
+	 * @details Ӧɢʼֵֵֹ,мֵֹӦ΢ַʱݾֲȷ. 
+	 * 
+	 * @param max ʼ()ֵֹ. 
+	 * @param min ֹ(С)ֵֹ. 
+	 * @param initialStep ʼ,һԴ max ֵ max * initialStep. 
+	 * @param tolerance ÿԾֲ. 
+	 */
+	CutoffDiscretization(const float max, const float min, const float initialStep, const float tolerance)
+	{
+		//ȷЧ
+		if (!(max > min) || !(min > 0.0f)) throw Exception(Exception::Type::ArgumentError, "ӦֹɢҪ max > min > 0");
+		if (!(initialStep > 0.0f && initialStep < 1.0f)) throw Exception(Exception::Type::ArgumentError, "Ӧֹɢĳʼ (0, 1) ֮");
+		if (!(tolerance > 0.0f)) throw Exception(Exception::Type::ArgumentError, "ӦֹɢޱΪ");
+
+		_size = 2;
+		_data = new float[2];
+		_data[0] = max;
+		_data[1] = min;
+		_multistepOrder = 1;
+		_isAdaptive = true;
+		_initialStep = initialStep;
+		_tolerance = tolerance;
 	}
 
 	/**
@@ -146,7 +181,51 @@ public:
 		return end();
 	}
 
+	/**
+	 * @brief ɢʱʹõ Adams-Bashforth ಽĽ. 
+	 * 
+	 * @return int ಽĽ. 1 Ӧʽŷ. 
+	 */
+	int multistepOrder() const
+	{
+		return _multistepOrder;
+	}
+
+	/**
+	 * @brief ѯɢǷΪӦ. 
+	 * 
+	 * @return bool ֹӦȷ,򷵻 true,򷵻 false. 
+	 */
+	bool isAdaptive() const
+	{
+		return _isAdaptive;
+	}
+
+	/**
+	 * @brief Ӧɢĳʼ. 
+	 * 
+	 * @return float ʼ. 
+	 */
+	float initialStep() const
+	{
+		return _initialStep;
+	}
+
+	/**
+	 * @brief Ӧɢ. 
+	 * 
+	 * @return float . 
+	 */
+	float tolerance() const
+	{
+		return _tolerance;
+	}
+
 private:
 	int _size; ///< ɢеĽֵֹ. 
 	float *_data; ///< ɢֵڲ洢. 
+	int _multistepOrder; ///< Adams-Bashforth ಽĽ. 
+	bool _isAdaptive; ///< ֹӦȷ,Ϊ true. 
+	float _initialStep; ///< Ӧɢĳʼ. 
+	float _tolerance; ///< Ӧɢ. 
 };
\ No newline at end of file
@@ -8,8 +8,19 @@
 
 #pragma once
 #include <hdf5.h>
+#include <cmath>
+#include <vector>
+#include <string>
 #include "lib/Log.hpp"
+#include "lib/ValueBundle.hpp"
+#include "lib/FloatArray.hpp"
 #include "lib/Exception.hpp"
+#include "lib/FloatFormat.hpp"
+#include "FrgCommon.hpp"
+
+#ifndef DISABLE_MPI
+#include "mpi.h"
+#endif
 
 /**
  * @brief ʵʩЧж. 
@@ -22,7 +33,7 @@ public:
 	/**
 	 * @brief һµEffective Action.
 	 */
-	EffectiveAction() : cutoff(0.0f) {};
+	EffectiveAction() : cutoff(0.0f), vertexFormat(FloatFormat::Float32) {};
 
 	/**
 	 * @brief .
@@ -51,10 +62,224 @@ public:
 
 	/**
 	 * @brief ָʾǷѾɢ NaN. 
+	 * @details Ĭʵֲɨ getDataBundles() صж. ڷֲʽڵ㹲洢Ч, MPI ̼Լ,ʱнϼ. 
 	 *
 	 * @return bool ѷɢ,򷵻 true,򷵻 false. 
 	 */
-	virtual bool isDiverged() const = 0;
+	virtual bool isDiverged() const
+	{
+		int isNan = 0;
+		for (const auto &b : getDataBundles())
+		{
+			bool isNanBundle = false;
+			#ifndef DISABLE_OMP
+			#pragma omp parallel for schedule(static) reduction(||:isNanBundle)
+			#endif
+			for (int64_t i = 0; i < b.size(); ++i) isNanBundle = isNanBundle || std::isnan(b.get(i));
+			if (isNanBundle)
+			{
+				isNan = 1;
+				break;
+			}
+		}
+
+		#ifndef DISABLE_MPI
+		if (isSharded() || isNodeShared()) MPI_Allreduce(MPI_IN_PLACE, &isNan, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD);
+		#endif
+		return isNan != 0;
+	}
+
+	/**
+	 * @brief жݵ(ֵ). 
+	 * @details ÷ڼı.κζΪ NaN ,򷵻 NaN. ڷֲʽڵ㹲洢Ч, MPI ϼ. 
+	 *
+	 * @return float ݵֵ. 
+	 */
+	float vertexNorm() const
+	{
+		float norm = 0.0f;
+		for (const auto &b : getDataBundles())
+		{
+			#ifndef DISABLE_OMP
+			#pragma omp parallel for schedule(static) reduction(max:norm)
+			#endif
+			for (int64_t i = 0; i < b.size(); ++i)
+			{
+				float value = std::abs(b.get(i));
+				//NaN ֵԼӳΪ,ⱻ,ǰӳ NaN
+				if (!(value <= norm)) norm = std::isnan(value) ? INFINITY : value;
+			}
+		}
+
+		#ifndef DISABLE_MPI
+		if (isSharded() || isNodeShared()) MPI_Allreduce(MPI_IN_PLACE, &norm, 1, MPI_FLOAT, MPI_MAX, MPI_COMM_WORLD);
+		#endif
+		return std::isinf(norm) ? NAN : norm;
+	}
+
+	/**
+	 * @brief ָʾǷֲ MPI . 
+	 * @details ڷֲʽ洢Ч, getDataBundles() صǰ̱ش洢Ĳ. 
+	 *
+	 * @return bool Ϊֲʽ洢,򷵻 true,򷵻 false. 
+	 */
+	virtual bool isSharded() const
+	{
+		return false;
+	}
+
+	/**
+	 * @brief ָʾǷͬһڵϵ MPI ̹. 
+	 * @details ڽڵ㹲洢Ч, getDataBundles() ÿڵͽϷعĲ,ֻܶȡ. 
+	 *
+	 * @return bool Ϊڵ㹲洢,򷵻 true,򷵻 false. 
+	 */
+	virtual bool isNodeShared() const
+	{
+		return false;
+	}
+
+	/**
+	 * @brief ж(ֵֹ)б. 
+	 * @details ͬ͵Ч,ص˳ͳϱһ,
+	 * ΢ַԶԪص,˽ⶥľṹ. 
+	 *  16 λʽմ洢ڶȡʱ,дʱ뵽洢. 
+	 *
+	 * @return std::vector<FloatArray> б. 
+	 */
+	virtual std::vector<FloatArray> getDataBundles() const = 0;
+
+	/**
+	 * @brief ֵͨһƵϵЧתƵǰƵ FrgCommon::frequency() . 
+	 * @details ԴЧ뵱ǰͬ. ֵԴԴϵԲֵõ, 
+	 * ԴΧƵȡֵ. ֵֹԴЧ. 
+	 *
+	 * @param source ԴЧ. 
+	 * @param sourceFrequency ԴЧڵԭƵɢ. 
+	 */
+	virtual void regrid(const EffectiveAction &source, FrequencyDiscretization &sourceFrequency) = 0;
+
+	/**
+	 * @brief ǰԭƵ FrgCommon::frequency() Ϊݼ "frequency" д. 
+	 * @details ݼƵ. ȡʱݴжǷҪֵǰ. 
+	 *
+	 * @param group . 
+	 */
+	static void writeFrequencyMesh(const hid_t group)
+	{
+		std::vector<float> mesh;
+		for (auto i = FrgCommon::frequency().begin(); i != FrgCommon::frequency().end(); ++i) mesh.push_back(*i);
+
+		const hsize_t dataSpaceSize[1] = { (hsize_t)mesh.size() };
+		hid_t dataSpace = H5Screate_simple(1, dataSpaceSize, NULL);
+		hid_t dataset = H5Dcreate(group, "frequency", H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+		H5Dwrite(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, mesh.data());
+		H5Dclose(dataset);
+		H5Sclose(dataSpace);
+	}
+
+	/**
+	 * @brief ӼȡڵԭƵ. 
+	 *
+	 * @param group . 
+	 * @return std::vector<float> Ƶ. 㲻Ƶ(ɽ汾д),򷵻ؿб. 
+	 */
+	static std::vector<float> readFrequencyMesh(const hid_t group)
+	{
+		std::vector<float> mesh;
+		hid_t dataset = H5Dopen(group, "frequency", H5P_DEFAULT);
+		if (dataset < 0) return mesh;
+
+		hid_t dataSpace = H5Dget_space(dataset);
+		hsize_t dataSpaceSize[1];
+		H5Sget_simple_extent_dims(dataSpace, dataSpaceSize, NULL);
+		H5Sclose(dataSpace);
+
+		mesh.resize(dataSpaceSize[0]);
+		H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, mesh.data());
+		H5Dclose(dataset);
+		return mesh;
+	}
+
+	/**
+	 * @brief жϼԭƵǷ뵱ǰ FrgCommon::frequency() һ. 
+	 * @details Ƶļ㱻Ϊ뵱ǰһ. 
+	 *
+	 * @param mesh  readFrequencyMesh() ȡƵ. 
+	 * @return bool һ򷵻 true,򷵻 false. 
+	 */
+	static bool isCurrentFrequencyMesh(const std::vector<float> &mesh)
+	{
+		if (mesh.size() == 0) return true;
+		if (int(mesh.size()) != FrgCommon::frequency().size) return false;
+		for (int i = 0; i < int(mesh.size()); ++i)
+		{
+			if (mesh[i] != FrgCommon::frequency()._data[i]) return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief ָʽڼļд洢ݵ HDF5 . 
+	 * @details 16 λʽԶ帡ʹ洢,ȡʱ HDF5 ԶתΪ. صͱͨ H5Tclose() ͷ. 
+	 *
+	 * @param format 洢ʽ. 
+	 * @return hid_t HDF5 . 
+	 */
+	static hid_t checkpointDatatype(const FloatFormat format)
+	{
+		hid_t type = H5Tcopy(H5T_NATIVE_FLOAT);
+		if (format == FloatFormat::Float16)
+		{
+			H5Tset_fields(type, 15, 10, 5, 0, 10);
+			H5Tset_precision(type, 16);
+			H5Tset_ebias(type, 15);
+			H5Tset_size(type, 2);
+		}
+		else if (format == FloatFormat::BFloat16)
+		{
+			H5Tset_fields(type, 15, 7, 8, 0, 7);
+			H5Tset_precision(type, 16);
+			H5Tset_ebias(type, 127);
+			H5Tset_size(type, 2);
+		}
+		return type;
+	}
 
 	float cutoff; ///< RG ֵֹ. 
+	FloatFormat vertexFormat; ///< ӶĴ洢ʽ.  16 λʽ,ƴ洢ĶԸøʽմ洢,ֲʽڵ㹲洢Ķÿͬʱ뵽þ,Ըøʽ㲥д. 
+
+protected:
+	/**
+	 * @brief ȡһԭƵϵļ,ͨ regrid() ֵǰ. 
+	 * @details ԴϹһΪ T ʱЧ,Ӽȡݺֵǰ. 
+	 *
+	 * @tparam T Чľ. 
+	 * @param dataFilePath ļ·. 
+	 * @param checkpointId Ҫȡļıʶ. 
+	 * @param mesh ڵƵ. 
+	 * @return bool ȡɹ򷵻 true򷵻 false. 
+	 */
+	template <typename T> bool readRegriddedCheckpoint(const std::string &dataFilePath, const int checkpointId, const std::vector<float> &mesh)
+	{
+		FrequencyDiscretization sourceFrequency(mesh);
+
+		//ԴϹʱЧȡ
+		T *source;
+		bool success;
+		{
+			FrequencyScope scope(sourceFrequency);
+			source = new T;
+			success = source->readCheckpoint(dataFilePath, checkpointId);
+		}
+
+		//ֵǰ
+		if (success)
+		{
+			Log::log << Log::LogLevel::Info << "Interpolating checkpoint at cutoff " << source->cutoff << " from a frequency mesh with " << int(mesh.size()) << " to " << FrgCommon::frequency().size << " positive frequencies" << Log::endl;
+			regrid(*source, sourceFrequency);
+		}
+		delete source;
+		return success;
+	}
 };
\ No newline at end of file
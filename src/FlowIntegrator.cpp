@@ -0,0 +1,402 @@
+/**
+ * @file FlowIntegrator.cpp
+ * @author Finn Lasse Buessen
+ * @brief Differential equation solver which advances the flowing effective action along the cutoff axis.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <hdf5.h>
+#include "lib/Exception.hpp"
+#include "lib/Log.hpp"
+#include "FlowIntegrator.hpp"
+#include "FrgCommon.hpp"
+#include "FrgCore.hpp"
+#include "SpinParser.hpp"
+
+FlowIntegrator::FlowIntegrator(FrgCore *core) : _core(core), _isAdaptive(FrgCommon::cutoff().isAdaptive()), _multistepOrder(FrgCommon::cutoff().multistepOrder()), _hasFlow(false), _cutoff(FrgCommon::cutoff().begin()), _cutoffStep(0.0f), _tolerance(FrgCommon::cutoff().tolerance())
+{
+	//higher order schemes combine flows on the master rank, which only holds a fraction of a sharded vertex
+	if (_core->flowingFunctional()->isSharded() && (_isAdaptive || _multistepOrder > 1)) throw Exception(Exception::Type::InitializationError, "Sharded vertex distribution is only supported with the Euler integrator");
+	//adaptive steps modify the flowing functional on the master rank while other ranks on the same node may still read a node-shared vertex
+	if (_core->flowingFunctional()->isNodeShared() && _isAdaptive) throw Exception(Exception::Type::InitializationError, "Node-shared vertex distribution is not supported with adaptive integrators");
+
+	_stepControl[0] = 0.0f;
+	_stepControl[1] = 0.0f;
+	_stepControlStack = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(_stepControl, 2);
+}
+
+FlowIntegrator::~FlowIntegrator()
+{
+	SpinParser::spinParser()->getLoadManager()->releaseStack(_stepControlStack);
+}
+
+void FlowIntegrator::initialize()
+{
+	_hasFlow = false;
+	float cutoff = _core->flowingFunctional()->cutoff;
+
+	if (_isAdaptive)
+	{
+		if (cutoff > *FrgCommon::cutoff().begin() || cutoff < *FrgCommon::cutoff().last()) throw Exception(Exception::Type::InitializationError, "Cutoff " + std::to_string(cutoff) + " lies outside of the adaptive cutoff range");
+		_cutoffStep = cutoff * (FrgCommon::cutoff().initialStep() - 1.0f);
+	}
+	else
+	{
+		_cutoff = FrgCommon::cutoff().find(cutoff);
+		if (_cutoff == FrgCommon::cutoff().end()) throw Exception(Exception::Type::InitializationError, "Cutoff " + std::to_string(cutoff) + " is not part of the cutoff discretization");
+	}
+}
+
+bool FlowIntegrator::isFinished() const
+{
+	if (_isAdaptive) return _core->flowingFunctional()->cutoff <= *FrgCommon::cutoff().last();
+	else return _cutoff == FrgCommon::cutoff().last();
+}
+
+bool FlowIntegrator::requiresFlow() const
+{
+	return !_hasFlow;
+}
+
+void FlowIntegrator::step()
+{
+	if (_isAdaptive) _stepBogackiShampine();
+	else if (_multistepOrder > 1) _stepAdamsBashforth();
+	else _stepEuler();
+}
+
+void FlowIntegrator::_stepEuler()
+{
+	++_cutoff;
+	_core->finalizeStep(*_cutoff);
+	_hasFlow = false;
+}
+
+void FlowIntegrator::_stepAdamsBashforth()
+{
+	float cutoff = _core->flowingFunctional()->cutoff;
+	++_cutoff;
+	float cutoffNew = *_cutoff;
+
+	//the flow is only fully available on the master rank, other ranks receive the updated flowing functional in FrgCore::finalizeStep()
+	if (SpinParser::spinParser()->isMasterRank())
+	{
+		std::vector<FloatArray> flow = _core->flow()->getDataBundles();
+
+		//prepend current flow to the history
+		_flowHistory.push_front(std::vector<float>());
+		_gather(flow, _flowHistory.front());
+		_flowHistoryCutoff.push_front(cutoff);
+
+		//replace the flow by the effective flow of the multistep scheme, which is then applied by FrgCore::finalizeStep()
+		std::vector<double> weights = adamsBashforthWeights(std::vector<float>(_flowHistoryCutoff.begin(), _flowHistoryCutoff.end()), cutoffNew);
+		std::vector<float> coefficients(weights.size());
+		std::vector<const float *> history(weights.size());
+		for (unsigned int j = 0; j < weights.size(); ++j)
+		{
+			coefficients[j] = float(weights[j] / (double(cutoffNew) - double(cutoff)));
+			history[j] = _flowHistory[j].data();
+		}
+
+		int64_t offset = 0;
+		for (auto &b : flow)
+		{
+			//the flow is always stored in single precision
+			float *f = b.data();
+			#ifndef DISABLE_OMP
+			#pragma omp parallel for schedule(static)
+			#endif
+			for (int64_t i = 0; i < b.size(); ++i)
+			{
+				float value = 0.0f;
+				for (unsigned int j = 0; j < coefficients.size(); ++j) value += coefficients[j] * history[j][offset + i];
+				f[i] = value;
+			}
+			offset += b.size();
+		}
+
+		//only the most recent k - 1 entries are required for the next step
+		while (int(_flowHistory.size()) > _multistepOrder - 1)
+		{
+			_flowHistory.pop_back();
+			_flowHistoryCutoff.pop_back();
+		}
+	}
+
+	_core->finalizeStep(cutoffNew);
+	_hasFlow = false;
+}
+
+void FlowIntegrator::_stepBogackiShampine()
+{
+	//step sizes below this fraction of the cutoff are accepted regardless of the error estimate
+	const float minimalStepRatio = 1e-4f;
+
+	bool isMasterRank = SpinParser::spinParser()->isMasterRank();
+	std::vector<FloatArray> state = _core->flowingFunctional()->getDataBundles();
+	std::vector<FloatArray> flow = _core->flow()->getDataBundles();
+
+	//set the flowing functional to y0 + sum_i c_i k_i; compactly stored vertices are rounded to their storage format
+	auto setState = [&](const std::vector<std::pair<float, const std::vector<float> *>> &stages)
+	{
+		int64_t offset = 0;
+		for (auto &b : state)
+		{
+			const float *y0 = _y0.data() + offset;
+			#ifndef DISABLE_OMP
+			#pragma omp parallel for schedule(static)
+			#endif
+			for (int64_t i = 0; i < b.size(); ++i)
+			{
+				float value = y0[i];
+				for (auto &s : stages) value += s.first * (*s.second)[offset + i];
+				b.set(i, value);
+			}
+			offset += b.size();
+		}
+	};
+
+	float cutoffInitial = _core->flowingFunctional()->cutoff;
+	float cutoffFinal = *FrgCommon::cutoff().last();
+
+	//store initial state and first stage, which is the flow at the initial state
+	if (isMasterRank)
+	{
+		_gather(state, _y0);
+		_gather(flow, _k1);
+	}
+
+	bool isAccepted = false;
+	while (!isAccepted)
+	{
+		float h = _cutoffStep;
+		float cutoffNew = cutoffInitial + h;
+		if (cutoffNew <= cutoffFinal)
+		{
+			h = cutoffFinal - cutoffInitial;
+			cutoffNew = cutoffFinal;
+		}
+
+		//second stage
+		if (isMasterRank) setState({ { 0.5f * h, &_k1 } });
+		_evaluateFlow(cutoffInitial + 0.5f * h);
+		if (isMasterRank) _gather(flow, _k2);
+
+		//third stage
+		if (isMasterRank) setState({ { 0.75f * h, &_k2 } });
+		_evaluateFlow(cutoffInitial + 0.75f * h);
+		if (isMasterRank) _gather(flow, _k3);
+
+		//third order solution; the flow at the new state is the fourth stage, which doubles as the first stage of the next step
+		if (isMasterRank) setState({ { 2.0f / 9.0f * h, &_k1 }, { 1.0f / 3.0f * h, &_k2 }, { 4.0f / 9.0f * h, &_k3 } });
+		_evaluateFlow(cutoffNew);
+
+		//estimate error from difference to the embedded second order solution
+		if (isMasterRank)
+		{
+			float error = 0.0f;
+			int64_t offset = 0;
+			for (unsigned int n = 0; n < state.size(); ++n)
+			{
+				//compactly stored vertices are decoded from their storage format
+				const FloatArray &y = state[n];
+				const float *k4 = flow[n].data();
+				const float *y0 = _y0.data() + offset;
+				const float *k1 = _k1.data() + offset;
+				const float *k2 = _k2.data() + offset;
+				const float *k3 = _k3.data() + offset;
+				#ifndef DISABLE_OMP
+				#pragma omp parallel for schedule(static) reduction(max:error)
+				#endif
+				for (int64_t i = 0; i < state[n].size(); ++i)
+				{
+					float e = h * (-5.0f / 72.0f * k1[i] + 1.0f / 12.0f * k2[i] + 1.0f / 9.0f * k3[i] - 1.0f / 8.0f * k4[i]);
+					float scale = _tolerance * (1.0f + std::max(std::abs(y0[i]), std::abs(y.get(i))));
+					float r = std::abs(e) / scale;
+					if (!(r <= error)) error = (std::isnan(r)) ? INFINITY : r;
+				}
+				offset += state[n].size();
+			}
+
+			float factor;
+			if (std::isfinite(error)) factor = (error > 0.0f) ? std::min(5.0f, std::max(0.2f, 0.9f * std::pow(error, -1.0f / 3.0f))) : 5.0f;
+			else factor = 0.2f;
+
+			bool accept = (error <= 1.0f);
+			if (!accept && std::abs(h) <= minimalStepRatio * cutoffInitial)
+			{
+				Log::log << Log::LogLevel::Warning << "Adaptive step size reached its lower bound at cutoff " << cutoffInitial << ". Accepting step with error estimate " << error << Log::endl;
+				accept = true;
+				factor = 1.0f;
+			}
+
+			_stepControl[0] = accept ? 1.0f : 0.0f;
+			_stepControl[1] = h * factor;
+			Log::log << Log::LogLevel::Debug << "Adaptive step from cutoff " << cutoffInitial << " to " << cutoffNew << (accept ? " accepted" : " rejected") << " with error estimate " << error << Log::endl;
+		}
+		SpinParser::spinParser()->getLoadManager()->broadcast(_stepControlStack);
+		isAccepted = (_stepControl[0] != 0.0f);
+		_cutoffStep = _stepControl[1];
+
+		//restore initial state
+		if (!isAccepted)
+		{
+			if (isMasterRank) setState({});
+			_core->flowingFunctional()->cutoff = cutoffInitial;
+			_core->synchronizeFlowingFunctional();
+		}
+	}
+
+	_hasFlow = true;
+}
+
+void FlowIntegrator::_evaluateFlow(const float cutoff)
+{
+	_core->flowingFunctional()->cutoff = cutoff;
+	_core->synchronizeFlowingFunctional();
+	_core->computeStep();
+}
+
+void FlowIntegrator::writeCheckpoint(const std::string &dataFilePath, const int checkpointId) const
+{
+	if (_flowHistory.size() == 0) return;
+
+	H5Eset_auto(H5E_DEFAULT, NULL, NULL);
+	hid_t file = H5Fopen(dataFilePath.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+	if (file < 0) throw Exception(Exception::Type::IOError, "Could not open checkpoint file for writing");
+	hid_t group = H5Gopen(file, ("checkpoint_" + std::to_string(checkpointId)).c_str(), H5P_DEFAULT);
+	if (group < 0)
+	{
+		H5Fclose(file);
+		throw Exception(Exception::Type::IOError, "Could not find checkpoint " + std::to_string(checkpointId));
+	}
+
+	//write cutoffs of the history entries
+	std::vector<float> cutoffs(_flowHistoryCutoff.begin(), _flowHistoryCutoff.end());
+	hsize_t cutoffSpaceSize[1] = { (hsize_t)cutoffs.size() };
+	hid_t cutoffSpace = H5Screate_simple(1, cutoffSpaceSize, NULL);
+	hid_t cutoffDataset = H5Dcreate(group, "flowHistoryCutoff", H5T_NATIVE_FLOAT, cutoffSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	H5Dwrite(cutoffDataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, cutoffs.data());
+	H5Dclose(cutoffDataset);
+	H5Sclose(cutoffSpace);
+
+	//write history entries as rows of a two-dimensional dataset
+	hsize_t historySpaceSize[2] = { (hsize_t)_flowHistory.size(), (hsize_t)_flowHistory.front().size() };
+	hid_t historySpace = H5Screate_simple(2, historySpaceSize, NULL);
+	hid_t historyDataset = H5Dcreate(group, "flowHistory", H5T_NATIVE_FLOAT, historySpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	for (unsigned int j = 0; j < _flowHistory.size(); ++j)
+	{
+		hsize_t rowOffset[2] = { (hsize_t)j, 0 };
+		hsize_t rowSize[2] = { 1, (hsize_t)_flowHistory[j].size() };
+		hid_t rowSpace = H5Screate_simple(2, rowSize, NULL);
+		H5Sselect_hyperslab(historySpace, H5S_SELECT_SET, rowOffset, NULL, rowSize, NULL);
+		H5Dwrite(historyDataset, H5T_NATIVE_FLOAT, rowSpace, historySpace, H5P_DEFAULT, _flowHistory[j].data());
+		H5Sclose(rowSpace);
+	}
+	H5Dclose(historyDataset);
+	H5Sclose(historySpace);
+
+	H5Gclose(group);
+	H5Fclose(file);
+}
+
+bool FlowIntegrator::readCheckpoint(const std::string &dataFilePath)
+{
+	_flowHistory.clear();
+	_flowHistoryCutoff.clear();
+	if (_isAdaptive || _multistepOrder <= 1) return false;
+
+	H5Eset_auto(H5E_DEFAULT, NULL, NULL);
+	hid_t file = H5Fopen(dataFilePath.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+	if (file < 0) throw Exception(Exception::Type::IOError, "Could not open checkpoint file for reading");
+
+	//find the checkpoint which matches the current cutoff
+	float cutoff = _core->flowingFunctional()->cutoff;
+	hid_t group = -1;
+	hsize_t numObjects;
+	H5Gget_num_objs(file, &numObjects);
+	for (int i = 0; i < int(numObjects) && group < 0; ++i)
+	{
+		if (H5Gget_objtype_by_idx(file, i) == H5G_GROUP)
+		{
+			const int groupNameMaxLength = 32;
+			char groupName[groupNameMaxLength];
+			H5Gget_objname_by_idx(file, i, groupName, groupNameMaxLength);
+
+			hid_t g = H5Gopen(file, groupName, H5P_DEFAULT);
+			hid_t attr = H5Aopen(g, "cutoff", H5P_DEFAULT);
+			float c = NAN;
+			H5Aread(attr, H5T_NATIVE_FLOAT, &c);
+			H5Aclose(attr);
+
+			if (c == cutoff) group = g;
+			else H5Gclose(g);
+		}
+	}
+	if (group < 0)
+	{
+		H5Fclose(file);
+		return false;
+	}
+
+	//read history, discard it if it is incompatible with the current flow
+	hsize_t flowSize = 0;
+	for (const auto &b : _core->flow()->getDataBundles()) flowSize += b.size();
+	hid_t cutoffDataset = H5Dopen(group, "flowHistoryCutoff", H5P_DEFAULT);
+	hid_t historyDataset = H5Dopen(group, "flowHistory", H5P_DEFAULT);
+	if (cutoffDataset >= 0 && historyDataset >= 0)
+	{
+		hid_t historySpace = H5Dget_space(historyDataset);
+		hsize_t historySpaceSize[2] = { 0, 0 };
+		if (H5Sget_simple_extent_ndims(historySpace) == 2) H5Sget_simple_extent_dims(historySpace, historySpaceSize, NULL);
+		H5Sclose(historySpace);
+
+		//flow evaluations on a different frequency mesh cannot be reused after the checkpoint has been interpolated
+		if (historySpaceSize[0] > 0 && historySpaceSize[1] == flowSize && EffectiveAction::isCurrentFrequencyMesh(EffectiveAction::readFrequencyMesh(group)))
+		{
+			std::vector<float> cutoffs(historySpaceSize[0]);
+			std::vector<float> data(historySpaceSize[0] * historySpaceSize[1]);
+			H5Dread(cutoffDataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, cutoffs.data());
+			H5Dread(historyDataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+
+			for (unsigned int j = 0; j < cutoffs.size() && int(j) < _multistepOrder - 1; ++j)
+			{
+				_flowHistory.push_back(std::vector<float>(data.begin() + j * historySpaceSize[1], data.begin() + (j + 1) * historySpaceSize[1]));
+				_flowHistoryCutoff.push_back(cutoffs[j]);
+			}
+		}
+		else Log::log << Log::LogLevel::Warning << "Integrator history in checkpoint is incompatible with the current flow. Restarting multistep integration." << Log::endl;
+	}
+	if (cutoffDataset >= 0) H5Dclose(cutoffDataset);
+	if (historyDataset >= 0) H5Dclose(historyDataset);
+
+	H5Gclose(group);
+	H5Fclose(file);
+	return _flowHistory.size() > 0;
+}
+
+void FlowIntegrator::_gather(const std::vector<FloatArray> &bundles, std::vector<float> &buffer)
+{
+	int64_t totalSize = 0;
+	for (const auto &b : bundles) totalSize += b.size();
+	buffer.resize(totalSize);
+
+	int64_t offset = 0;
+	for (const auto &b : bundles)
+	{
+		if (b.isCompact())
+		{
+			float *data = buffer.data() + offset;
+			#ifndef DISABLE_OMP
+			#pragma omp parallel for schedule(static)
+			#endif
+			for (int64_t i = 0; i < b.size(); ++i) data[i] = b.get(i);
+		}
+		else memcpy(buffer.data() + offset, b.data(), b.size() * sizeof(float));
+		offset += b.size();
+	}
+}
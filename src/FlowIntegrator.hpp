@@ -0,0 +1,189 @@
+/**
+ * @file FlowIntegrator.hpp
+ * @author Finn Lasse Buessen
+ * @brief Differential equation solver which advances the flowing effective action along the cutoff axis.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <vector>
+#include <deque>
+#include <string>
+#include "lib/FloatArray.hpp"
+#include "CutoffDiscretization.hpp"
+
+class FrgCore;
+
+/**
+ * @brief Differential equation solver which advances the flowing effective action of an FrgCore along the cutoff axis.
+ * @details For discrete cutoff discretizations, the integrator performs explicit Euler steps between consecutive cutoff values.
+ * If a multistep order k > 1 is specified in the cutoff discretization, the integrator instead performs variable step size Adams-Bashforth steps of order k,
+ * which reuse the flow evaluated in the k - 1 previous steps and do not require additional flow evaluations.
+ * The first steps of the integration, where fewer previous flow evaluations are available, are performed with the highest order the history permits.
+ * The history is kept on the MPI master rank only, such that the memory overhead is bounded by k copies of the flow.
+ *
+ * For adaptive cutoff discretizations, the integrator performs steps of the embedded Bogacki-Shampine 3(2) Runge-Kutta scheme.
+ * The step size is then controlled by the difference between the third order solution and the embedded second order solution,
+ * which is compared against the relative tolerance of the cutoff discretization.
+ * Rejected steps are repeated with a reduced step size.
+ * The scheme has the first-same-as-last property, such that an accepted step requires three additional flow evaluations.
+ *
+ * Linear combinations of the effective action are performed on the MPI master rank only, which also stores the intermediate Runge-Kutta stages.
+ * Intermediate states are distributed to all ranks via FrgCore::synchronizeFlowingFunctional().
+ */
+class FlowIntegrator
+{
+public:
+	/**
+	 * @brief Construct a new FlowIntegrator object which operates on the specified FrgCore.
+	 *
+	 * @param core FrgCore to operate on.
+	 */
+	FlowIntegrator(FrgCore *core);
+
+	/**
+	 * @brief Destroy the FlowIntegrator object and release its step control stack.
+	 */
+	~FlowIntegrator();
+
+	/**
+	 * @brief Prepare the integration, starting from the current cutoff value of the flowing functional.
+	 * @details Must be called after the flowing functional has been initialized or read from a checkpoint.
+	 */
+	void initialize();
+
+	/**
+	 * @brief Query whether the integration has reached the final cutoff value.
+	 *
+	 * @return bool Returns true if the final cutoff has been reached, otherwise returns false.
+	 */
+	bool isFinished() const;
+
+	/**
+	 * @brief Query whether the flow at the current state of the flowing functional has yet to be computed via FrgCore::computeStep().
+	 * @details Adaptive steps already evaluate the flow at the final state of each accepted step, such that it can be reused for the subsequent step.
+	 *
+	 * @return bool Returns true if FrgCore::computeStep() must be called before the next integration step, otherwise returns false.
+	 */
+	bool requiresFlow() const;
+
+	/**
+	 * @brief Advance the flowing functional by one integration step.
+	 * @details The flow at the current state must have been computed.
+	 */
+	void step();
+
+	/**
+	 * @brief Write the integrator history to an existing checkpoint, which has been written via EffectiveAction::writeCheckpoint().
+	 * @details Only required on the MPI master rank. If the integrator holds no history, the checkpoint is left unmodified.
+	 *
+	 * @param dataFilePath Checkpoint file path.
+	 * @param checkpointId Identifier of the checkpoint.
+	 */
+	void writeCheckpoint(const std::string &dataFilePath, const int checkpointId) const;
+
+	/**
+	 * @brief Read the integrator history from the checkpoint which matches the current cutoff of the flowing functional.
+	 * @details Only required on the MPI master rank. If the checkpoint holds no compatible history, the integration restarts with a low order scheme.
+	 *
+	 * @param dataFilePath Checkpoint file path.
+	 * @return bool Returns true if an integrator history has been read, otherwise returns false.
+	 */
+	bool readCheckpoint(const std::string &dataFilePath);
+
+	/**
+	 * @brief Compute the weights of a variable step size Adams-Bashforth step.
+	 * @details The weights w_j integrate the interpolating polynomial through the flows f_j at the specified cutoffs from cutoffs[0] to newCutoff,
+	 * such that the solution is advanced as y(newCutoff) = y(cutoffs[0]) + sum_j w_j f_j.
+	 * The order of the step is given by the number of cutoff values.
+	 *
+	 * @param cutoffs Cutoff values of the flow evaluations, starting with the most recent one.
+	 * @param newCutoff Cutoff value to integrate to.
+	 * @return std::vector<double> Weights of the flow evaluations.
+	 */
+	static std::vector<double> adamsBashforthWeights(const std::vector<float> &cutoffs, const float newCutoff)
+	{
+		//interpolation nodes relative to the most recent cutoff
+		int n = int(cutoffs.size());
+		std::vector<double> x(n);
+		for (int i = 0; i < n; ++i) x[i] = double(cutoffs[i]) - double(cutoffs[0]);
+		double h = double(newCutoff) - double(cutoffs[0]);
+
+		std::vector<double> weights(n);
+		for (int j = 0; j < n; ++j)
+		{
+			//polynomial coefficients of the Lagrange basis polynomial L_j
+			std::vector<double> c(1, 1.0);
+			for (int i = 0; i < n; ++i)
+			{
+				if (i == j) continue;
+				std::vector<double> d(c.size() + 1, 0.0);
+				for (unsigned int k = 0; k < c.size(); ++k)
+				{
+					d[k + 1] += c[k] / (x[j] - x[i]);
+					d[k] -= c[k] * x[i] / (x[j] - x[i]);
+				}
+				c = d;
+			}
+
+			//integrate L_j over [0, h]
+			double w = 0.0;
+			double hPower = h;
+			for (unsigned int k = 0; k < c.size(); ++k)
+			{
+				w += c[k] * hPower / (k + 1);
+				hPower *= h;
+			}
+			weights[j] = w;
+		}
+		return weights;
+	}
+
+private:
+	/**
+	 * @brief Perform an explicit Euler step to the next cutoff value of a discrete cutoff discretization.
+	 */
+	void _stepEuler();
+
+	/**
+	 * @brief Perform an Adams-Bashforth step to the next cutoff value of a discrete cutoff discretization.
+	 */
+	void _stepAdamsBashforth();
+
+	/**
+	 * @brief Perform an adaptive Bogacki-Shampine step.
+	 */
+	void _stepBogackiShampine();
+
+	/**
+	 * @brief Set the cutoff of the flowing functional, distribute the flowing functional to all ranks and compute the flow.
+	 *
+	 * @param cutoff Cutoff value at which the flow is evaluated.
+	 */
+	void _evaluateFlow(const float cutoff);
+
+	/**
+	 * @brief Copy the concatenated data of a list of vertex data arrays into a buffer. Compactly stored arrays are decoded to single precision.
+	 *
+	 * @param bundles List of vertex data arrays.
+	 * @param buffer Buffer which is resized to hold the data.
+	 */
+	static void _gather(const std::vector<FloatArray> &bundles, std::vector<float> &buffer);
+
+	FrgCore *_core; ///< FrgCore to operate on.
+	bool _isAdaptive; ///< True if the integrator performs adaptive steps, false if it follows a discrete cutoff discretization.
+	int _multistepOrder; ///< Order of Adams-Bashforth steps.
+	bool _hasFlow; ///< True if the flow of the FrgCore is up to date with the current state of the flowing functional.
+	CutoffIterator _cutoff; ///< Current position in the discrete cutoff discretization.
+	float _cutoffStep; ///< Trial step size of the next adaptive step.
+	float _tolerance; ///< Relative tolerance of adaptive steps.
+	float _stepControl[2]; ///< Buffer to distribute the step control decision (accepted flag and next step size) from the master rank.
+	int _stepControlStack; ///< Reference to the LoadManager::DataStack which holds the step control buffer.
+	std::vector<float> _y0; ///< Flowing functional at the beginning of an adaptive step.
+	std::vector<float> _k1; ///< First Runge-Kutta stage.
+	std::vector<float> _k2; ///< Second Runge-Kutta stage.
+	std::vector<float> _k3; ///< Third Runge-Kutta stage.
+	std::deque<std::vector<float>> _flowHistory; ///< Flow evaluations of previous Adams-Bashforth steps, starting with the most recent one.
+	std::deque<float> _flowHistoryCutoff; ///< Cutoff values of the previous flow evaluations.
+};
@@ -10,6 +10,8 @@
 #include <vector>
 #include <algorithm>
 #include <cstdlib>
+#include <cstdint>
+#include <cmath>
 #include "lib/Exception.hpp"
 #include "lib/Log.hpp"
 #include "lib/Assert.hpp"
@@ -191,6 +193,15 @@ public:
 			_data[i] = values[i];
 		}
 
+		//ָ(ȱ),ͨıպʽ
+		_logMinimum = std::log(double(_data[0]));
+		_inverseLogStep = double(size - 1) / (std::log(double(_data[size - 1])) - _logMinimum);
+		_isExponential = std::isfinite(_inverseLogStep);
+		for (int i = 0; i < size && _isExponential; ++i)
+		{
+			if (std::abs((std::log(double(_data[i])) - _logMinimum) * _inverseLogStep - double(i)) > 0.25) _isExponential = false;
+		}
+
 		Log::log << Log::LogLevel::Debug<< "Initialized frequency grid with mesh values" << Log::endl;
 		for (auto i = beginNegative(); i != end(); ++i)	Log::log << "\t" << *i << Log::endl;
 	}
@@ -261,11 +272,8 @@ public:
 		else
 		{
 			if (w <= _data[0]) return FrequencyIterator(_data);
-			for (int i = 1; i < size; ++i)
-			{
-				if (_data[i] > w) return FrequencyIterator(_data + i - 1);
-			}
-			return FrequencyIterator(_data + size - 1);
+			if (!(w < _data[size - 1])) return FrequencyIterator(_data + size - 1);
+			return FrequencyIterator(_data + _upperIndex(w) - 1);
 		}
 	}
 
@@ -287,11 +295,8 @@ public:
 		else
 		{
 			if (w <= _data[0]) return FrequencyIterator(_data);
-			for (int i = 1; i < size; ++i)
-			{
-				if (_data[i] > w) return FrequencyIterator(_data + i);
-			}
-			return FrequencyIterator(_data + size - 1);
+			if (!(w < _data[size - 1])) return FrequencyIterator(_data + size - 1);
+			return FrequencyIterator(_data + _upperIndex(w));
 		}
 	}
 
@@ -308,11 +313,10 @@ public:
 		ASSERT(w >= 0);
 
 		if (w <= _data[0]) return 0;
-		for (int i = 1; i < size; ++i)
-		{
-			if (_data[i] >= w) return i;
-		}
-		return size - 1;
+		if (!(w < _data[size - 1])) return size - 1;
+
+		int i = _upperIndex(w);
+		return (_data[i - 1] == w) ? i - 1 : i;
 	}	
 
 	/**
@@ -335,15 +339,12 @@ public:
 			bias = 0.0f;
 			return;
 		}
-		for (int i = 1; i < size; ++i)
+		if (w < _data[size - 1])
 		{
-			if (_data[i] > w)
-			{
-				upperOffset = i;
-				lowerOffset = i - 1;
-				bias = (w - _data[lowerOffset]) / (_data[upperOffset] - _data[lowerOffset]);
-				return;
-			}
+			upperOffset = _upperIndex(w);
+			lowerOffset = upperOffset - 1;
+			bias = (w - _data[lowerOffset]) / (_data[upperOffset] - _data[lowerOffset]);
+			return;
 		}
 		lowerOffset = size - 1;
 		upperOffset = size - 1;
@@ -355,7 +356,56 @@ public:
 		ASSERT(bias >= 0.0f && bias <= 1.0f);
 	}
 
+	/**
+	 * @brief չӶдƵ su = so*(so+1)/2 + uo ( 0 <= uo <= so). 
+	 * @details ͨƽıպʽ,ӶΪ O(1). ͨУ. 
+	 * 
+	 * @param[in] su Ƶ. 
+	 * @param[out] so һƵʲ. 
+	 * @param[out] uo Ƶʲ. 
+	 */
+	static void expandTriangularIndex(const int64_t su, int &so, int &uo)
+	{
+		ASSERT(su >= 0);
+		ASSERT(&so != &uo);
+
+		int64_t o = int64_t((std::sqrt(8.0 * double(su) + 1.0) - 1.0) / 2.0);
+		while (o * (o + 1) / 2 > su) --o;
+		while ((o + 1) * (o + 2) / 2 <= su) ++o;
+
+		so = int(o);
+		uo = int(su - o * (o + 1) / 2);
+	}
+
 	int size; ///< . 
 	float *_data; ///< ָһָ롣֮ FrequencyDiscretization::_dataNegative. 
 	float *_dataNegative; ///< ָһָ. 
+
+private:
+	/**
+	 * @brief ҴָƵֵĵһ. 
+	 * @details ָ,ɶıպʽ,ͨľȷȽϽУ,˽ȫһ. 
+	 * ,ʹöֲ. 
+	 * 
+	 * @param w Ƶֵ.  _data[0] < w < _data[size-1]. 
+	 * @return int ,ΧΪ [1,size-1]. 
+	 */
+	int _upperIndex(const float w) const
+	{
+		ASSERT(w > _data[0] && w < _data[size - 1]);
+
+		if (_isExponential)
+		{
+			int i = int((std::log(double(w)) - _logMinimum) * _inverseLogStep) + 1;
+			i = std::max(1, std::min(size - 1, i));
+			while (_data[i - 1] > w) --i;
+			while (_data[i] <= w) ++i;
+			return i;
+		}
+		else return int(std::upper_bound(_data + 1, _data + size - 1, w) - _data);
+	}
+
+	bool _isExponential; ///< Ƿ()ɵȱ. 
+	double _logMinimum; ///< СĶ. 
+	double _inverseLogStep; ///< ָ֮ȵĶĵ. 
 };
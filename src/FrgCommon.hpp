@@ -17,6 +17,7 @@
 struct FrgCommon
 {
 	friend class SpinParser;
+	friend struct FrequencyScope;
 public:
 	/**
 	 * @brief ʾ. 
@@ -52,4 +53,38 @@ private:
 	static Lattice *_lattice; ///< ӱʾ. 
 	static FrequencyDiscretization *_frequency; ///< ԭƵɢ. 
 	static CutoffDiscretization *_cutoff; ///< Ƶʽֹɢ. 
+};
+
+/**
+ * @brief ڶʱ滻 FrgCommon ԭƵɢ. 
+ * @details Ĺ졢չͲֵǻ FrgCommon::frequency(). 
+ * ΪڲͬƵ϶Ķ֮вֵ,ڽɢ滻ΪԴ. 
+ * ʱָԭʼɢ. 
+ */
+struct FrequencyScope
+{
+public:
+	/**
+	 * @brief һµ FrequencyScope 滻ԭƵɢ. 
+	 * 
+	 * @param frequency ڶʹõԭƵɢ. 
+	 */
+	FrequencyScope(FrequencyDiscretization &frequency) : _frequency(FrgCommon::_frequency)
+	{
+		FrgCommon::_frequency = &frequency;
+	}
+
+	/**
+	 * @brief  FrequencyScope 󲢻ָԭʼԭƵɢ. 
+	 */
+	~FrequencyScope()
+	{
+		FrgCommon::_frequency = _frequency;
+	}
+
+	FrequencyScope(const FrequencyScope &) = delete;
+	FrequencyScope &operator=(const FrequencyScope &) = delete;
+
+private:
+	FrequencyDiscretization *_frequency; ///< ԭʼԭƵɢ. 
 };
\ No newline at end of file
@@ -85,6 +85,13 @@ public:
 	 */
 	virtual void finalizeStep(float newCutoff) = 0;
 
+	/**
+	 * @brief ʵ MPI ֮ͬ. 
+	 * @details ÷ľʵԤƻὫ FrgCore::flowingFunctional ĽֵֹͶݹ㲥н. 
+	 * ΢ֱַ޸֮ڶ༶ַм䲽У. 
+	 */
+	virtual void synchronizeFlowingFunctional() = 0;
+
 	/**
 	 * @brief .
 	 *
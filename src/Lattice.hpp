@@ -42,65 +42,41 @@ enum struct SpinComponent : int
  * Ƶأڶ v(j,i2) ӳ䵽Ĵ id б. 
  * ⣬洢ԳƱ任. 
  * (rid1[i],rid2[i],任X1[i],任Y1[i],任Z1[i],任X2[i],任Y2[i],任Z2[i])ÿԪص j ϵܺеĵı任. 
+ * ýṹ LatticeOverlapTable һеķӵͼ. 
  */
 struct LatticeOverlap
 {
-	friend std::pair<Lattice *, SpinModel *> LatticeModelFactory::newLatticeModel(const LatticeModelFactory::LatticeUnitCell &uc, const LatticeModelFactory::SpinModelUnitCell &spinModelDefinition, const int latticeRange, const std::string &ldfPath);
-	friend struct Lattice;
-
-public:
 	LatticeOverlap() : rid1(nullptr), rid2(nullptr), transformedX1(nullptr), transformedY1(nullptr), transformedZ1(nullptr), transformedX2(nullptr), transformedY2(nullptr), transformedZ2(nullptr), size(0) {}
 
-	/**
-	 * @brief Ϊվ㹹һµ Lattice Overlap . 
-	 * 
-	 * @param size صվ. 
-	 */
-	LatticeOverlap(const int size) : size(size)
-	{
-		rid1 = new int[size];
-		rid2 = new int[size];
-		transformedX1 = new SpinComponent[size];
-		transformedY1 = new SpinComponent[size];
-		transformedZ1 = new SpinComponent[size];
-		transformedX2 = new SpinComponent[size];
-		transformedY2 = new SpinComponent[size];
-		transformedZ2 = new SpinComponent[size];
-	}
+	const int *rid1;
+	const int *rid2;
+	const SpinComponent *transformedX1;
+	const SpinComponent *transformedY1;
+	const SpinComponent *transformedZ1;
+	const SpinComponent *transformedX2;
+	const SpinComponent *transformedY2;
+	const SpinComponent *transformedZ2;
+	int size;
+};
 
+/**
+ * @brief дԸľصѹϡ (CSR) ʾ. 
+ * @details Ը rid صش洢 [offsets[rid], offsets[rid+1]) . 
+ * ÿ LatticeOverlap Ǹñһеͼ. кĹͬһű, ݿ԰رص. 
+ */
+struct LatticeOverlapTable
+{
 	/**
-	 * @brief е Lattice Overlap һµ Lattice Overlap .
-	 *
-	 * @param rhs ص.
+	 * @brief һյ LatticeOverlapTable . 
 	 */
-	LatticeOverlap(const LatticeOverlap &rhs) : LatticeOverlap(rhs.size)
-	{
-		memcpy(rid1, rhs.rid1, size * sizeof(int));
-		memcpy(rid2, rhs.rid2, size * sizeof(int));
-		memcpy(transformedX1, rhs.transformedX1, size * sizeof(SpinComponent));
-		memcpy(transformedY1, rhs.transformedY1, size * sizeof(SpinComponent));
-		memcpy(transformedZ1, rhs.transformedZ1, size * sizeof(SpinComponent));
-		memcpy(transformedX2, rhs.transformedX2, size * sizeof(SpinComponent));
-		memcpy(transformedY2, rhs.transformedY2, size * sizeof(SpinComponent));
-		memcpy(transformedZ2, rhs.transformedZ2, size * sizeof(SpinComponent));
-	}
-
-	int *rid1;
-	int *rid2;
-	SpinComponent *transformedX1;
-	SpinComponent *transformedY1;
-	SpinComponent *transformedZ1;
-	SpinComponent *transformedX2;
-	SpinComponent *transformedY2;
-	SpinComponent *transformedZ2;
-	int size;
+	LatticeOverlapTable() : offsets(nullptr), rid1(nullptr), rid2(nullptr), transformedX1(nullptr), transformedY1(nullptr), transformedZ1(nullptr), transformedX2(nullptr), transformedY2(nullptr), transformedZ2(nullptr), size(0), entries(0) {}
 
-protected:
 	/**
-	 * @brief Destroy the LatticeOverlap object. 
+	 * @brief  LatticeOverlapTable . 
 	 */
-	~LatticeOverlap()
+	~LatticeOverlapTable()
 	{
+		delete[] offsets;
 		delete[] rid1;
 		delete[] rid2;
 		delete[] transformedX1;
@@ -112,41 +88,65 @@ protected:
 	}
 
 	/**
-	 * @brief Assignment operator. 
+	 * @brief Ϊкصڴ. 
 	 * 
-	 * @param rhs Object to assign. 
-	 * @return LatticeOverlap& Reference to self. 
+	 * @param rows , Ը. 
+	 * @param numberOfEntries еص. 
 	 */
-	LatticeOverlap &operator=(const LatticeOverlap &rhs)
+	void allocate(const int rows, const int numberOfEntries)
 	{
-		size = rhs.size;
-		delete[] rid1;
-		rid1 = new int[size];
-		memcpy(rid1, rhs.rid1, size * sizeof(int));
-		delete[] rid2;
-		rid2 = new int[size];
-		memcpy(rid2, rhs.rid2, size * sizeof(int));
-		delete[] transformedX1;
-		transformedX1 = new SpinComponent[size];
-		memcpy(transformedX1, rhs.transformedX1, size * sizeof(SpinComponent));
-		delete[] transformedY1;
-		transformedY1 = new SpinComponent[size];
-		memcpy(transformedY1, rhs.transformedY1, size * sizeof(SpinComponent));
-		delete[] transformedZ1;
-		transformedZ1 = new SpinComponent[size];
-		memcpy(transformedZ1, rhs.transformedZ1, size * sizeof(SpinComponent));
-		delete[] transformedX2;
-		transformedX2 = new SpinComponent[size];
-		memcpy(transformedX2, rhs.transformedX2, size * sizeof(SpinComponent));
-		delete[] transformedY2;
-		transformedY2 = new SpinComponent[size];
-		memcpy(transformedY2, rhs.transformedY2, size * sizeof(SpinComponent));
-		delete[] transformedZ2;
-		transformedZ2 = new SpinComponent[size];
-		memcpy(transformedZ2, rhs.transformedZ2, size * sizeof(SpinComponent));
+		size = rows;
+		entries = numberOfEntries;
+		offsets = new int[size + 1];
+		rid1 = new int[entries];
+		rid2 = new int[entries];
+		transformedX1 = new SpinComponent[entries];
+		transformedY1 = new SpinComponent[entries];
+		transformedZ1 = new SpinComponent[entries];
+		transformedX2 = new SpinComponent[entries];
+		transformedY2 = new SpinComponent[entries];
+		transformedZ2 = new SpinComponent[entries];
+	}
 
-		return *this;
+	/**
+	 * @brief һеͼ. 
+	 * 
+	 * @param rid Ը. 
+	 * @return LatticeOverlap ص. 
+	 */
+	LatticeOverlap row(const int rid) const
+	{
+		ASSERT(rid < size);
+
+		LatticeOverlap overlap;
+		int offset = offsets[rid];
+		overlap.rid1 = rid1 + offset;
+		overlap.rid2 = rid2 + offset;
+		overlap.transformedX1 = transformedX1 + offset;
+		overlap.transformedY1 = transformedY1 + offset;
+		overlap.transformedZ1 = transformedZ1 + offset;
+		overlap.transformedX2 = transformedX2 + offset;
+		overlap.transformedY2 = transformedY2 + offset;
+		overlap.transformedZ2 = transformedZ2 + offset;
+		overlap.size = offsets[rid + 1] - offset;
+		return overlap;
 	}
+
+	int *offsets; ///< ƫ, Ϊ size + 1. 
+	int *rid1; ///< һ v(i1,j) Ĵ id. 
+	int *rid2; ///< ڶ v(j,i2) Ĵ id. 
+	SpinComponent *transformedX1; ///< һ任 x . 
+	SpinComponent *transformedY1; ///< һ任 y . 
+	SpinComponent *transformedZ1; ///< һ任 z . 
+	SpinComponent *transformedX2; ///< ڶ任 x . 
+	SpinComponent *transformedY2; ///< ڶ任 y . 
+	SpinComponent *transformedZ2; ///< ڶ任 z . 
+	int size; ///< . 
+	int entries; ///< ص. 
+
+private:
+	LatticeOverlapTable(const LatticeOverlapTable &) = delete;
+	LatticeOverlapTable &operator=(const LatticeOverlapTable &) = delete;
 };
 
 /**
@@ -473,6 +473,17 @@ public:
 		return _bufferOverlapMatrices[rid];
 	}
 
+	/**
+	 * @brief дԸľص CSR . 
+	 * @see Lattice::getOverlap()
+	 * 
+	 * @return const LatticeOverlapTable& ص. 
+	 */
+	const LatticeOverlapTable &getOverlapTable() const
+	{
+		return _overlapTable;
+	}
+
 	/**
 	 * @brief ˫б (i2,i1) i1=(0,0,0,0) ǲολ㣬бвολ i2. 
 	 * 
@@ -545,7 +556,8 @@ protected:
 	LatticeSiteDescriptor *_symmetryTable; ///<  (id1, id2) ĶԳԼбԻΪ id1* ݴС+id2洢 id1 ӳ䵽ת. 
 	LatticeSiteDescriptor *_bufferSites; ///< תλб0ridдrid. 
 	LatticeSiteDescriptor *_bufferInvertedSites; ///< תλбrid0дrid. 
-	LatticeOverlap *_bufferOverlapMatrices; ///< صбе i ĿԪ (0,j)(j,i) ص. 
+	LatticeOverlapTable _overlapTable; ///< оص CSR . 
+	LatticeOverlap *_bufferOverlapMatrices; ///< صбе i ĿԪ (0,j)(j,i) ص, Ϊ Lattice::_overlapTable һеͼ. 
 
 	int *_bufferBasis; ///< лվĴ ID б. 
 	int **_bufferLatticeRange; ///< վ㷶Χվ ID б (0,0,0,b). 
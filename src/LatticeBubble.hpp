@@ -0,0 +1,390 @@
+/**
+ * @file LatticeBubble.hpp
+ * @author Finn Lasse Buessen
+ * @brief Gather-multiply kernels for the lattice bubble sum_j v(i1,j) * v(j,i2) of the RPA term.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <array>
+#include <vector>
+#include <complex>
+#include <utility>
+#include <algorithm>
+#include "lib/ValueBundle.hpp"
+#include "lib/ScratchArena.hpp"
+#include "lib/FourierTransform.hpp"
+#include "Lattice.hpp"
+
+/**
+ * @brief Gather-multiply kernels for the lattice bubble of the RPA term.
+ * @details For every representative site rid, the lattice bubble sums products of vertex values at the representative sites rid1[k] and rid2[k] over all entries k of
+ * the corresponding row of the LatticeOverlapTable. The vertex components are stored in separate ValueBundles, such that a naive implementation gathers each component
+ * from a different array. The kernels therefore operate on site-major copies of the vertex values, where all n components of a lattice site are stored contiguously,
+ * and process all components of an entry at once: Each entry costs a single gather of n consecutive values per vertex, and the innermost loop over the components
+ * is contiguous and vectorizable. Each component is accumulated in the order of the overlap entries.
+ *
+ * On Bravais lattices with a single-site basis, componentwise lattice bubbles can alternatively be evaluated in momentum space via LatticeBubble::FourierPlan.
+ */
+namespace LatticeBubble
+{
+	/**
+	 * @brief Allocate a site-major copy of a ValueSuperbundle from a scratch arena.
+	 *
+	 * @tparam n Number of components.
+	 * @param bundles Vertex values, one ValueBundle per component.
+	 * @param arena Scratch arena from which the copy is allocated.
+	 * @return float* Site-major array, where component c of site rid is stored at index n * rid + c.
+	 */
+	template <int n> float *allocateSiteMajor(ValueSuperbundle<float, n> &bundles, ScratchArena &arena)
+	{
+		return static_cast<float *>(arena.allocate(n * bundles.bundle(0).size() * sizeof(float)));
+	}
+
+	/**
+	 * @brief Copy the values of a ValueSuperbundle to a site-major array.
+	 *
+	 * @tparam n Number of components.
+	 * @param bundles Vertex values, one ValueBundle per component.
+	 * @param siteMajor Site-major array, where component c of site rid is stored at index n * rid + c.
+	 */
+	template <int n> void transpose(ValueSuperbundle<float, n> &bundles, float *siteMajor)
+	{
+		const int64_t size = bundles.bundle(0).size();
+		for (int c = 0; c < n; ++c)
+		{
+			const float *values = bundles.bundle(c).data();
+			for (int64_t rid = 0; rid < size; ++rid) siteMajor[n * rid + c] = values[rid];
+		}
+	}
+
+	/**
+	 * @brief Evaluate a lattice bubble with n components. For every representative site rid, the sum over all overlap entries k of the row rid is written to the components of result at rid.
+	 *
+	 * @tparam n Number of components.
+	 * @tparam Terms Callable type void(int rid1, int rid2, int k, float *sum), which adds the contributions of the overlap entry k to the n partial sums.
+	 * @param overlap Lattice overlap table.
+	 * @param terms Contributions of a single overlap entry.
+	 * @param result Lattice bubble, one ValueBundle per component.
+	 */
+	template <int n, class Terms> void evaluate(const LatticeOverlapTable &overlap, const Terms &terms, ValueSuperbundle<float, n> &result)
+	{
+		for (int rid = 0; rid < overlap.size; ++rid)
+		{
+			float sum[n] = {};
+			for (int k = overlap.offsets[rid]; k < overlap.offsets[rid + 1]; ++k) terms(overlap.rid1[k], overlap.rid2[k], k, sum);
+			for (int c = 0; c < n; ++c) result.bundle(c)[rid] = sum[c];
+		}
+	}
+
+	/**
+	 * @brief Evaluate the componentwise lattice bubble result_c(rid) = sum_k a_c(rid1[k]) * b_c(rid2[k]).
+	 *
+	 * @tparam n Number of components.
+	 * @param overlap Lattice overlap table.
+	 * @param a Site-major values of the first vertex.
+	 * @param b Site-major values of the second vertex.
+	 * @param result Lattice bubble, one ValueBundle per component.
+	 */
+	template <int n> void product(const LatticeOverlapTable &overlap, const float *a, const float *b, ValueSuperbundle<float, n> &result)
+	{
+		evaluate<n>(overlap, [a, b](const int rid1, const int rid2, const int, float *sum) -> void
+		{
+			const float *x1 = a + n * rid1;
+			const float *x2 = b + n * rid2;
+			for (int c = 0; c < n; ++c) sum[c] += x1[c] * x2[c];
+		}, result);
+	}
+
+	/**
+	 * @brief Evaluate the lattice bubble of vertices with spin components X, Y, Z and None, where the spin components of each overlap entry are permuted by the lattice symmetry transformation.
+	 * For the spin components mu in {X, Y, Z}, result_mu(rid) = sum_k a_{transformed1[k](mu)}(rid1[k]) * b_{transformed2[k](mu)}(rid2[k]), and the None component is summed without permutation.
+	 *
+	 * @param overlap Lattice overlap table.
+	 * @param a Site-major values of the first vertex, with four components per site.
+	 * @param b Site-major values of the second vertex, with four components per site.
+	 * @param result Lattice bubble, one ValueBundle per spin component.
+	 */
+	inline void productSpinPermuted(const LatticeOverlapTable &overlap, const float *a, const float *b, ValueSuperbundle<float, 4> &result)
+	{
+		evaluate<4>(overlap, [a, b, &overlap](const int rid1, const int rid2, const int k, float *sum) -> void
+		{
+			const float *x1 = a + 4 * rid1;
+			const float *x2 = b + 4 * rid2;
+			sum[static_cast<int>(SpinComponent::X)] += x1[static_cast<int>(overlap.transformedX1[k])] * x2[static_cast<int>(overlap.transformedX2[k])];
+			sum[static_cast<int>(SpinComponent::Y)] += x1[static_cast<int>(overlap.transformedY1[k])] * x2[static_cast<int>(overlap.transformedY2[k])];
+			sum[static_cast<int>(SpinComponent::Z)] += x1[static_cast<int>(overlap.transformedZ1[k])] * x2[static_cast<int>(overlap.transformedZ2[k])];
+			sum[static_cast<int>(SpinComponent::None)] += x1[static_cast<int>(SpinComponent::None)] * x2[static_cast<int>(SpinComponent::None)];
+		}, result);
+	}
+
+	/**
+	 * @brief Evaluation of componentwise lattice bubbles as a convolution in momentum space.
+	 * @details On a Bravais lattice with a single-site basis, the vertex v(j,i2) only depends on the displacement i2 - j, such that the lattice bubble
+	 * result(r) = sum_j a(j) * b(r - j) is a convolution of the two vertices, where both vertices vanish outside of the lattice range. The plan embeds the
+	 * symmetry-reduced vertices on a periodic supercell, which is large enough to avoid aliasing at all sites within range, and evaluates the convolution as
+	 * a pointwise product in momentum space. The cost per component is O(N log N) in the number of supercell sites N, instead of O(M) in the number of overlap entries M,
+	 * which grows as the square of the number of sites within range. Since the direct evaluation only runs over symmetry representatives, and the supercell is padded
+	 * to powers of two, the momentum space evaluation only pays off for large lattice ranges. FourierPlan::isFavorable() compares the estimated cost of both evaluations.
+	 *
+	 * Upon construction, the plan verifies that the convolution reproduces every row of the LatticeOverlapTable. If the lattice has more than one basis site, or if the
+	 * range truncation of the lattice is not reproduced by the convolution, the plan is not applicable and the direct evaluation must be used instead.
+	 */
+	class FourierPlan
+	{
+	public:
+		/**
+		 * @brief Construct a FourierPlan object which is not applicable to any lattice.
+		 */
+		FourierPlan() : _applicable(false), _trivialSpinPermutations(false), _extent({ { 0, 0, 0 } }), _overlapEntries(0) {}
+
+		/**
+		 * @brief Construct a new FourierPlan object for the specified lattice.
+		 *
+		 * @param lattice Lattice.
+		 */
+		FourierPlan(const Lattice &lattice) : FourierPlan()
+		{
+			//the vertex is translation invariant only for a single-site basis
+			int basisSize = 0;
+			for (auto b = lattice.getBasis(); b != lattice.end(); ++b) ++basisSize;
+			if (basisSize != 1) return;
+
+			//collect all sites within range of the reference site and their extent in units of the lattice vectors
+			std::vector<std::array<int, 3>> coordinates;
+			std::array<int, 3> extent = { { 0, 0, 0 } };
+			for (auto j = lattice.getRange(0); j != lattice.end(); ++j)
+			{
+				auto p = lattice.getSiteParameters(j);
+				std::array<int, 3> x = { { std::get<0>(p), std::get<1>(p), std::get<2>(p) } };
+				for (int d = 0; d < 3; ++d) extent[d] = std::max(extent[d], std::abs(x[d]));
+				coordinates.push_back(x);
+				_siteRids.push_back(lattice.symmetryTransform(lattice.zero(), j));
+			}
+
+			//the convolution of two vertices extends over twice the range, such that aliases of sites within range are avoided for supercells with at least 3 * extent + 1 sites
+			std::array<int, 3> dimensions;
+			for (int d = 0; d < 3; ++d) dimensions[d] = FourierTransform::paddedSize(3 * extent[d] + 1);
+			_transform = FourierTransform(dimensions);
+			_extent = extent;
+
+			std::vector<int> grid(_transform.size(), -1);
+			for (size_t i = 0; i < coordinates.size(); ++i)
+			{
+				_siteIndices.push_back(_index(coordinates[i]));
+				grid[_siteIndices.back()] = _siteRids[i];
+			}
+
+			std::vector<std::array<int, 3>> representatives;
+			for (int rid = 0; rid < lattice.size; ++rid)
+			{
+				auto p = lattice.getSiteParameters(lattice.fromParametrization(rid));
+				representatives.push_back({ { std::get<0>(p), std::get<1>(p), std::get<2>(p) } });
+				_representativeIndices.push_back(_index(representatives.back()));
+			}
+
+			_negatedIndices.resize(_transform.size());
+			for (int i = 0; i < _transform.size(); ++i)
+			{
+				std::array<int, 3> x = { { i / (dimensions[1] * dimensions[2]), (i / dimensions[2]) % dimensions[1], i % dimensions[2] } };
+				_negatedIndices[i] = _index({ { -x[0], -x[1], -x[2] } });
+			}
+
+			//verify that the convolution reproduces the lattice overlap of each representative site
+			const LatticeOverlapTable &overlap = lattice.getOverlapTable();
+			_overlapEntries = overlap.entries;
+			_trivialSpinPermutations = true;
+			for (int rid = 0; rid < lattice.size; ++rid)
+			{
+				std::vector<std::pair<int, int>> convolutionTerms;
+				for (size_t i = 0; i < coordinates.size(); ++i)
+				{
+					std::array<int, 3> displacement;
+					bool inRange = true;
+					for (int d = 0; d < 3; ++d)
+					{
+						displacement[d] = representatives[rid][d] - coordinates[i][d];
+						if (std::abs(displacement[d]) > extent[d]) inRange = false;
+					}
+					if (inRange && grid[_index(displacement)] != -1) convolutionTerms.push_back(std::pair<int, int>(_siteRids[i], grid[_index(displacement)]));
+				}
+
+				std::vector<std::pair<int, int>> overlapTerms;
+				for (int k = overlap.offsets[rid]; k < overlap.offsets[rid + 1]; ++k)
+				{
+					overlapTerms.push_back(std::pair<int, int>(overlap.rid1[k], overlap.rid2[k]));
+					if (overlap.transformedX1[k] != SpinComponent::X || overlap.transformedY1[k] != SpinComponent::Y || overlap.transformedZ1[k] != SpinComponent::Z) _trivialSpinPermutations = false;
+					if (overlap.transformedX2[k] != SpinComponent::X || overlap.transformedY2[k] != SpinComponent::Y || overlap.transformedZ2[k] != SpinComponent::Z) _trivialSpinPermutations = false;
+				}
+
+				std::sort(convolutionTerms.begin(), convolutionTerms.end());
+				std::sort(overlapTerms.begin(), overlapTerms.end());
+				if (convolutionTerms != overlapTerms) return;
+			}
+			_applicable = true;
+		}
+
+		/**
+		 * @brief Check whether the lattice bubble can be evaluated in momentum space.
+		 *
+		 * @return bool Returns true if the plan reproduces the lattice overlap of all representative sites.
+		 */
+		bool isApplicable() const
+		{
+			return _applicable;
+		}
+
+		/**
+		 * @brief Check whether the symmetry transformations of all overlap entries leave the spin components invariant. In this case, lattice bubbles of spin-permuted vertices
+		 * as in LatticeBubble::productSpinPermuted() reduce to componentwise lattice bubbles.
+		 *
+		 * @return bool Returns true if all spin permutations are trivial.
+		 */
+		bool hasTrivialSpinPermutations() const
+		{
+			return _trivialSpinPermutations;
+		}
+
+		/**
+		 * @brief Retrieve the extent of the periodic supercell in units of the lattice vectors.
+		 *
+		 * @return const std::array<int, 3>& Extents.
+		 */
+		const std::array<int, 3> &dimensions() const
+		{
+			return _transform.dimensions();
+		}
+
+		/**
+		 * @brief Estimate the cost of the direct evaluation of a componentwise lattice bubble, in units of the evaluation of a single overlap entry with two components.
+		 * @details The cost of an overlap entry is dominated by the gather of the vertex values, such that it only grows slowly with the number of components.
+		 *
+		 * @param n Number of components.
+		 * @return double Estimated cost.
+		 */
+		double directCost(const int n) const
+		{
+			return (0.75 + 0.125 * double(n)) * double(_overlapEntries);
+		}
+
+		/**
+		 * @brief Estimate the cost of the evaluation of a componentwise lattice bubble in momentum space, in units of the evaluation of a single overlap entry with two components.
+		 * @details The cost model counts the butterflies of the pruned transforms and the operations per supercell site of the remaining passes. Its coefficients
+		 * are calibrated against the direct evaluation by benchmark_LatticeBubble.
+		 *
+		 * @param n Number of components.
+		 * @return double Estimated cost.
+		 */
+		double fourierCost(const int n) const
+		{
+			//cost of a butterfly and of the passes over all supercell sites per transform, relative to a single overlap entry; chosen conservatively, such that the direct evaluation is preferred near the crossover
+			const double butterflyCost = 1.5;
+			const double siteCost = 2.0;
+
+			const double transforms = double(n + (n + 1) / 2);
+			return transforms * (butterflyCost * _transform.butterflies(_extent) + siteCost * double(_transform.size()));
+		}
+
+		/**
+		 * @brief Check whether the evaluation in momentum space is applicable and expected to be faster than the direct evaluation.
+		 *
+		 * @param n Number of components.
+		 * @return bool Returns true if the plan is applicable and its estimated cost is below the cost of the direct evaluation.
+		 */
+		bool isFavorable(const int n) const
+		{
+			return _applicable && fourierCost(n) < directCost(n);
+		}
+
+		/**
+		 * @brief Evaluate the componentwise lattice bubble result_c(rid) = sum_k a_c(rid1[k]) * b_c(rid2[k]) in momentum space. The plan must be applicable.
+		 * @details The two real-valued vertices of a component are transformed at once as the real and imaginary part of a single complex field. The real-valued
+		 * convolutions of two components are in turn transformed back at once as the real and imaginary part of a single complex field. The transforms are pruned to the
+		 * sites within range, and the convolution is accumulated in double precision.
+		 *
+		 * @tparam n Number of components.
+		 * @param a Values of the first vertex.
+		 * @param b Values of the second vertex.
+		 * @param result Lattice bubble, one ValueBundle per component.
+		 * @param arena Scratch arena from which the supercell buffers are allocated.
+		 */
+		template <int n> void product(ValueSuperbundle<float, n> &a, ValueSuperbundle<float, n> &b, ValueSuperbundle<float, n> &result, ScratchArena &arena) const
+		{
+			ASSERT(_applicable);
+
+			ScratchArena::Scope scope(arena);
+			const int size = _transform.size();
+			std::complex<double> *fields[2];
+			for (int p = 0; p < 2; ++p) fields[p] = static_cast<std::complex<double> *>(arena.allocate(size * sizeof(std::complex<double>)));
+			std::complex<double> *convolution = static_cast<std::complex<double> *>(arena.allocate(size * sizeof(std::complex<double>)));
+
+			for (int c = 0; c < n; c += 2)
+			{
+				const int pairSize = std::min(2, n - c);
+				for (int p = 0; p < pairSize; ++p)
+				{
+					const float *x1 = a.bundle(c + p).data();
+					const float *x2 = b.bundle(c + p).data();
+					std::fill(fields[p], fields[p] + size, std::complex<double>(0.0, 0.0));
+					for (size_t i = 0; i < _siteIndices.size(); ++i) fields[p][_siteIndices[i]] = std::complex<double>(x1[_siteRids[i]], x2[_siteRids[i]]);
+					_transform.forward(fields[p], _extent);
+				}
+
+				//separate the transforms of the real and imaginary part, A(k) = (F(k) + F(-k)*) / 2 and B(k) = (F(k) - F(-k)*) / 2i, and multiply; the product of the second component is stored in the imaginary part
+				for (int i = 0; i < size; ++i)
+				{
+					double product[2][2] = { { 0.0, 0.0 }, { 0.0, 0.0 } };
+					for (int p = 0; p < pairSize; ++p)
+					{
+						const std::complex<double> f = fields[p][i];
+						const std::complex<double> fNegated = std::conj(fields[p][_negatedIndices[i]]);
+						const double ar = 0.5 * (f.real() + fNegated.real());
+						const double ai = 0.5 * (f.imag() + fNegated.imag());
+						const double br = 0.5 * (f.imag() - fNegated.imag());
+						const double bi = -0.5 * (f.real() - fNegated.real());
+						product[p][0] = ar * br - ai * bi;
+						product[p][1] = ar * bi + ai * br;
+					}
+					convolution[i] = std::complex<double>(product[0][0] - product[1][1], product[0][1] + product[1][0]);
+				}
+				_transform.backward(convolution, _extent);
+
+				float *y1 = result.bundle(c).data();
+				for (size_t rid = 0; rid < _representativeIndices.size(); ++rid) y1[rid] = float(convolution[_representativeIndices[rid]].real());
+				if (pairSize == 2)
+				{
+					float *y2 = result.bundle(c + 1).data();
+					for (size_t rid = 0; rid < _representativeIndices.size(); ++rid) y2[rid] = float(convolution[_representativeIndices[rid]].imag());
+				}
+			}
+		}
+
+	private:
+		/**
+		 * @brief Determine the supercell index of a lattice site.
+		 *
+		 * @param x Coordinates of the lattice site in units of the lattice vectors.
+		 * @return int Linear index of the periodic image of the site in the supercell.
+		 */
+		int _index(const std::array<int, 3> &x) const
+		{
+			const std::array<int, 3> &dimensions = _transform.dimensions();
+			int index = 0;
+			for (int d = 0; d < 3; ++d) index = index * dimensions[d] + ((x[d] % dimensions[d]) + dimensions[d]) % dimensions[d];
+			return index;
+		}
+
+		bool _applicable; ///< True if the plan reproduces the lattice overlap of all representative sites.
+		bool _trivialSpinPermutations; ///< True if the symmetry transformations of all overlap entries leave the spin components invariant.
+		FourierTransform _transform; ///< Fourier transform on the periodic supercell.
+		std::array<int, 3> _extent; ///< Extent of the lattice range in units of the lattice vectors.
+		int64_t _overlapEntries; ///< Number of entries of the lattice overlap table.
+		std::vector<int> _siteIndices; ///< Supercell indices of all sites within range of the reference site.
+		std::vector<int> _siteRids; ///< Representative ids of the vertex between the reference site and each site within range.
+		std::vector<int> _representativeIndices; ///< Supercell indices of all representative sites.
+		std::vector<int> _negatedIndices; ///< Supercell index of the negated momentum of each supercell index.
+	};
+}
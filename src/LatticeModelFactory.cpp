@@ -894,20 +894,18 @@ namespace LatticeModelFactory
 			lattice->_bufferInvertedSites[i] = lattice->_symmetryTable[i * sites.size() + 0];
 		}
 
-		//generate lattice->_bufferOverlapMatrices
-		auto bufferNewOverlapTable = [&](int rid)
+		//generate lattice->_overlapTable and lattice->_bufferOverlapMatrices
+		std::vector<int> overlapOffsets(1, 0);
+		std::vector<int> overlapRid1;
+		std::vector<int> overlapRid2;
+		std::vector<SpinComponent> overlapTX1;
+		std::vector<SpinComponent> overlapTY1;
+		std::vector<SpinComponent> overlapTZ1;
+		std::vector<SpinComponent> overlapTX2;
+		std::vector<SpinComponent> overlapTY2;
+		std::vector<SpinComponent> overlapTZ2;
+		for (int rid = 0; rid < lattice->size; ++rid)
 		{
-			//overlap table buffer
-			std::vector<int> overlapRid1;
-			std::vector<int> overlapRid2;
-			std::vector<SpinComponent> overlapTX1;
-			std::vector<SpinComponent> overlapTY1;
-			std::vector<SpinComponent> overlapTZ1;
-			std::vector<SpinComponent> overlapTX2;
-			std::vector<SpinComponent> overlapTY2;
-			std::vector<SpinComponent> overlapTZ2;
-
-			//generate overlap buffer
 			LatticeSite i1 = sites[0];
 			LatticeSite i2 = sites[rid];
 
@@ -932,21 +930,23 @@ namespace LatticeModelFactory
 				overlapTY2.push_back(t2.spinPermutation[1]);
 				overlapTZ2.push_back(t2.spinPermutation[2]);
 			}
+			overlapOffsets.push_back(int(overlapRid1.size()));
+		}
+
+		LatticeOverlapTable &overlapTable = lattice->_overlapTable;
+		overlapTable.allocate(lattice->size, int(overlapRid1.size()));
+		memcpy(overlapTable.offsets, overlapOffsets.data(), overlapOffsets.size() * sizeof(int));
+		memcpy(overlapTable.rid1, overlapRid1.data(), overlapRid1.size() * sizeof(int));
+		memcpy(overlapTable.rid2, overlapRid2.data(), overlapRid2.size() * sizeof(int));
+		memcpy(overlapTable.transformedX1, overlapTX1.data(), overlapTX1.size() * sizeof(SpinComponent));
+		memcpy(overlapTable.transformedY1, overlapTY1.data(), overlapTY1.size() * sizeof(SpinComponent));
+		memcpy(overlapTable.transformedZ1, overlapTZ1.data(), overlapTZ1.size() * sizeof(SpinComponent));
+		memcpy(overlapTable.transformedX2, overlapTX2.data(), overlapTX2.size() * sizeof(SpinComponent));
+		memcpy(overlapTable.transformedY2, overlapTY2.data(), overlapTY2.size() * sizeof(SpinComponent));
+		memcpy(overlapTable.transformedZ2, overlapTZ2.data(), overlapTZ2.size() * sizeof(SpinComponent));
 
-			LatticeOverlap overlap(int(overlapRid1.size()));
-			memcpy(overlap.rid1, overlapRid1.data(), overlapRid1.size() * sizeof(int));
-			memcpy(overlap.rid2, overlapRid2.data(), overlapRid2.size() * sizeof(int));
-			memcpy(overlap.transformedX1, overlapTX1.data(), overlapTX1.size() * sizeof(SpinComponent));
-			memcpy(overlap.transformedY1, overlapTY1.data(), overlapTY1.size() * sizeof(SpinComponent));
-			memcpy(overlap.transformedZ1, overlapTZ1.data(), overlapTZ1.size() * sizeof(SpinComponent));
-			memcpy(overlap.transformedX2, overlapTX2.data(), overlapTX2.size() * sizeof(SpinComponent));
-			memcpy(overlap.transformedY2, overlapTY2.data(), overlapTY2.size() * sizeof(SpinComponent));
-			memcpy(overlap.transformedZ2, overlapTZ2.data(), overlapTZ2.size() * sizeof(SpinComponent));
-
-			return overlap;
-		};
 		lattice->_bufferOverlapMatrices = new LatticeOverlap[lattice->size];
-		for (int rid = 0; rid < lattice->size; ++rid) lattice->_bufferOverlapMatrices[rid] = bufferNewOverlapTable(rid);
+		for (int rid = 0; rid < lattice->size; ++rid) lattice->_bufferOverlapMatrices[rid] = overlapTable.row(rid);
 
 		//init SpinModel
 		SpinModel* spinModel = new SpinModel();
@@ -0,0 +1,184 @@
+/**
+ * @file PropagatorCache.hpp
+ * @author Finn Lasse Buessen
+ * @brief Tabulated propagator denominators for the frequency integrals of the flow equations and of measurements.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <vector>
+#include <cmath>
+#include "lib/Assert.hpp"
+#include "FrgCommon.hpp"
+
+/**
+ * @brief Cache for the propagator denominators w + Sigma(w) and for the self-energy flow at a fixed cutoff.
+ * @details The self-energy is the single-particle vertex, which is parametrized on the positive frequency mesh and antisymmetric in its frequency argument.
+ * It remains fixed during the calculation of a flow step, such that the cache is built once per step via PropagatorCache::update() and is subsequently read concurrently by all integration kernels.
+ *
+ * Values are tabulated on the frequency mesh, at the cutoff, and at the mesh points shifted by plus or minus the cutoff.
+ * All other frequencies are interpolated exactly like the getValue() method of the single-particle vertices, such that the cached propagators are identical to the uncached ones.
+ */
+class PropagatorCache
+{
+public:
+	/**
+	 * @brief Construct an empty PropagatorCache object. The cache must be populated via PropagatorCache::update() before it is accessed.
+	 */
+	PropagatorCache() : _cutoff(NAN), _denominatorCutoff(NAN), _selfEnergyFlowCutoff(NAN) {}
+
+	/**
+	 * @brief Rebuild the cache for the specified cutoff and self-energy on the current frequency mesh.
+	 * Must be called whenever the cutoff or the self-energy has changed, and must not be called while the cache is read by other threads.
+	 *
+	 * @param cutoff Frequency cutoff.
+	 * @param selfEnergy Self-energy values on the positive frequency mesh.
+	 * @param selfEnergyFlow Self-energy flow values on the positive frequency mesh.
+	 */
+	void update(const float cutoff, const float *selfEnergy, const float *selfEnergyFlow)
+	{
+		const int size = FrgCommon::frequency().size;
+		const float *frequency = FrgCommon::frequency()._data;
+
+		_cutoff = cutoff;
+		_selfEnergy.assign(selfEnergy, selfEnergy + size);
+		_selfEnergyFlow.assign(selfEnergyFlow, selfEnergyFlow + size);
+
+		_denominator.resize(size);
+		for (int i = 0; i < size; ++i) _denominator[i] = frequency[i] + _selfEnergy[i];
+
+		_denominatorShifted.resize(2 * size);
+		for (int i = 0; i < size; ++i)
+		{
+			_denominatorShifted[2 * i] = _interpolateDenominator(cutoff + frequency[i]);
+			_denominatorShifted[2 * i + 1] = _interpolateDenominator(cutoff - frequency[i]);
+		}
+		_denominatorCutoff = _interpolateDenominator(cutoff);
+		_selfEnergyFlowCutoff = _interpolate(_selfEnergyFlow, cutoff);
+	}
+
+	/**
+	 * @brief Retrieve the cutoff for which the cache has been built.
+	 *
+	 * @return float Frequency cutoff.
+	 */
+	float cutoff() const
+	{
+		return _cutoff;
+	}
+
+	/**
+	 * @brief Retrieve the propagator denominator w + Sigma(w) at an arbitrary frequency.
+	 *
+	 * @param w Frequency argument.
+	 * @return float Propagator denominator.
+	 */
+	float denominator(const float w) const
+	{
+		if (w == _cutoff) return _denominatorCutoff;
+		return _interpolateDenominator(w);
+	}
+
+	/**
+	 * @brief Retrieve the self-energy flow at an arbitrary frequency.
+	 *
+	 * @param w Frequency argument.
+	 * @return float Self-energy flow.
+	 */
+	float selfEnergyFlow(const float w) const
+	{
+		if (w == _cutoff) return _selfEnergyFlowCutoff;
+		return _interpolate(_selfEnergyFlow, w);
+	}
+
+	/**
+	 * @brief Retrieve the propagator bubble 1 / ((w1 + Sigma(w1)) * (w2 + Sigma(w2))).
+	 *
+	 * @param w1 First frequency argument.
+	 * @param w2 Second frequency argument.
+	 * @return float Propagator bubble.
+	 */
+	float propagator(const float w1, const float w2) const
+	{
+		return 1.0f / (denominator(w1) * denominator(w2));
+	}
+
+	/**
+	 * @brief Retrieve the propagator bubble at the cutoff, i.e. PropagatorCache::propagator(cutoff, cutoff + w), where w is a positive or negative frequency mesh point.
+	 *
+	 * @param w Frequency shift. Falls back to interpolation if the shift is not a mesh point.
+	 * @return float Propagator bubble.
+	 */
+	float propagatorCutoff(const float w) const
+	{
+		float absW = (w < 0) ? -w : w;
+		int offset = FrgCommon::frequency().offset(absW);
+		if (FrgCommon::frequency()._data[offset] != absW) return propagator(_cutoff, _cutoff + w);
+
+		return 1.0f / (_denominatorCutoff * _denominatorShifted[2 * offset + ((w < 0) ? 1 : 0)]);
+	}
+
+	/**
+	 * @brief Retrieve the Katanin contribution to the single-scale propagator bubble, dSigma(w1) / ((w1 + Sigma(w1))^2 * (w2 + Sigma(w2))).
+	 *
+	 * @param w1 First frequency argument.
+	 * @param w2 Second frequency argument.
+	 * @return float Katanin contribution.
+	 */
+	float kataninPropagator(const float w1, const float w2) const
+	{
+		float denominatorW1 = denominator(w1);
+		return selfEnergyFlow(w1) / (denominatorW1 * denominatorW1 * denominator(w2));
+	}
+
+private:
+	/**
+	 * @brief Interpolate an antisymmetric function, which is parametrized on the positive frequency mesh, at an arbitrary frequency.
+	 *
+	 * @param values Function values on the positive frequency mesh.
+	 * @param w Frequency argument.
+	 * @return float Interpolated value.
+	 */
+	float _interpolate(const std::vector<float> &values, float w) const
+	{
+		int lower, upper;
+		float bias;
+		float sign = 1.0f;
+
+		if (w < 0)
+		{
+			w = -w;
+			sign = -1.0f;
+		}
+
+		FrgCommon::frequency().interpolateOffset(w, lower, upper, bias);
+		return sign * ((1 - bias) * values[lower] + bias * values[upper]);
+	}
+
+	/**
+	 * @brief Calculate the propagator denominator w + Sigma(w) at an arbitrary frequency, using the tabulated values on mesh points.
+	 *
+	 * @param w Frequency argument.
+	 * @return float Propagator denominator.
+	 */
+	float _interpolateDenominator(const float w) const
+	{
+		int lower, upper;
+		float bias;
+		float absW = (w < 0) ? -w : w;
+		float sign = (w < 0) ? -1.0f : 1.0f;
+
+		FrgCommon::frequency().interpolateOffset(absW, lower, upper, bias);
+		if (bias == 0.0f && absW == FrgCommon::frequency()._data[lower]) return sign * _denominator[lower];
+		return w + sign * ((1 - bias) * _selfEnergy[lower] + bias * _selfEnergy[upper]);
+	}
+
+	float _cutoff; ///< Cutoff for which the cache has been built.
+	float _denominatorCutoff; ///< Propagator denominator at the cutoff.
+	float _selfEnergyFlowCutoff; ///< Self-energy flow at the cutoff.
+	std::vector<float> _selfEnergy; ///< Self-energy on the positive frequency mesh.
+	std::vector<float> _selfEnergyFlow; ///< Self-energy flow on the positive frequency mesh.
+	std::vector<float> _denominator; ///< Propagator denominators on the positive frequency mesh.
+	std::vector<float> _denominatorShifted; ///< Propagator denominators at the positive frequency mesh points shifted by plus (even entries) or minus (odd entries) the cutoff.
+};
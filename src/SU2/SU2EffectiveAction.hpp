@@ -7,6 +7,8 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <vector>
 #include "lib/Exception.hpp"
 #include "EffectiveAction.hpp"
 #include "SU2FrgCore.hpp"
@@ -21,11 +23,16 @@ struct SU2EffectiveAction : public EffectiveAction
 public:
 	/**
 	 * @brief һµ SU2Effective Action . 
+	 * 
+	 * @param distribution Ӷ MPI ̼Ĵ洢ʽ.  SU2VertexTwoParticle::Distribution::Replicated ,캯 MPI ϼ. 
+	 * @param cacheSize ֲʽ洢ʱԶƵ. 
+	 * @param format ӶĴ洢ʽ. 
 	 */
-	SU2EffectiveAction()
+	SU2EffectiveAction(const SU2VertexTwoParticle::Distribution distribution = SU2VertexTwoParticle::Distribution::Replicated, const int cacheSize = 0, const FloatFormat format = FloatFormat::Float32)
 	{
+		vertexFormat = format;
 		vertexSingleParticle = new SU2VertexSingleParticle;
-		vertexTwoParticle = new SU2VertexTwoParticle;
+		vertexTwoParticle = new SU2VertexTwoParticle(distribution, cacheSize, format);
 	}
 
 	/**
@@ -37,30 +44,34 @@ public:
 	 */
 	SU2EffectiveAction(const float cutoff, const SpinModel &spinModel, const SU2FrgCore *core)
 	{
+		vertexFormat = core->vertexFormat;
 		vertexSingleParticle = new SU2VertexSingleParticle;
-		vertexTwoParticle = new SU2VertexTwoParticle;
+		vertexTwoParticle = new SU2VertexTwoParticle(core->vertexDistribution, core->vertexCacheSize, core->vertexFormat);
 
-		//óʼֵ
+		//óʼֵ(ֲʽڵ㹲洢ʱñؿ޸ĵĲ)
+		//ʼֵƵ޹,˶ÿƵֱֵд໥ڵĸ,չÿԵ
 		this->cutoff = cutoff;
 
-		for (int linearIterator = 0; linearIterator < vertexTwoParticle->size; ++linearIterator)
+		int latticeSize = FrgCommon::lattice().size;
+		int64_t localBegin = vertexTwoParticle->offsetLocal;
+		int64_t localEnd = vertexTwoParticle->offsetLocal + vertexTwoParticle->sizeLocal;
+		for (int64_t frequencyIterator = localBegin / latticeSize; frequencyIterator * latticeSize < localEnd; ++frequencyIterator)
 		{
-			float s, t, u;
-			LatticeIterator i1;
-			vertexTwoParticle->expandIterator(linearIterator, i1, s, t, u);
-
 			for (auto i : spinModel.interactions)
 			{
-				if (i.first == i1)
-				{
-					vertexTwoParticle->getValueRef(linearIterator, SU2VertexTwoParticle::Symmetry::Spin) += i.second.interactionStrength[0][0] / core->normalization;
-				}
+				int rid = i.first - FrgCommon::lattice().begin();
+				if (rid < 0 || rid >= latticeSize) continue;
+
+				int64_t linearIterator = frequencyIterator * latticeSize + rid;
+				if (linearIterator < localBegin || linearIterator >= localEnd) continue;
+				vertexTwoParticle->getValueRef(linearIterator, SU2VertexTwoParticle::Symmetry::Spin) += i.second.interactionStrength[0][0] / core->normalization;
 			}
 		}
+		vertexTwoParticle->synchronize();
 	}
 
 	/**
-	 * @brief  SU2Effective Action . 
+	 * @brief  SU2Effective Action . ֲʽڵ㹲洢ʱ MPI ϼ. 
 	 */
 	~SU2EffectiveAction()
 	{
@@ -70,6 +81,7 @@ public:
 
 	/**
 	 * @brief дļ. 
+	 * @details ֲʽ洢ʱ,ӶԶֱֿ̲ȡд, MPI ڴڼ䲻޸Ķ. 
 	 * 
 	 * @param dataFilePath ļ·. 
 	 * @param append ӱ־. 
@@ -128,20 +140,63 @@ public:
 		H5Sclose(attrSpace);
 
 		//д붥
-		auto writeCheckpointDataset = [&group](const std::string &identifier, const int size, const float *data)
+		auto writeCheckpointDataset = [&group](const std::string &identifier, const int64_t size, const void *data, const hid_t memoryType, const hid_t fileType)
 		{
 			const int dataSpaceDim = 1;
 			const hsize_t dataSpaceSize[1] = { (hsize_t)size };
 			hid_t dataSpace = H5Screate_simple(dataSpaceDim, dataSpaceSize, NULL);
-			hid_t dataset = H5Dcreate(group, identifier.c_str(), H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-			H5Dwrite(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			hid_t dataset = H5Dcreate(group, identifier.c_str(), fileType, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+			H5Dwrite(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			H5Dclose(dataset);
+			H5Sclose(dataSpace);
+		};
+		auto writeVertexCheckpointDataset = [&writeCheckpointDataset](const std::string &identifier, const FloatArray &data, const hid_t fileType)
+		{
+			//մ洢Ķ洢ʽֱд
+			hid_t memoryType = checkpointDatatype(data.format());
+			if (data.isCompact()) writeCheckpointDataset(identifier, data.size(), data.compactData(), memoryType, fileType);
+			else writeCheckpointDataset(identifier, data.size(), data.data(), memoryType, fileType);
+			H5Tclose(memoryType);
+		};
+		auto writeShardedCheckpointDataset = [&group](const std::string &identifier, const ShardedArray *data, const hid_t fileType)
+		{
+			const int dataSpaceDim = 1;
+			const hsize_t dataSpaceSize[1] = { (hsize_t)(data->lineCount() * data->lineSize()) };
+			hid_t dataSpace = H5Screate_simple(dataSpaceDim, dataSpaceSize, NULL);
+			hid_t dataset = H5Dcreate(group, identifier.c_str(), fileType, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+			//ֿд,ÿ blockLines Ƶ
+			const int64_t blockLines = std::max<int64_t>(1, (int64_t(1) << 24) / data->lineSize());
+			std::vector<float> buffer(std::min(blockLines, data->lineCount()) * data->lineSize());
+			for (int64_t line = 0; line < data->lineCount(); line += blockLines)
+			{
+				const hsize_t blockOffset[1] = { (hsize_t)(line * data->lineSize()) };
+				const hsize_t blockSize[1] = { (hsize_t)(std::min(blockLines, data->lineCount() - line) * data->lineSize()) };
+				data->read(line * data->lineSize(), blockSize[0], buffer.data());
+				hid_t blockSpace = H5Screate_simple(dataSpaceDim, blockSize, NULL);
+				H5Sselect_hyperslab(dataSpace, H5S_SELECT_SET, blockOffset, NULL, blockSize, NULL);
+				H5Dwrite(dataset, H5T_NATIVE_FLOAT, blockSpace, dataSpace, H5P_DEFAULT, buffer.data());
+				H5Sclose(blockSpace);
+			}
+
 			H5Dclose(dataset);
 			H5Sclose(dataSpace);
 		};
-		writeCheckpointDataset("cutoff", 1, &cutoff);
-		writeCheckpointDataset("v2", vertexSingleParticle->size, vertexSingleParticle->_data);
-		writeCheckpointDataset("v4dd", vertexTwoParticle->size, vertexTwoParticle->_dataDD);
-		writeCheckpointDataset("v4ss", vertexTwoParticle->size, vertexTwoParticle->_dataSS);
+		hid_t vertexType = checkpointDatatype(vertexFormat);
+		writeCheckpointDataset("cutoff", 1, &cutoff, H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT);
+		writeCheckpointDataset("v2", vertexSingleParticle->size, vertexSingleParticle->_data, H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT);
+		if (vertexTwoParticle->isSharded())
+		{
+			writeShardedCheckpointDataset("v4dd", vertexTwoParticle->_shardDD, vertexType);
+			writeShardedCheckpointDataset("v4ss", vertexTwoParticle->_shardSS, vertexType);
+		}
+		else
+		{
+			writeVertexCheckpointDataset("v4dd", vertexTwoParticle->_dataDD, vertexType);
+			writeVertexCheckpointDataset("v4ss", vertexTwoParticle->_dataSS, vertexType);
+		}
+		H5Tclose(vertexType);
+		writeFrequencyMesh(group);
 
 		//
 		H5Gclose(group);
@@ -151,6 +206,7 @@ public:
 
 	/**
 	 * @brief ļжȡ. 
+	 * @details ֲʽ洢ʱ,ÿ MPI ֻȡӶıز;ڵ㹲洢ʱ,ֻÿڵͽ̶ȡӶ. ʱнϼ. 
 	 * 
 	 * @param dataFilePath ļ·. 
 	 * @param checkpointId Ҫȡļıʶ. 
@@ -184,19 +240,65 @@ public:
 		hid_t group = H5Gopen(file, checkpointName.c_str(), H5P_DEFAULT);
 		if (group < 0) return false;
 
+		//ڲͬԭƵ,ֵǰ
+		std::vector<float> mesh = readFrequencyMesh(group);
+		if (!isCurrentFrequencyMesh(mesh))
+		{
+			H5Gclose(group);
+			H5Fclose(file);
+			return readRegriddedCheckpoint<SU2EffectiveAction>(dataFilePath, checkpointId, mesh);
+		}
+
 		//ȡݼ
-		auto readDataset = [&group](const std::string &name, float *data)->bool
+		auto readDataset = [&group](const std::string &name, void *data, const hid_t memoryType)->bool
 		{
 			hid_t dataset = H5Dopen(group, name.c_str(), H5P_DEFAULT);
 			if (dataset < 0) return false;
-			H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			H5Dread(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			H5Dclose(dataset);
+			return true;
+		};
+		auto readVertexDataset = [&readDataset](const std::string &name, const FloatArray &data)->bool
+		{
+			//մ洢ʱ HDF5 ݼתΪĴ洢ʽ
+			hid_t memoryType = checkpointDatatype(data.format());
+			bool success = (data.isCompact()) ? readDataset(name, data.compactData(), memoryType) : readDataset(name, data.data(), memoryType);
+			H5Tclose(memoryType);
+			return success;
+		};
+		auto readLocalDataset = [&group](const std::string &name, float *data, const int64_t offset, const int64_t size)->bool
+		{
+			hid_t dataset = H5Dopen(group, name.c_str(), H5P_DEFAULT);
+			if (dataset < 0) return false;
+			if (size > 0)
+			{
+				hid_t dataSpace = H5Dget_space(dataset);
+				const hsize_t localOffset[1] = { (hsize_t)offset };
+				const hsize_t localSize[1] = { (hsize_t)size };
+				hid_t localSpace = H5Screate_simple(1, localSize, NULL);
+				H5Sselect_hyperslab(dataSpace, H5S_SELECT_SET, localOffset, NULL, localSize, NULL);
+				H5Dread(dataset, H5T_NATIVE_FLOAT, localSpace, dataSpace, H5P_DEFAULT, data);
+				H5Sclose(localSpace);
+				H5Sclose(dataSpace);
+			}
 			H5Dclose(dataset);
 			return true;
 		};
-		if (!readDataset("cutoff", &cutoff)) return false;
-		if (!readDataset("v2", vertexSingleParticle->_data)) return false;
-		if (!readDataset("v4dd", vertexTwoParticle->_dataDD)) return false;
-		if (!readDataset("v4ss", vertexTwoParticle->_dataSS)) return false;
+		if (!readDataset("cutoff", &cutoff, H5T_NATIVE_FLOAT)) return false;
+		if (!readDataset("v2", vertexSingleParticle->_data, H5T_NATIVE_FLOAT)) return false;
+		if (vertexTwoParticle->isSharded() || vertexTwoParticle->isNodeShared())
+		{
+			//̿ڶȡض
+			vertexTwoParticle->synchronize();
+			bool success = readLocalDataset("v4dd", vertexTwoParticle->_dataDD.data(), vertexTwoParticle->offsetLocal, vertexTwoParticle->sizeLocal) && readLocalDataset("v4ss", vertexTwoParticle->_dataSS.data(), vertexTwoParticle->offsetLocal, vertexTwoParticle->sizeLocal);
+			vertexTwoParticle->synchronize();
+			if (!success) return false;
+		}
+		else
+		{
+			if (!readVertexDataset("v4dd", vertexTwoParticle->_dataDD)) return false;
+			if (!readVertexDataset("v4ss", vertexTwoParticle->_dataSS)) return false;
+		}
 
 		//
 		H5Gclose(group);
@@ -205,28 +307,81 @@ public:
 	}
 
 	/**
-	 * @brief ָʾǷѾɢ Na N. 
+	 * @brief жб. ֲʽڵ㹲洢ʱӶıؿ޸Ĳ. 
 	 *
-	 * @return bool ѷɢ򷵻 true򷵻 false. 
+	 * @return std::vector<FloatArray> б. 
 	 */
-	bool isDiverged() const override
+	std::vector<FloatArray> getDataBundles() const override
 	{
-		for (int i = 0; i < vertexSingleParticle->size; ++i)
-		{
-			if (std::isnan(vertexSingleParticle->getValueRef(i))) return true;
-		}
+		return {
+			FloatArray(vertexSingleParticle->_data, vertexSingleParticle->size),
+			vertexTwoParticle->_dataDD.subarray(0, vertexTwoParticle->sizeLocal),
+			vertexTwoParticle->_dataSS.subarray(0, vertexTwoParticle->sizeLocal)
+		};
+	}
 
-		for (int i = 0; i < vertexTwoParticle->size; ++i)
-		{
-			if (std::isnan(vertexTwoParticle->getValueRef(i, SU2VertexTwoParticle::Symmetry::Spin))) return true;
-		}
+	/**
+	 * @brief ָʾӶǷֲ MPI . 
+	 *
+	 * @return bool ӶΪֲʽ洢,򷵻 true,򷵻 false. 
+	 */
+	bool isSharded() const override
+	{
+		return vertexTwoParticle->isSharded();
+	}
 
-		for (int i = 0; i < vertexTwoParticle->size; ++i)
+	/**
+	 * @brief ָʾӶǷͬһڵϵ MPI ̹. 
+	 *
+	 * @return bool ӶΪڵ㹲洢,򷵻 true,򷵻 false. 
+	 */
+	bool isNodeShared() const override
+	{
+		return vertexTwoParticle->isNodeShared();
+	}
+
+	/**
+	 * @brief ֵͨһƵϵЧתƵǰƵ. 
+	 * @details ֵͨ SU2VertexSingleParticle::getValue()  SU2VertexTwoParticle::getValue() Դϲֵõ. 
+	 * ֲʽڵ㹲洢ʱÿ MPI ֵֻӶıؿ޸Ĳ,ʱнϼ. 
+	 * 
+	 * @param source ԴЧ, SU2EffectiveAction. 
+	 * @param sourceFrequency ԴЧڵԭƵɢ. 
+	 */
+	void regrid(const EffectiveAction &source, FrequencyDiscretization &sourceFrequency) override
+	{
+		const SU2EffectiveAction &sourceAction = static_cast<const SU2EffectiveAction &>(source);
+		cutoff = source.cutoff;
+
+		//ĿչƵʲ
+		std::vector<float> w(vertexSingleParticle->size);
+		for (int i = 0; i < vertexSingleParticle->size; ++i) vertexSingleParticle->expandIterator(i, w[i]);
+
+		std::vector<float> s(vertexTwoParticle->sizeFrequency), t(vertexTwoParticle->sizeFrequency), u(vertexTwoParticle->sizeFrequency);
+		vertexTwoParticle->expandIterators(0, vertexTwoParticle->sizeFrequency, s.data(), t.data(), u.data());
+
+		//Դϲֵ
+		FrequencyScope scope(sourceFrequency);
+		for (int i = 0; i < vertexSingleParticle->size; ++i) vertexSingleParticle->getValueRef(i) = sourceAction.vertexSingleParticle->getValue(w[i]);
+
+		int latticeSize = FrgCommon::lattice().size;
+		int64_t localBegin = vertexTwoParticle->offsetLocal / latticeSize;
+		int64_t localEnd = (vertexTwoParticle->offsetLocal + vertexTwoParticle->sizeLocal) / latticeSize;
+		sourceAction.vertexTwoParticle->synchronize();
+		vertexTwoParticle->synchronize();
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(dynamic)
+		#endif
+		for (int64_t i = localBegin; i < localEnd; ++i)
 		{
-			if (std::isnan(vertexTwoParticle->getValueRef(i, SU2VertexTwoParticle::Symmetry::Density))) return true;
+			for (int j = 0; j < latticeSize; ++j)
+			{
+				LatticeIterator i1 = FrgCommon::lattice().fromParametrization(j);
+				vertexTwoParticle->getValueRef(i * latticeSize + j, SU2VertexTwoParticle::Symmetry::Spin) = sourceAction.vertexTwoParticle->getValue(i1, FrgCommon::lattice().zero(), s[i], t[i], u[i], SU2VertexTwoParticle::Symmetry::Spin, SU2VertexTwoParticle::FrequencyChannel::None);
+				vertexTwoParticle->getValueRef(i * latticeSize + j, SU2VertexTwoParticle::Symmetry::Density) = sourceAction.vertexTwoParticle->getValue(i1, FrgCommon::lattice().zero(), s[i], t[i], u[i], SU2VertexTwoParticle::Symmetry::Density, SU2VertexTwoParticle::FrequencyChannel::None);
+			}
 		}
-
-		return false;
+		vertexTwoParticle->synchronize();
 	}
 
 	SU2VertexSingleParticle *vertexSingleParticle; ///< Ӷ. 
@@ -11,29 +11,97 @@
 #include "lib/InputParser.hpp"
 #include "lib/Integrator.hpp"
 #include "SpinParser.hpp"
+#include "AccessBufferTable.hpp"
+#include "LatticeBubble.hpp"
 #include "SU2FrgCore.hpp"
 #include "SU2EffectiveAction.hpp"
 
+#ifndef DISABLE_MPI
+#include "mpi.h"
+#endif
+
 SU2FrgCore::SU2FrgCore(const SpinModel &spinModel, const std::vector<Measurement *> &measurements, const std::map<std::string, std::string> &options) : FrgCore(measurements)
 {
 	//ʼѡ
 	spinLength = 0.5;
 	normalization = NAN;
+	vertexFormat = FloatFormat::Float32;
+	vertexDistribution = SU2VertexTwoParticle::Distribution::Replicated;
+	vertexCacheSize = 4096;
+	bool exchangedVertexCopy = false;
+	bool momentumSpaceBubble = false;
 
 	for (auto option : options)
 	{
 		if (option.first == "spin") spinLength = InputParser::stringToFloat(option.second);
 		else if (option.first == "normalization") normalization = InputParser::stringToFloat(option.second);
+		else if (option.first == "precision") vertexFormat = FloatCodec::parse(option.second);
+		else if (option.first == "distribution")
+		{
+			if (option.second == "replicated") vertexDistribution = SU2VertexTwoParticle::Distribution::Replicated;
+			else if (option.second == "sharded") vertexDistribution = SU2VertexTwoParticle::Distribution::Sharded;
+			else if (option.second == "shared") vertexDistribution = SU2VertexTwoParticle::Distribution::NodeShared;
+			else throw Exception(Exception::Type::InitializationError, "Unknown vertex distribution '" + option.second + "'.");
+		}
+		else if (option.first == "cache")
+		{
+			vertexCacheSize = InputParser::stringToInt(option.second);
+			if (vertexCacheSize < 0) throw Exception(Exception::Type::InitializationError, "Vertex cache size must not be negative.");
+		}
+		else if (option.first == "bubble")
+		{
+			if (option.second == "direct") momentumSpaceBubble = false;
+			else if (option.second == "fft") momentumSpaceBubble = true;
+			else throw Exception(Exception::Type::InitializationError, "Unknown lattice bubble evaluation '" + option.second + "'.");
+		}
+		else if (option.first == "exchange")
+		{
+			if (option.second == "gather") exchangedVertexCopy = false;
+			else if (option.second == "copy") exchangedVertexCopy = true;
+			else throw Exception(Exception::Type::InitializationError, "Unknown site exchange evaluation '" + option.second + "'.");
+		}
 		else throw Exception(Exception::Type::InitializationError, "Unknown spin model option '" + option.first + "'.");
 	}
 	if (std::isnan(normalization)) normalization = 2.0f * spinLength;
+	if (exchangedVertexCopy && vertexDistribution != SU2VertexTwoParticle::Distribution::Replicated) throw Exception(Exception::Type::InitializationError, "Site-exchanged vertex copy requires replicated vertex distribution.");
 
 	Log::log << Log::LogLevel::Info << "FRG core spin length S is set to " << spinLength << "." << Log::endl;
 	Log::log << Log::LogLevel::Info << "FRG core energy normalization is set to " << normalization << "." << Log::endl;
+	Log::log << Log::LogLevel::Info << "FRG core vertex storage precision is set to " << FloatCodec::name(vertexFormat) << "." << Log::endl;
+	if (vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded) Log::log << Log::LogLevel::Info << "FRG core two-particle vertex is sharded across MPI ranks with a cache of " << vertexCacheSize << " remote frequency lines." << Log::endl;
+	else if (vertexDistribution == SU2VertexTwoParticle::Distribution::NodeShared) Log::log << Log::LogLevel::Info << "FRG core two-particle vertex is shared by all MPI ranks on the same node." << Log::endl;
+
+	//ڶռм㾧;ڵǰƿֱʱ˵ֱ
+	if (momentumSpaceBubble)
+	{
+		bubblePlan = LatticeBubble::FourierPlan(FrgCommon::lattice());
+		if (!bubblePlan.isApplicable()) Log::log << Log::LogLevel::Warning << "Lattice bubble cannot be evaluated in momentum space on this lattice. Falling back to direct summation." << Log::endl;
+		else if (!bubblePlan.isFavorable(2))
+		{
+			Log::log << Log::LogLevel::Info << "FRG core lattice bubble is evaluated by direct summation, which is estimated to be faster than the evaluation in momentum space on this lattice." << Log::endl;
+			bubblePlan = LatticeBubble::FourierPlan();
+		}
+		else Log::log << Log::LogLevel::Info << "FRG core lattice bubble is evaluated in momentum space on a periodic supercell of " << bubblePlan.dimensions()[0] << "x" << bubblePlan.dimensions()[1] << "x" << bubblePlan.dimensions()[2] << " unit cells." << Log::endl;
+	}
+
+	//ֲʽܱ LoadManager ıع̺߳߳ͬʱ
+	#ifndef DISABLE_MPI
+	int threadSupport;
+	MPI_Query_thread(&threadSupport);
+	if (vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded && threadSupport != MPI_THREAD_MULTIPLE) throw Exception(Exception::Type::InitializationError, "Sharded vertex distribution requires MPI_THREAD_MULTIPLE support.");
+	#endif
 
 	//init data
 	_flowingFunctional = new SU2EffectiveAction(*FrgCommon::cutoff().begin(), spinModel, this);
-	_flow = new SU2EffectiveAction();
+	//ڵ㹲洢ʱ,̼Ȼ˽е
+	_flow = new SU2EffectiveAction((vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded) ? SU2VertexTwoParticle::Distribution::Sharded : SU2VertexTwoParticle::Distribution::Replicated, vertexCacheSize);
+
+	//λ㽻Ķ㸱ÿ迪ʼʱһ,ʹλ㽻ʱҲȡ
+	if (exchangedVertexCopy)
+	{
+		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->enableExchangedCopy();
+		Log::log << Log::LogLevel::Info << "FRG core two-particle vertex keeps a contiguous site-exchanged copy." << Log::endl;
+	}
 
 	//init loadManager
 	//stack0
@@ -44,14 +112,38 @@ SU2FrgCore::SU2FrgCore(const SpinModel &spinModel, const std::vector<Measurement
 	dataStacks[1] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
 		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexSingleParticle->_data,
 		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexSingleParticle->size);
-	//stack2
-	dataStacks[2] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
-		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataDD,
-		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size);
-	//stack3
-	dataStacks[3] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
-		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataSS,
-		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size);
+	//ֲʽ洢ʱӶ㲻 LoadManager (stack2, stack3, stack6, stack7);ڵ㹲洢ʱֻ㲥ÿڵͽ
+	bool shardedVertex = (vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded);
+	bool nodeSharedVertex = (vertexDistribution == SU2VertexTwoParticle::Distribution::NodeShared);
+	dataStacks[2] = dataStacks[3] = dataStacks[6] = dataStacks[7] = -1;
+	//մ洢Ӷֱ洢ʽ㲥
+	SU2VertexTwoParticle *v4 = static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle;
+	if (!shardedVertex && v4->_dataDD.isCompact())
+	{
+		//stack2
+		dataStacks[2] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<uint16_t>(
+			v4->_dataDD.compactData(),
+			v4->size);
+		//stack3
+		dataStacks[3] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<uint16_t>(
+			v4->_dataSS.compactData(),
+			v4->size);
+	}
+	else if (!shardedVertex)
+	{
+		//stack2
+		dataStacks[2] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
+			v4->_dataDD.data(),
+			v4->size,
+			_flowingFunctional->vertexFormat,
+			nodeSharedVertex);
+		//stack3
+		dataStacks[3] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
+			v4->_dataSS.data(),
+			v4->size,
+			_flowingFunctional->vertexFormat,
+			nodeSharedVertex);
+	}
 	//stack4
 	dataStacks[4] = SpinParser::spinParser()->getLoadManager()->addMasterStackImplicit<float>(
 		&_flow->cutoff,
@@ -65,23 +157,32 @@ SU2FrgCore::SU2FrgCore(const SpinModel &spinModel, const std::vector<Measurement
 		1,
 		1,
 		1);
-	//stack6
-	dataStacks[6] = SpinParser::spinParser()->getLoadManager()->addMasterStackImplicit<float>(
-		static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataDD,
-		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->sizeFrequency,
-		[&](int x) { _calculateVertexTwoParticle(x); },
-		FrgCommon::lattice().size,
-		FrgCommon::frequency().size);
-	//stack7
-	dataStacks[7] = SpinParser::spinParser()->getLoadManager()->addSlaveStack<float>(
-		static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataSS,
-		static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->sizeFrequency,
-		dataStacks[6],
-		FrgCommon::lattice().size);
+	if (!shardedVertex)
+	{
+		//stack6
+		dataStacks[6] = SpinParser::spinParser()->getLoadManager()->addMasterStackImplicit<float>(
+			static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataDD.data(),
+			static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->sizeFrequency,
+			[&](int64_t x) { _calculateVertexTwoParticle(x); },
+			FrgCommon::lattice().size,
+			FrgCommon::frequency().size);
+		//stack7
+		dataStacks[7] = SpinParser::spinParser()->getLoadManager()->addSlaveStack<float>(
+			static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataSS.data(),
+			static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->sizeFrequency,
+			dataStacks[6],
+			FrgCommon::lattice().size);
+		//ӶļʱǿƵʲ,ڲ֮仯,˸һļʱ仮ֵȴ۵Ŀ
+		SpinParser::spinParser()->getLoadManager()->enableCostLearning(dataStacks[6]);
+		//ڲ֮䱣ӶԪصMPI̵ķ,ڸزʱǨ
+		SpinParser::spinParser()->getLoadManager()->enableAffinity(dataStacks[6]);
+	}
 }
 
 SU2FrgCore::~SU2FrgCore()
 {
+	//ͷñĵջ,ջջһͬͷ
+	for (int i = 0; i < 8; ++i) if (dataStacks[i] >= 0) SpinParser::spinParser()->getLoadManager()->releaseStack(dataStacks[i]);
 	delete _flowingFunctional;
 	delete _flow;
 }
@@ -94,6 +195,10 @@ void SU2FrgCore::computeStep()
 	// 1 Ӷ㲢㲥Katanin 裩
 	SpinParser::spinParser()->getLoadManager()->calculate(dataStacks[5]);
 	SpinParser::spinParser()->getLoadManager()->broadcast(dataStacks[5]);
+	//ӻ,Ӷ㼰ڱʣಿֱֲ
+	propagatorCache.update(_flowingFunctional->cutoff, static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexSingleParticle->_data, static_cast<SU2EffectiveAction *>(_flow)->vertexSingleParticle->_data);
+	//λ㽻Ķ㸱,Ӷڱʣಿֱֲ
+	static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->updateExchangedCopy();
 	// 2 Ӷ͹
 	std::vector<int> managedMeasurementStacks;
 	for (auto m = _measurements.begin(); m != _measurements.end(); ++m)
@@ -104,8 +209,20 @@ void SU2FrgCore::computeStep()
 			managedMeasurementStacks.insert(managedMeasurementStacks.end(), s.begin(), s.end());
 		}
 	}
-	managedMeasurementStacks.push_back(dataStacks[6]);
-	SpinParser::spinParser()->getLoadManager()->calculate(managedMeasurementStacks.data(), int(managedMeasurementStacks.size()));
+	if (vertexDistribution != SU2VertexTwoParticle::Distribution::Sharded) managedMeasurementStacks.push_back(dataStacks[6]);
+	if (managedMeasurementStacks.size() > 0) SpinParser::spinParser()->getLoadManager()->calculate(managedMeasurementStacks.data(), int(managedMeasurementStacks.size()));
+
+	//ֲʽ洢ʱ,ÿ̼䱾ش洢 2 Ӷ,Զ̶ֵȡ
+	if (vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded)
+	{
+		SU2VertexTwoParticle *v4 = static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle;
+		int64_t localBegin = v4->offsetLocal / FrgCommon::lattice().size;
+		int64_t localEnd = (v4->offsetLocal + v4->sizeLocal) / FrgCommon::lattice().size;
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(dynamic)
+		#endif
+		for (int64_t i = localBegin; i < localEnd; ++i) _calculateVertexTwoParticle(i);
+	}
 }
 
 void SU2FrgCore::finalizeStep(float newCutoff)
@@ -122,18 +239,37 @@ void SU2FrgCore::finalizeStep(float newCutoff)
 	#endif
 	for (int i = 0; i < static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexSingleParticle->size; ++i) static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexSingleParticle->_data[i] += cutoffStep * static_cast<SU2EffectiveAction *>(_flow)->vertexSingleParticle->_data[i];
 
-	//_flowӵӶ
+	//_flowӵӶ;մ洢ʱдֵ뵽洢,ֲʽ洢ʱÿֻ±زֲ洢,ڵ㹲洢ʱֻÿڵͽ̸¶,ǰҪͬн
+	SU2VertexTwoParticle *v4 = static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle;
+	SU2VertexTwoParticle *v4Flow = static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle;
+	FloatFormat format = (vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded) ? _flowingFunctional->vertexFormat : FloatFormat::Float32;
+	v4->synchronize();
 	#ifndef DISABLE_OMP
 	#pragma omp parallel for schedule(static)
 	#endif
-	for (int i = 0; i < static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataDD[i] += cutoffStep * static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataDD[i];
+	for (int64_t i = 0; i < v4->sizeLocal; ++i) v4->_dataDD[i] = FloatCodec::round(v4->_dataDD[i] + cutoffStep * v4Flow->_dataDD[i], format);
 	#ifndef DISABLE_OMP
 	#pragma omp parallel for schedule(static)
 	#endif
-	for (int i = 0; i < static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataSS[i] += cutoffStep * static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataSS[i];
+	for (int64_t i = 0; i < v4->sizeLocal; ++i) v4->_dataSS[i] = FloatCodec::round(v4->_dataSS[i] + cutoffStep * v4Flow->_dataSS[i], format);
+	v4->synchronize();
 
 	//㲥Чж
-	SpinParser::spinParser()->getLoadManager()->broadcast({ dataStacks[0], dataStacks[1], dataStacks[2], dataStacks[3] });
+	synchronizeFlowingFunctional();
+}
+
+void SU2FrgCore::synchronizeFlowingFunctional()
+{
+	//ֵѱ޸,λ㽻ĸһ迪ʼʱ¸
+	static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->invalidateExchangedCopy();
+
+	//ڵ㹲洢ʱ,㲥Ḳǽڵͽ̵Ĺڴ,ȵȴн̽ȡ
+	if (vertexDistribution == SU2VertexTwoParticle::Distribution::NodeShared) static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->synchronize();
+	if (vertexDistribution == SU2VertexTwoParticle::Distribution::Sharded) SpinParser::spinParser()->getLoadManager()->broadcast({ dataStacks[0], dataStacks[1] });
+	else SpinParser::spinParser()->getLoadManager()->broadcast({ dataStacks[0], dataStacks[1], dataStacks[2], dataStacks[3] });
+
+	//ڵ㹲洢ʱ,ֻÿڵͽ̽˹㲥,Ҫȴڴ
+	if (vertexDistribution == SU2VertexTwoParticle::Distribution::NodeShared) static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle->synchronize();
 }
 
 void SU2FrgCore::_calculateVertexSingleParticle(const int iterator)
@@ -168,25 +304,34 @@ void SU2FrgCore::_calculateVertexSingleParticle(const int iterator)
 	static_cast<SU2EffectiveAction *>(_flow)->vertexSingleParticle->_data[iterator] = v2CurrentValue;
 }
 
-void SU2FrgCore::_calculateVertexTwoParticle(const int iterator)
+void SU2FrgCore::_calculateVertexTwoParticle(const int64_t iterator)
 {
 	float cutoff = _flowingFunctional->cutoff;
-	SU2VertexSingleParticle *v2 = static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexSingleParticle;
 	SU2VertexTwoParticle *v4 = static_cast<SU2EffectiveAction *>(_flowingFunctional)->vertexTwoParticle;
 
 	float s, t, u;
 	v4->expandIterator(iterator, s, t, u);
 
+	//ֲ߳̾ݴ仺ʱͳһͷ
+	ScratchArena &scratch = ScratchArena::local();
+	ScratchArena::Scope scratchScope(scratch);
+
 	//㻺
-	ValueSuperbundle<float, 2> buffer1(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> buffer2(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> bufferRPA(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> v4CurrentValue(FrgCommon::lattice().size);
+	ValueSuperbundle<float, 2> buffer1(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> buffer2(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> bufferRPA(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> v4CurrentValue(FrgCommon::lattice().size, scratch);
 	ValueSuperbundle<float, 2> stackBuffers[4] = {
-		ValueSuperbundle<float, 2>(FrgCommon::lattice().size),
-		ValueSuperbundle<float, 2>(FrgCommon::lattice().size),
-		ValueSuperbundle<float, 2>(FrgCommon::lattice().size),
-		ValueSuperbundle<float, 2>(FrgCommon::lattice().size)
+		ValueSuperbundle<float, 2>(FrgCommon::lattice().size, scratch),
+		ValueSuperbundle<float, 2>(FrgCommon::lattice().size, scratch),
+		ValueSuperbundle<float, 2>(FrgCommon::lattice().size, scratch),
+		ValueSuperbundle<float, 2>(FrgCommon::lattice().size, scratch)
+	};
+
+	//İеĶ㸱
+	float *siteMajorBuffers[2] = {
+		LatticeBubble::allocateSiteMajor(stackBuffers[2], scratch),
+		LatticeBubble::allocateSiteMajor(stackBuffers[3], scratch)
 	};
 
 	//Ƶ
@@ -196,236 +341,207 @@ void SU2FrgCore::_calculateVertexTwoParticle(const int iterator)
 	float w2 = 0.5f * (s + t - u);
 
 	//Ƶʻֵı
-	auto integralKernelS = [&](const float wp, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	//S ֺڻƵ wp ķʻ
+	auto accessBuffersS = [&](const float wp, SU2VertexTwoParticleAccessBuffer<4> *ab) -> void
 	{
 		//pp-ladder A and B (positive sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab0 = v4->generateAccessBuffer(s, -w1 - wp, -w2 - wp, SU2VertexTwoParticle::FrequencyChannel::S);
-		const SU2VertexTwoParticleAccessBuffer<4> ab1 = v4->generateAccessBuffer(s, w1p + wp, -w2p - wp, SU2VertexTwoParticle::FrequencyChannel::S);
+		ab[0] = v4->generateAccessBuffer(s, -w1 - wp, -w2 - wp, SU2VertexTwoParticle::FrequencyChannel::S);
+		ab[1] = v4->generateAccessBuffer(s, w1p + wp, -w2p - wp, SU2VertexTwoParticle::FrequencyChannel::S);
 		//pp-ladder A and B (positive sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab2 = v4->generateAccessBuffer(s, w2 + wp, w1 + wp, SU2VertexTwoParticle::FrequencyChannel::S);
-		const SU2VertexTwoParticleAccessBuffer<4> ab3 = v4->generateAccessBuffer(s, -w2p - wp, w1p + wp, SU2VertexTwoParticle::FrequencyChannel::S);
+		ab[2] = v4->generateAccessBuffer(s, w2 + wp, w1 + wp, SU2VertexTwoParticle::FrequencyChannel::S);
+		ab[3] = v4->generateAccessBuffer(s, -w2p - wp, w1p + wp, SU2VertexTwoParticle::FrequencyChannel::S);
+	};
+	//ʻÿ̱߳,洢ڸμ֮ظʹ
+	thread_local AccessBufferTable<SU2VertexTwoParticleAccessBuffer<4>, 4> tableS;
+	tableS.reset();
+
+	auto integralKernelS = [&](const float wp, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	{
+		SU2VertexTwoParticleAccessBuffer<4> abFallback[4];
+		const SU2VertexTwoParticleAccessBuffer<4> *ab = tableS.get(wp, accessBuffersS, abFallback);
 
-		v4->getValueSuperbundle(ab0, stackBuffers[0]);
-		v4->getValueSuperbundle(ab1, stackBuffers[1]);
-		v4->getValueSuperbundle(ab2, stackBuffers[2]);
-		v4->getValueSuperbundle(ab3, stackBuffers[3]);
+		v4->getValueSuperbundle(ab[0], stackBuffers[0]);
+		v4->getValueSuperbundle(ab[1], stackBuffers[1]);
+		v4->getValueSuperbundle(ab[2], stackBuffers[2]);
+		v4->getValueSuperbundle(ab[3], stackBuffers[3]);
 
 		// _flow
 		returnBuffer.reset();
 
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multSub(0.5f, stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multSub(0.5f, stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(3.0f / 16.0f, stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(3.0f / 16.0f, stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
+		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) -= 0.5f * stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ 0.5f * stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			- stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			- stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			- stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			- stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density));
+
+		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) += (3.0f / 16.0f) * stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ (3.0f / 16.0f) * stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density));
 	};
 
-	auto integralKernelT = [&](const float wp, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	//T ֺڻƵ wp ķʻ
+	auto accessBuffersT = [&](const float wp, SU2VertexTwoParticleAccessBuffer<4> *ab) -> void
 	{
 		//RPA diagram A and B equal chalice diagram A and inverse chalice diagram B, respectively (negative sign)
 		//chalice diagram A (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab0 = v4->generateAccessBuffer(w1 - wp, t, w1p + wp, SU2VertexTwoParticle::FrequencyChannel::T);
+		ab[0] = v4->generateAccessBuffer(w1 - wp, t, w1p + wp, SU2VertexTwoParticle::FrequencyChannel::T);
 		//inverse chalice diagram B (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab1 = v4->generateAccessBuffer(w2p - wp, t, -w2 - wp, SU2VertexTwoParticle::FrequencyChannel::T);
+		ab[1] = v4->generateAccessBuffer(w2p - wp, t, -w2 - wp, SU2VertexTwoParticle::FrequencyChannel::T);
 		//chalice diagram A (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab2 = v4->generateAccessBuffer(w1p + wp, t, w1 - wp, SU2VertexTwoParticle::FrequencyChannel::T);
+		ab[2] = v4->generateAccessBuffer(w1p + wp, t, w1 - wp, SU2VertexTwoParticle::FrequencyChannel::T);
 		//inverse chalice diagram B (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab3 = v4->generateAccessBuffer(w2 + wp, t, wp - w2p, SU2VertexTwoParticle::FrequencyChannel::T);
+		ab[3] = v4->generateAccessBuffer(w2 + wp, t, wp - w2p, SU2VertexTwoParticle::FrequencyChannel::T);
+		//chalice diagram B (negative sign)
+		ab[4] = v4->generateAccessBuffer(w2p - wp, -w2 - wp, t, SU2VertexTwoParticle::FrequencyChannel::U);
+		//inverse chalice diagram A (negative sign)
+		ab[5] = v4->generateAccessBuffer(w1 - wp, -w1p - wp, -t, SU2VertexTwoParticle::FrequencyChannel::U);
+		//chalice diagram B (negative sign)
+		ab[6] = v4->generateAccessBuffer(w2 + wp, wp - w2p, t, SU2VertexTwoParticle::FrequencyChannel::U);
+		//inverse chalice diagram A (negative sign)
+		ab[7] = v4->generateAccessBuffer(w1p + wp, wp - w1, -t, SU2VertexTwoParticle::FrequencyChannel::U);
+	};
+	thread_local AccessBufferTable<SU2VertexTwoParticleAccessBuffer<4>, 8> tableT;
+	tableT.reset();
 
-		v4->getValueSuperbundle(ab0, stackBuffers[0]);
-		v4->getValueSuperbundle(ab1, stackBuffers[1]);
-		v4->getValueSuperbundle(ab2, stackBuffers[2]);
-		v4->getValueSuperbundle(ab3, stackBuffers[3]);
+	auto integralKernelT = [&](const float wp, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	{
+		SU2VertexTwoParticleAccessBuffer<4> abFallback[8];
+		const SU2VertexTwoParticleAccessBuffer<4> *ab = tableT.get(wp, accessBuffersT, abFallback);
+
+		v4->getValueSuperbundle(ab[0], stackBuffers[0]);
+		v4->getValueSuperbundle(ab[1], stackBuffers[1]);
+		v4->getValueSuperbundle(ab[2], stackBuffers[2]);
+		v4->getValueSuperbundle(ab[3], stackBuffers[3]);
 
 		//calculate _flow
 		returnBuffer.reset();
 
-		bufferRPA.reset();
-		for (int rid = 0; rid < FrgCommon::lattice().size; ++rid)
+		//
+		if (bubblePlan.isApplicable()) bubblePlan.product(stackBuffers[2], stackBuffers[3], bufferRPA, scratch);
+		else
 		{
-			//lattice bubble
-			const LatticeOverlap &overlap = FrgCommon::lattice().getOverlap(rid);
-
-			for (int i = 0; i < overlap.size; ++i)
-			{
-				bufferRPA.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[rid] += stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[overlap.rid1[i]] * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[overlap.rid2[i]];
-			}
-
-			for (int i = 0; i < overlap.size; ++i)
-			{
-				bufferRPA.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[rid] += stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[overlap.rid1[i]] * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[overlap.rid2[i]];
-			}
+			LatticeBubble::transpose(stackBuffers[2], siteMajorBuffers[0]);
+			LatticeBubble::transpose(stackBuffers[3], siteMajorBuffers[1]);
+			LatticeBubble::product(FrgCommon::lattice().getOverlapTable(), siteMajorBuffers[0], siteMajorBuffers[1], bufferRPA);
 		}
 		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(2.0f * spinLength, bufferRPA.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
 		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(8.0f * spinLength, bufferRPA.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
 
-		//chalice diagram B (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab4 = v4->generateAccessBuffer(w2p - wp, -w2 - wp, t, SU2VertexTwoParticle::FrequencyChannel::U);
-		//inverse chalice diagram A (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab5 = v4->generateAccessBuffer(w1 - wp, -w1p - wp, -t, SU2VertexTwoParticle::FrequencyChannel::U);
-		//chalice diagram B (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab6 = v4->generateAccessBuffer(w2 + wp, wp - w2p, t, SU2VertexTwoParticle::FrequencyChannel::U);
-		//inverse chalice diagram A (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab7 = v4->generateAccessBuffer(w1p + wp, wp - w1, -t, SU2VertexTwoParticle::FrequencyChannel::U);
-
-		const float valCbs = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab4);
-		const float valCbd = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab4);
-		const float valICas = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab5);
-		const float valICad = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab5);
-		const float valCbs2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab6);
-		const float valCbd2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab6);
-		const float valICas2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab7);
-		const float valICad2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab7);
-
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multSub(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), valCbd);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), 0.25f * valCbs);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multSub(valICad, stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(0.25f * valICas, stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multSub(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), valCbd2);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), 0.25f * valCbs2);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multSub(valICad2, stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(0.25f * valICas2, stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), valCbd);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), 0.75f * valCbs);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(valICad, stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(0.75f * valICas, stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), valCbd2);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), 0.75f * valCbs2);
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(valICad2, stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multSub(0.75f * valICas2, stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
+		const float valCbs = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab[4]);
+		const float valCbd = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab[4]);
+		const float valICas = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab[5]);
+		const float valICad = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab[5]);
+		const float valCbs2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab[6]);
+		const float valCbd2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab[6]);
+		const float valICas2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Spin, ab[7]);
+		const float valICad2 = v4->getValueLocal(SU2VertexTwoParticle::Symmetry::Density, ab[7]);
+
+		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) -= stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * valCbd
+			- stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * (0.25f * valCbs)
+			+ valICad * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			- (0.25f * valICas) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * valCbd2
+			- stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * (0.25f * valCbs2)
+			+ valICad2 * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			- (0.25f * valICas2) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin));
+
+		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) -= stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * valCbd
+			+ stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * (0.75f * valCbs)
+			+ valICad * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ (0.75f * valICas) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * valCbd2
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * (0.75f * valCbs2)
+			+ valICad2 * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ (0.75f * valICas2) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density));
 	};
 
-	auto integralKernelU = [&](const float wp, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	//U ֺڻƵ wp ķʻ
+	auto accessBuffersU = [&](const float wp, SU2VertexTwoParticleAccessBuffer<4> *ab) -> void
 	{
 		//u-Channel, to be combined with P(wp, u + wp) + P(u + wp, wp)
 		//ph-ladder A and B, respectively (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab0 = v4->generateAccessBuffer(w1 + wp, wp - w2p, u, SU2VertexTwoParticle::FrequencyChannel::U);
-		const SU2VertexTwoParticleAccessBuffer<4> ab1 = v4->generateAccessBuffer(w1p + wp, w2 - wp, u, SU2VertexTwoParticle::FrequencyChannel::U);
+		ab[0] = v4->generateAccessBuffer(w1 + wp, wp - w2p, u, SU2VertexTwoParticle::FrequencyChannel::U);
+		ab[1] = v4->generateAccessBuffer(w1p + wp, w2 - wp, u, SU2VertexTwoParticle::FrequencyChannel::U);
 		//ph-ladder A and B, respectively (negative sign)
-		const SU2VertexTwoParticleAccessBuffer<4> ab2 = v4->generateAccessBuffer(w2p - wp, -w1 - wp, u, SU2VertexTwoParticle::FrequencyChannel::U);
-		const SU2VertexTwoParticleAccessBuffer<4> ab3 = v4->generateAccessBuffer(w2 - wp, w1p + wp, u, SU2VertexTwoParticle::FrequencyChannel::U);
+		ab[2] = v4->generateAccessBuffer(w2p - wp, -w1 - wp, u, SU2VertexTwoParticle::FrequencyChannel::U);
+		ab[3] = v4->generateAccessBuffer(w2 - wp, w1p + wp, u, SU2VertexTwoParticle::FrequencyChannel::U);
+	};
+	thread_local AccessBufferTable<SU2VertexTwoParticleAccessBuffer<4>, 4> tableU;
+	tableU.reset();
 
-		v4->getValueSuperbundle(ab0, stackBuffers[0]);
-		v4->getValueSuperbundle(ab1, stackBuffers[1]);
-		v4->getValueSuperbundle(ab2, stackBuffers[2]);
-		v4->getValueSuperbundle(ab3, stackBuffers[3]);
+	auto integralKernelU = [&](const float wp, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	{
+		SU2VertexTwoParticleAccessBuffer<4> abFallback[4];
+		const SU2VertexTwoParticleAccessBuffer<4> *ab = tableU.get(wp, accessBuffersU, abFallback);
+
+		v4->getValueSuperbundle(ab[0], stackBuffers[0]);
+		v4->getValueSuperbundle(ab[1], stackBuffers[1]);
+		v4->getValueSuperbundle(ab[2], stackBuffers[2]);
+		v4->getValueSuperbundle(ab[3], stackBuffers[3]);
 
 		//calculate _flow
 		returnBuffer.reset();
 
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(0.5f, stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(0.5f, stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(3.0f / 16.0f, stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(3.0f / 16.0f, stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)).multAdd(stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)), stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)));
-	};
-
-	//propagator bubble
-	auto p = [&](const float w1, const float w2) -> float
-	{
-		return 1.0f / ((w1 + v2->getValue(w1)) *(w2 + v2->getValue(w2)));
-	};
-
-	//Katanin contribution, call only once the _flow has been fully calculated and broadcasted
-	auto pKataninContribution = [&](const float w1, const float w2) ->float
-	{
-		float denomW1 = w1 + v2->getValue(w1);
-		return static_cast<SU2EffectiveAction *>(_flow)->vertexSingleParticle->getValue(w1) / (denomW1 * denomW1 * (w2 + v2->getValue(w2)));
+		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) += 0.5f * stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ 0.5f * stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin));
+
+		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) += (3.0f / 16.0f) * stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ (3.0f / 16.0f) * stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))
+			+ stackBuffers[0].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[1].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))
+			+ stackBuffers[2].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density)) * stackBuffers[3].bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density));
 	};
 
 	//begin calculation of vertices here
 	//conventional contribution
 	integralKernelS(cutoff, buffer1);
-	v4CurrentValue.multAdd(p(cutoff, cutoff + s), buffer1);
+	v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(s), buffer1);
 	if (s > 2.0f * cutoff)
 	{
 		integralKernelS(-cutoff, buffer1);
-		v4CurrentValue.multAdd(p(cutoff, cutoff - s), buffer1);
+		v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(-s), buffer1);
 	}
 	integralKernelT(cutoff, buffer1);
-	v4CurrentValue.multAdd(p(cutoff, cutoff + t), buffer1);
+	v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(t), buffer1);
 	if (t > 2.0f * cutoff)
 	{
 		integralKernelT(-cutoff, buffer1);
-		v4CurrentValue.multAdd(p(cutoff, cutoff - t), buffer1);
+		v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(-t), buffer1);
 	}
 	integralKernelU(cutoff, buffer1);
-	v4CurrentValue.multAdd(-p(cutoff, cutoff + u), buffer1);
+	v4CurrentValue.multAdd(-propagatorCache.propagatorCutoff(u), buffer1);
 	if (u > 2.0f * cutoff)
 	{
 		integralKernelU(-cutoff, buffer1);
-		v4CurrentValue.multAdd(-p(cutoff, cutoff - u), buffer1);
+		v4CurrentValue.multAdd(-propagatorCache.propagatorCutoff(-u), buffer1);
 	}
 
 	//Katanin contribution
-	std::function<void(float, ValueSuperbundle<float, 2> &)> integralKernelSKatanin = [&](float wp, ValueSuperbundle<float, 2> &returnBuffer)->void { integralKernelS(wp, returnBuffer); returnBuffer *= pKataninContribution(wp, s + wp); };
-	std::function<void(float, ValueSuperbundle<float, 2> &)> integralKernelTKatanin = [&](float wp, ValueSuperbundle<float, 2> &returnBuffer)->void { integralKernelT(wp, returnBuffer); returnBuffer *= pKataninContribution(wp, t + wp); };
-	std::function<void(float, ValueSuperbundle<float, 2> &)> integralKernelUKatanin = [&](float wp, ValueSuperbundle<float, 2> &returnBuffer)->void { integralKernelU(wp, returnBuffer); returnBuffer *= -pKataninContribution(wp, u + wp); };
+	auto integralKernelSKatanin = [&](float wp, ValueSuperbundle<float, 2> &returnBuffer)->void { integralKernelS(wp, returnBuffer); returnBuffer *= propagatorCache.kataninPropagator(wp, s + wp); };
+	auto integralKernelTKatanin = [&](float wp, ValueSuperbundle<float, 2> &returnBuffer)->void { integralKernelT(wp, returnBuffer); returnBuffer *= propagatorCache.kataninPropagator(wp, t + wp); };
+	auto integralKernelUKatanin = [&](float wp, ValueSuperbundle<float, 2> &returnBuffer)->void { integralKernelU(wp, returnBuffer); returnBuffer *= -propagatorCache.kataninPropagator(wp, u + wp); };
 
-	if (-(s + cutoff) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(s + cutoff), integralKernelSKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (s - cutoff > cutoff)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - s, -cutoff, integralKernelSKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (cutoff < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integralKernelSKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
+	//ڻַΧڵƵ S ͨķʻ
+	tableS.generate(accessBuffersS, s, cutoff);
+	ImplicitIntegrator::integrateOutsideCutoff(s, cutoff, integralKernelSKatanin, buffer1, buffer2, v4CurrentValue);
 
-	if (-(t + cutoff) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(t + cutoff), integralKernelTKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (t - cutoff > cutoff)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - t, -cutoff, integralKernelTKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (cutoff < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integralKernelTKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
+	//ڻַΧڵƵ T ͨķʻ
+	tableT.generate(accessBuffersT, t, cutoff);
+	ImplicitIntegrator::integrateOutsideCutoff(t, cutoff, integralKernelTKatanin, buffer1, buffer2, v4CurrentValue);
 
-	if (-(u + cutoff) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(u + cutoff), integralKernelUKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (u - cutoff > cutoff)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - u, -cutoff, integralKernelUKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (cutoff < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integralKernelUKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
+	//ڻַΧڵƵ U ͨķʻ
+	tableU.generate(accessBuffersU, u, cutoff);
+	ImplicitIntegrator::integrateOutsideCutoff(u, cutoff, integralKernelUKatanin, buffer1, buffer2, v4CurrentValue);
 
 	//prefactor
 	v4CurrentValue /= 2.0f * (float)M_PI;
 
-	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid) static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataSS[iterator * FrgCommon::lattice().size + rid] = v4CurrentValue.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[rid];
-	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid) static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataDD[iterator * FrgCommon::lattice().size + rid] = v4CurrentValue.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[rid];
+	int64_t offset = iterator * FrgCommon::lattice().size - static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->offsetLocal;
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid) static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataSS[offset + rid] = v4CurrentValue.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[rid];
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid) static_cast<SU2EffectiveAction *>(_flow)->vertexTwoParticle->_dataDD[offset + rid] = v4CurrentValue.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[rid];
 }
\ No newline at end of file
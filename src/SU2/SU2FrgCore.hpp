@@ -8,6 +8,9 @@
 
 #pragma once
 #include "FrgCore.hpp"
+#include "PropagatorCache.hpp"
+#include "LatticeBubble.hpp"
+#include "SU2VertexTwoParticle.hpp"
 
 /**
  * @brief SU(2) ģ͵ FRG ʵ.
@@ -41,8 +44,18 @@ public:
 	 */
 	void finalizeStep(const float newCutoff) override;
 
+	/**
+	 * @brief 㲥 MPI . 
+	 */
+	void synchronizeFlowingFunctional() override;
+
 	float spinLength; ///< Sֵ,. 
 	float normalization; ///< һ. 
+	SU2VertexTwoParticle::Distribution vertexDistribution; ///< Ӷ MPI ̼Ĵ洢ʽ. 
+	int vertexCacheSize; ///< ֲʽ洢ʱÿ̻ԶƵ. 
+	FloatFormat vertexFormat; ///< ӶĴ洢ʽ. 
+	PropagatorCache propagatorCache; ///< ǰֵֹµĴӻ,ÿ蹹һ. 
+	LatticeBubble::FourierPlan bubblePlan; ///< ڶռм㾧ݵķ. ѡ bubble=fft ڵǰ񲢹ƿֱʱ. 
 
 private:
 	int dataStacks[8]; ///< LoadManager::DataStack. 
@@ -59,5 +72,5 @@ private:
 	 * 
 	 * @param iterator Ե. 
 	 */
-	void _calculateVertexTwoParticle(const int iterator);
+	void _calculateVertexTwoParticle(const int64_t iterator);
 };
\ No newline at end of file
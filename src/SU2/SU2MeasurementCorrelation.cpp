@@ -65,7 +65,13 @@ SU2MeasurementCorrelation::~SU2MeasurementCorrelation()
 
 void SU2MeasurementCorrelation::takeMeasurement(const EffectiveAction &state, const bool isMasterTask) const
 {
-	if (_currentCutoff != state.cutoff) SpinParser::spinParser()->getLoadManager()->calculate(_loadManagedStacks.data(), int(_loadManagedStacks.size()));
+	if (_currentCutoff != state.cutoff)
+	{
+		//ûǰ½(һ֮),Ϊǰ״̬¹ӻ
+		SU2FrgCore *core = static_cast<SU2FrgCore *>(SpinParser::spinParser()->getFrgCore());
+		core->propagatorCache.update(state.cutoff, static_cast<const SU2EffectiveAction &>(state).vertexSingleParticle->_data, static_cast<SU2EffectiveAction *>(core->flow())->vertexSingleParticle->_data);
+		SpinParser::spinParser()->getLoadManager()->calculate(_loadManagedStacks.data(), int(_loadManagedStacks.size()));
+	}
 
 	if (isMasterTask)
 	{
@@ -80,30 +86,34 @@ void SU2MeasurementCorrelation::_calculateCorrelation(const int iterator) const
 	float nu = 0.0f;
 	float cut = SpinParser::spinParser()->getFrgCore()->flowingFunctional()->cutoff;
 	SU2FrgCore *core = static_cast<SU2FrgCore *>(SpinParser::spinParser()->getFrgCore());
-	SU2VertexSingleParticle *v2 = static_cast<SU2EffectiveAction *>(SpinParser::spinParser()->getFrgCore()->flowingFunctional())->vertexSingleParticle;
+	const PropagatorCache &propagatorCache = static_cast<SU2FrgCore *>(SpinParser::spinParser()->getFrgCore())->propagatorCache;
 	SU2VertexTwoParticle *v4 = static_cast<SU2EffectiveAction *>(SpinParser::spinParser()->getFrgCore()->flowingFunctional())->vertexTwoParticle;
 
-	ValueSuperbundle<float, 2> susceptibility(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> stackBuffer(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> buffer1(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> buffer2(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> buffer3(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 2> buffer4(FrgCommon::lattice().size);
+	//ֲ߳̾ݴ仺ʱͳһͷ
+	ScratchArena &scratch = ScratchArena::local();
+	ScratchArena::Scope scratchScope(scratch);
+
+	ValueSuperbundle<float, 2> susceptibility(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> stackBuffer(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> buffer1(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> buffer2(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> buffer3(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 2> buffer4(FrgCommon::lattice().size, scratch);
 
 	//ں
-	std::function<void(float, ValueSuperbundle<float, 2> &)> integralKernel = [&](const float w, ValueSuperbundle<float, 2> &returnBuffer) -> void
+	auto integralKernel = [&](const float w, ValueSuperbundle<float, 2> &returnBuffer) -> void
 	{
 		returnBuffer.reset();
 
 		//term1
 		//עܲг i˸
-		float term1 = 1.0f / ((w + v2->getValue(w)) * (w + nu + v2->getValue(w + nu)));
+		float term1 = propagatorCache.propagator(w, w + nu);
 		//ǰ 2.0 * ȷ
 		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[0] += core->spinLength * term1 / float(2.0f * M_PI);
 		returnBuffer.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[0] += 2.0f * core->spinLength * term1 / float(M_PI);
 
 		//term2
-		std::function<void(float, ValueSuperbundle<float, 2> &)> innerKernel = [&](const float wp, ValueSuperbundle<float, 2> &ret) -> void
+		auto innerKernel = [&](const float wp, ValueSuperbundle<float, 2> &ret) -> void
 		{
 			ret.reset();
 			const SU2VertexTwoParticleAccessBuffer<8> ab0 = v4->generateAccessBuffer(w + wp + nu, nu, w - wp);
@@ -122,41 +132,13 @@ void SU2MeasurementCorrelation::_calculateCorrelation(const int iterator) const
 			ret.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Spin))[0] += core->spinLength * (-vs / 4.0f + vd);
 			ret.bundle(static_cast<int>(SU2VertexTwoParticle::Symmetry::Density))[0] += core->spinLength * (3.0f * vs + 4.0f * vd);
 
-			float normalization = 1.0f / ((w + v2->getValue(w)) * (w + nu + v2->getValue(w + nu)) * (wp + v2->getValue(wp)) * (wp + nu + v2->getValue(wp + nu)) * float(4.0f * M_PI * M_PI));
+			float normalization = 1.0f / (propagatorCache.denominator(w) * propagatorCache.denominator(w + nu) * propagatorCache.denominator(wp) * propagatorCache.denominator(wp + nu) * float(4.0f * M_PI * M_PI));
 			ret *= normalization;
 		};
-		if (-(nu + cut) > *FrgCommon::frequency().beginNegative())
-		{
-			ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -cut - nu, innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
-		if (nu - cut > cut)
-		{
-			ImplicitIntegrator::integrateWithObscureBoundaries(-nu + cut, -cut, innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
-		if (cut < *FrgCommon::frequency().last())
-		{
-			ImplicitIntegrator::integrateWithObscureLeftBoundary(cut, FrgCommon::frequency().last(), innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
+		ImplicitIntegrator::integrateOutsideCutoff(nu, cut, innerKernel, buffer3, buffer4, returnBuffer);
 	};
 
-	if (-(nu + cut) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -cut - nu, integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
-	if (nu - cut > cut)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(-nu + cut, -cut, integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
-	if (cut < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cut, FrgCommon::frequency().last(), integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
+	ImplicitIntegrator::integrateOutsideCutoff(nu, cut, integralKernel, buffer1, buffer2, susceptibility);
 
 	int offset = iterator * _memoryStepLattice;
 	for (auto i = FrgCommon::lattice().getBasis(); i != FrgCommon::lattice().end(); ++i)
@@ -8,7 +8,12 @@
 
 #pragma once
 #include <istream>
+#include <cstdint>
+#include <vector>
 #include "lib/ValueBundle.hpp"
+#include "lib/ShardedArray.hpp"
+#include "lib/NodeSharedArray.hpp"
+#include "lib/FloatArray.hpp"
 #include "lib/Assert.hpp"
 #include "FrgCommon.hpp"
 
@@ -29,7 +34,7 @@ public:
 	 */
 	SU2VertexTwoParticleAccessBuffer() : siteExchange(false) {}
 
-	int frequencyOffsets[size]; ///< ˫ӶƵάеԼƫƣԪ.  
+	int64_t frequencyOffsets[size]; ///< ˫ӶƵάеԼƫƣԪ.  
 	float frequencyWeights[size]; ///< ֵ֧Ȩ. 
 	int signFlag[size]; ///< ֵ֧ķ. 
 	bool siteExchange; ///< λ㽻ָ. 
@@ -62,32 +67,198 @@ public:
 		None ///< No channel. 
 	};
 
+	/**
+	 * @brief  MPI ̼Ĵ洢ʽ. 
+	 */
+	enum struct Distribution
+	{
+		Replicated, ///< ÿ̴洢Ķ. 
+		Sharded, ///< 㰴Ƶʵֲֿн. 
+		NodeShared ///< ͬһڵϵн̹һĶ. 
+	};
+
 	/**
 	 * @brief һµ SU2Vertex Ӷ󲢽ĿʼΪ. 
+	 * @details Ϊ Distribution::Sharded, 㰴Ƶʵֲֿ MPI , ÿֻ洢Ŀ, ಿͨͨŰȡ. 
+	 * Ϊ Distribution::NodeShared, ÿڵֻ洢һ, ɽڵϵͽ޸, ֱӶȡڴ. 
+	 *  Distribution::Replicated , 캯 MPI ϼ. 
+	 * Ϊ Distribution::Replicated ָ 16 λ洢ʽ, ֵԸøʽմ洢, ȡʱΪ. 
+	 * 
+	 * @param distribution  MPI ̼Ĵ洢ʽ. 
+	 * @param cacheSize ֲʽ洢ʱԶƵ. 
+	 * @param format ƴ洢ʱֵĴ洢ʽ. ֲʽͽڵ㹲洢ĶԵȴ洢. 
 	 */
-	SU2VertexTwoParticle()
+	SU2VertexTwoParticle(const Distribution distribution = Distribution::Replicated, const int cacheSize = 0, const FloatFormat format = FloatFormat::Float32)
 	{
 		//ڴάд洢
 		_memoryStepLattice = FrgCommon::lattice().size;
 		_memoryStepLatticeT = _memoryStepLattice * FrgCommon::frequency().size;
 
-		sizeFrequency = FrgCommon::frequency().size * FrgCommon::frequency().size * (FrgCommon::frequency().size + 1) / 2;
+		sizeFrequency = int64_t(FrgCommon::frequency().size) * FrgCommon::frequency().size * (FrgCommon::frequency().size + 1) / 2;
 		size = FrgCommon::lattice().size * sizeFrequency;
 
 		//ͳʼڴ
-		_dataSS = new float[size];
-		_dataDD = new float[size];
-		memset(_dataSS, 0, sizeof(float) * size);
-		memset(_dataDD, 0, sizeof(float) * size);
+		_shardSS = nullptr;
+		_shardDD = nullptr;
+		_sharedSS = nullptr;
+		_sharedDD = nullptr;
+		_exchangedValid = false;
+		if (distribution == Distribution::Sharded)
+		{
+			_shardSS = new ShardedArray(sizeFrequency, FrgCommon::lattice().size, cacheSize);
+			_shardDD = new ShardedArray(sizeFrequency, FrgCommon::lattice().size, cacheSize);
+			_dataSS = FloatArray(_shardSS->data(), _shardSS->localSize());
+			_dataDD = FloatArray(_shardDD->data(), _shardDD->localSize());
+			offsetLocal = _shardSS->begin() * FrgCommon::lattice().size;
+			sizeLocal = _shardSS->localSize();
+		}
+		else if (distribution == Distribution::NodeShared)
+		{
+			//ֻнڵϵͽ޸Ķ
+			_sharedSS = new NodeSharedArray(size);
+			_sharedDD = new NodeSharedArray(size);
+			_dataSS = FloatArray(_sharedSS->data(), size);
+			_dataDD = FloatArray(_sharedDD->data(), size);
+			offsetLocal = 0;
+			sizeLocal = (_sharedSS->isLeader()) ? size : 0;
+		}
+		else
+		{
+			_dataSS = FloatArray::allocate(size, format);
+			_dataDD = FloatArray::allocate(size, format);
+			offsetLocal = 0;
+			sizeLocal = size;
+		}
 	}
 
 	/**
-	 * @brief  SU2Vertex Ӷ. 
+	 * @brief  SU2Vertex Ӷ. ֲʽ洢ʱ MPI ϼ. 
 	 */
 	~SU2VertexTwoParticle()
 	{
-		delete[] _dataSS;
-		delete[] _dataDD;
+		if (isSharded())
+		{
+			delete _shardSS;
+			delete _shardDD;
+		}
+		else if (isNodeShared())
+		{
+			delete _sharedSS;
+			delete _sharedDD;
+		}
+		else
+		{
+			_dataSS.release();
+			_dataDD.release();
+		}
+		_exchangedSS.release();
+		_exchangedDD.release();
+	}
+
+	/**
+	 * @brief 鶥Ƿֲ MPI . 
+	 * 
+	 * @return bool Ϊֲʽ洢򷵻 true. 
+	 */
+	bool isSharded() const
+	{
+		return _shardSS != nullptr;
+	}
+
+	/**
+	 * @brief 鶥Ƿͬһڵϵ MPI ̹. 
+	 * 
+	 * @return bool 洢ڽڵ㹲ڴ򷵻 true. 
+	 */
+	bool isNodeShared() const
+	{
+		return _sharedSS != nullptr;
+	}
+
+	/**
+	 * @brief Ϊλ㽻Ķһ洢ĸ, ʹ getValueSuperbundle() λ㽻ʱҲȡֵ.  Distribution::Replicated. 
+	 * @details  updateExchangedCopy() ֮Ч, ֱ invalidateExchangedCopy() ޸ĶֵΪֹ. ԶĴ洢ʽ洢, ʹÿͨռõڴӱ. 
+	 */
+	void enableExchangedCopy()
+	{
+		ASSERT(!isSharded() && !isNodeShared());
+
+		if (hasExchangedCopy()) return;
+		_exchangedSS = FloatArray::allocate(size, _dataSS.format());
+		_exchangedDD = FloatArray::allocate(size, _dataDD.format());
+		_exchangedValid = false;
+	}
+
+	/**
+	 * @brief λ㽻Ķ㸱Ƿѷ. 
+	 * 
+	 * @return bool ѵ enableExchangedCopy() 򷵻 true. 
+	 */
+	bool hasExchangedCopy() const
+	{
+		return _exchangedSS.size() > 0;
+	}
+
+	/**
+	 * @brief ݵǰֵλ㽻Ķ㸱. ÿƵеֵתλ. δ丱ִκβ. 
+	 */
+	void updateExchangedCopy()
+	{
+		if (!hasExchangedCopy()) return;
+
+		const LatticeSiteDescriptor *invertedSites = FrgCommon::lattice().getInvertedSites();
+		int latticeSize = FrgCommon::lattice().size;
+
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (int64_t line = 0; line < sizeFrequency; ++line)
+		{
+			int64_t offset = line * latticeSize;
+			//մ洢ʱֱӸƱֵ
+			if (_dataSS.isCompact())
+			{
+				for (int j = 0; j < latticeSize; ++j)
+				{
+					_exchangedSS.compactData()[offset + j] = _dataSS.compactData()[offset + invertedSites[j].rid];
+					_exchangedDD.compactData()[offset + j] = _dataDD.compactData()[offset + invertedSites[j].rid];
+				}
+			}
+			else
+			{
+				for (int j = 0; j < latticeSize; ++j)
+				{
+					_exchangedSS.data()[offset + j] = _dataSS.data()[offset + invertedSites[j].rid];
+					_exchangedDD.data()[offset + j] = _dataDD.data()[offset + invertedSites[j].rid];
+				}
+			}
+		}
+		_exchangedValid = true;
+	}
+
+	/**
+	 * @brief λ㽻Ķ㸱ΪЧ. ˺ getValueSuperbundle() λ㽻ʱ°תλȡֵ. 
+	 */
+	void invalidateExchangedCopy()
+	{
+		_exchangedValid = false;
+	}
+
+	/**
+	 * @brief ͬ MPI ̲ʹԶƵеĻʧЧ. ֲʽڵ㹲洢ʱ, ޸ıضֵ֮ǰ֮󶼱 MPI ϼ. 
+	 */
+	void synchronize()
+	{
+		if (isSharded())
+		{
+			_shardSS->synchronize();
+			_shardDD->synchronize();
+		}
+		else if (isNodeShared())
+		{
+			_sharedSS->synchronize();
+			_sharedDD->synchronize();
+		}
 	}
 
 	/**
@@ -99,30 +270,22 @@ public:
 	 * @param[out] t ڶƵʲ. 
 	 * @param[out] u Ƶʲ. 
 	 */
-	void expandIterator(int iterator, LatticeIterator &i1, float &s, float &t, float &u) const
+	void expandIterator(int64_t iterator, LatticeIterator &i1, float &s, float &t, float &u) const
 	{
 		ASSERT(iterator >= 0 && iterator < size);
 		ASSERT(&s != &t);
 		ASSERT(&t != &u);
 		ASSERT(&s != &u);
 
-		int su = iterator / _memoryStepLatticeT;
+		int su = int(iterator / _memoryStepLatticeT);
 		iterator = iterator % _memoryStepLatticeT;
 		t = FrgCommon::frequency()._data[iterator / _memoryStepLattice];
-		i1 = FrgCommon::lattice().fromParametrization(iterator % _memoryStepLattice);
+		i1 = FrgCommon::lattice().fromParametrization(int(iterator % _memoryStepLattice));
 
-		for (int so = 0; so <= su; ++so)
-		{
-			for (int uo = 0; uo <= so; ++uo)
-			{
-				if (su == so * (so + 1) / 2 + uo)
-				{
-					s = FrgCommon::frequency()._data[so];
-					u = FrgCommon::frequency()._data[uo];
-					return;
-				}
-			}
-		}
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(su, so, uo);
+		s = FrgCommon::frequency()._data[so];
+		u = FrgCommon::frequency()._data[uo];
 	}
 
 	/**
@@ -133,41 +296,76 @@ public:
 	 * @param[out] t ڶƵʲ. 
 	 * @param[out] u Ƶʲ. 
 	 */
-	void expandIterator(int iterator, float &s, float &t, float &u) const
+	void expandIterator(int64_t iterator, float &s, float &t, float &u) const
 	{
 		ASSERT(iterator >= 0 && iterator < sizeFrequency);
 		ASSERT(&s != &t);
 		ASSERT(&t != &u);
 		ASSERT(&s != &u);
 
-		int su = iterator / FrgCommon::frequency().size;
+		int su = int(iterator / FrgCommon::frequency().size);
 		t = FrgCommon::frequency()._data[iterator % FrgCommon::frequency().size];
 
-		for (int so = 0; so <= su; ++so)
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(su, so, uo);
+		s = FrgCommon::frequency()._data[so];
+		u = FrgCommon::frequency()._data[uo];
+	}
+
+	/**
+	 * @brief չ [0,sizeFrequency) ΧڵһԵ [begin,end)вƵֵ. 
+	 * @details ƵʲʽƽÿĿΪ. ÿƵֵڣǱ仯ڴά. 
+	 * 
+	 * @param[in] begin һԵ. 
+	 * @param[in] end һչĵ֮Ե. 
+	 * @param[out] s һƵʲ. ṩ end-begin ֵĿռ. 
+	 * @param[out] t ڶƵʲ. ṩ end-begin ֵĿռ. 
+	 * @param[out] u Ƶʲ. ṩ end-begin ֵĿռ. 
+	 */
+	void expandIterators(const int64_t begin, const int64_t end, float *s, float *t, float *u) const
+	{
+		ASSERT(begin >= 0 && begin <= end && end <= sizeFrequency);
+
+		if (begin == end) return;
+		const int frequencySize = FrgCommon::frequency().size;
+		const float *frequency = FrgCommon::frequency()._data;
+
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(begin / frequencySize, so, uo);
+		int to = int(begin % frequencySize);
+
+		for (int64_t i = 0; i < end - begin; ++i)
 		{
-			for (int uo = 0; uo <= so; ++uo)
+			s[i] = frequency[so];
+			t[i] = frequency[to];
+			u[i] = frequency[uo];
+
+			if (++to == frequencySize)
 			{
-				if (su == so * (so + 1) / 2 + uo)
+				to = 0;
+				if (++uo > so)
 				{
-					s = FrgCommon::frequency()._data[so];
-					u = FrgCommon::frequency()._data[uo];
-					return;
+					uo = 0;
+					++so;
 				}
 			}
 		}
 	}
 
 	/**
-	 * @brief ͨԵֱӷ [0,size) ΧڵĶֵ. 
+	 * @brief ͨԵֱӷ [0,size) ΧڵĶֵ. ֲʽ洢ʱֻܷ [offsetLocal,offsetLocal+sizeLocal) Χڵıֵ. 
+	 * @details մ洢ʱдֵ뵽洢ʽľ. 
 	 * 
 	 * @param iterator Ե. 
 	 * @param symmetry ͨ. 
-	 * @return float& ֵ. 
+	 * @return FloatArray::Reference ֵ. 
 	 */
-	float &getValueRef(const int iterator, const SU2VertexTwoParticle::Symmetry symmetry) const
+	FloatArray::Reference getValueRef(const int64_t iterator, const SU2VertexTwoParticle::Symmetry symmetry) const
 	{
-		if (symmetry == SU2VertexTwoParticle::Symmetry::Spin) return _dataSS[iterator];
-		else return _dataDD[iterator];
+		ASSERT(iterator >= offsetLocal && iterator < offsetLocal + sizeLocal);
+
+		if (symmetry == SU2VertexTwoParticle::Symmetry::Spin) return _dataSS[iterator - offsetLocal];
+		else return _dataDD[iterator - offsetLocal];
 	}
 
 	/**
@@ -326,11 +524,11 @@ public:
 		float value = 0.0f;
 		if (symmetry == SU2VertexTwoParticle::Symmetry::Spin)
 		{
-			for (int i = 0; i < n; ++i) value += accessBuffer.frequencyWeights[i] * _dataSS[accessBuffer.frequencyOffsets[i] + siteOffset];
+			for (int i = 0; i < n; ++i) value += accessBuffer.frequencyWeights[i] * _value(_dataSS, _shardSS, accessBuffer.frequencyOffsets[i] + siteOffset);
 		}
 		else
 		{
-			for (int i = 0; i < n; ++i) value += accessBuffer.signFlag[i] * accessBuffer.frequencyWeights[i] * _dataDD[accessBuffer.frequencyOffsets[i] + siteOffset];
+			for (int i = 0; i < n; ++i) value += accessBuffer.signFlag[i] * accessBuffer.frequencyWeights[i] * _value(_dataDD, _shardDD, accessBuffer.frequencyOffsets[i] + siteOffset);
 		}
 
 		return value;
@@ -349,11 +547,11 @@ public:
 		float value = 0.0f;
 		if (symmetry == SU2VertexTwoParticle::Symmetry::Spin)
 		{
-			for (int i = 0; i < n; ++i) value += accessBuffer.frequencyWeights[i] * _dataSS[accessBuffer.frequencyOffsets[i]];
+			for (int i = 0; i < n; ++i) value += accessBuffer.frequencyWeights[i] * _value(_dataSS, _shardSS, accessBuffer.frequencyOffsets[i]);
 		}
 		else
 		{
-			for (int i = 0; i < n; ++i) value += accessBuffer.signFlag[i] * accessBuffer.frequencyWeights[i] * _dataDD[accessBuffer.frequencyOffsets[i]];
+			for (int i = 0; i < n; ++i) value += accessBuffer.signFlag[i] * accessBuffer.frequencyWeights[i] * _value(_dataDD, _shardDD, accessBuffer.frequencyOffsets[i]);
 		}
 
 		return value;
@@ -369,19 +567,57 @@ public:
 	template <int n> void getValueSuperbundle(const SU2VertexTwoParticleAccessBuffer<n> &accessBuffer, ValueSuperbundle<float, 2> &superbundle) const
 	{
 		superbundle.reset();
-		const LatticeSiteDescriptor *sites = (accessBuffer.siteExchange) ? FrgCommon::lattice().getInvertedSites() : FrgCommon::lattice().getSites();
+
+		//λȼеƽ,  getSites()[j].rid == j, ˲λʱÿƵеĶֵ. λ㽻ʱЧĸ, Ӹȡ
+		bool contiguous = !accessBuffer.siteExchange || _exchangedValid;
+		const LatticeSiteDescriptor *invertedSites = FrgCommon::lattice().getInvertedSites();
+
+		//ֲʽ洢ʱ, ԶƵбƵ̱߳ػ; մ洢ʱ, Ƶб뵽̱߳ػ
+		thread_local std::vector<float> lineBufferSS;
+		thread_local std::vector<float> lineBufferDD;
+		if (isSharded() || _dataSS.isCompact())
+		{
+			lineBufferSS.resize(FrgCommon::lattice().size);
+			lineBufferDD.resize(FrgCommon::lattice().size);
+		}
 
 		for (int i = 0; i < n; ++i)
 		{
 			float weight = accessBuffer.frequencyWeights[i];
 			float signedWeight = accessBuffer.signFlag[i] * accessBuffer.frequencyWeights[i];
-			int frequencyOffset = accessBuffer.frequencyOffsets[i];
+			int64_t frequencyOffset = accessBuffer.frequencyOffsets[i];
 			int size = FrgCommon::lattice().size;
 
-			for (int j = 0; j < size; ++j)
+			const float *dataSS;
+			const float *dataDD;
+			if (isSharded())
+			{
+				dataSS = _shardSS->line(frequencyOffset / size, lineBufferSS.data());
+				dataDD = _shardDD->line(frequencyOffset / size, lineBufferDD.data());
+			}
+			else if (accessBuffer.siteExchange && _exchangedValid)
+			{
+				dataSS = _exchangedSS.line(frequencyOffset, size, lineBufferSS.data());
+				dataDD = _exchangedDD.line(frequencyOffset, size, lineBufferDD.data());
+			}
+			else
+			{
+				dataSS = _dataSS.line(frequencyOffset, size, lineBufferSS.data());
+				dataDD = _dataDD.line(frequencyOffset, size, lineBufferDD.data());
+			}
+
+			if (contiguous)
 			{
-				superbundle.bundle(0)[j] += weight * _dataSS[frequencyOffset + sites[j].rid];
-				superbundle.bundle(1)[j] += signedWeight * _dataDD[frequencyOffset + sites[j].rid];
+				SimdKernels::apply<SimdKernels::Operation::MultAddScalar>(superbundle.bundle(0).data(), dataSS, static_cast<const float *>(nullptr), weight, size);
+				SimdKernels::apply<SimdKernels::Operation::MultAddScalar>(superbundle.bundle(1).data(), dataDD, static_cast<const float *>(nullptr), signedWeight, size);
+			}
+			else
+			{
+				for (int j = 0; j < size; ++j)
+				{
+					superbundle.bundle(0)[j] += weight * dataSS[invertedSites[j].rid];
+					superbundle.bundle(1)[j] += signedWeight * dataDD[invertedSites[j].rid];
+				}
 			}
 		}
 	}
@@ -600,8 +836,22 @@ public:
 		ASSERT(uOffset >= 0 && uOffset < FrgCommon::frequency().size);
 		ASSERT(sOffset >= uOffset);
 
-		if (symmetry == SU2VertexTwoParticle::Symmetry::Spin) return _dataSS[_memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset];
-		else return _dataDD[_memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset];
+		if (symmetry == SU2VertexTwoParticle::Symmetry::Spin) return _value(_dataSS, _shardSS, _memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset);
+		else return _value(_dataDD, _shardDD, _memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset);
+	}
+
+	/**
+	 * @brief ͨ [0,size) Χڵڴƫƶȡֵ, ֲʽ洢ʱԶֵȡ. 
+	 * 
+	 * @param data ض. 
+	 * @param shard ֲʽ, 㲻Ƿֲʽ洢Ϊ nullptr. 
+	 * @param offset ڴƫԪ. 
+	 * @return float ֵ. 
+	 */
+	float _value(const FloatArray &data, const ShardedArray *shard, const int64_t offset) const
+	{
+		if (shard == nullptr) return data.get(offset);
+		else return shard->value(offset);
 	}
 
 	/**
@@ -611,9 +861,9 @@ public:
 	 * @param[in] tOffset ڶƵƫƣԪ. 
 	 * @param[in] uOffset ƵƫƣԪ. 
 	 * @param[out] signFlag Ҫ洢ڷʻеķű־. 
-	 * @return int ڴƫԪ. 
+	 * @return int64_t ڴƫԪ. 
 	 */
-	int _generateAccessBufferOffset(const int sOffset, const int tOffset, const int uOffset, int &signFlag) const
+	int64_t _generateAccessBufferOffset(const int sOffset, const int tOffset, const int uOffset, int &signFlag) const
 	{
 		ASSERT(sOffset >= 0 && sOffset < FrgCommon::frequency().size);
 		ASSERT(tOffset >= 0 && tOffset < FrgCommon::frequency().size);
@@ -631,11 +881,20 @@ public:
 		}
 	}
 
-	int size; ///< ÿͨĶСԪ. 
-	int sizeFrequency; ///< ƵӿռÿͨĶСԪ. 
-
-	float *_dataSS; ///< ͨ. 
-	float *_dataDD; ///< ܶͨ. 
-	int _memoryStepLatticeT; ///<  2 άеڴ沽. 
-	int _memoryStepLattice; ///< һάڴ沽. 
+	int64_t size; ///< ÿͨĶСԪ. 
+	int64_t sizeFrequency; ///< ƵӿռÿͨĶСԪ. 
+	int64_t sizeLocal; ///< ǰ MPI ̱ش洢ڵ㹲洢ʱΪ޸ģÿͨĶСԪ. 
+	int64_t offsetLocal; ///< ش洢ĵһֵԵ. 
+
+	FloatArray _dataSS; ///< ͨ, ֲʽ洢ʱز. 
+	FloatArray _dataDD; ///< ܶͨ, ֲʽ洢ʱز. 
+	ShardedArray *_shardSS; ///< ֲʽ洢ͨ, 㲻Ƿֲʽ洢Ϊ nullptr. 
+	ShardedArray *_shardDD; ///< ֲʽ洢ܶͨ, 㲻Ƿֲʽ洢Ϊ nullptr. 
+	NodeSharedArray *_sharedSS; ///< ڵ㹲洢ͨ, 㲻ǽڵ㹲洢Ϊ nullptr. 
+	NodeSharedArray *_sharedDD; ///< ڵ㹲洢ܶͨ, 㲻ǽڵ㹲洢Ϊ nullptr. 
+	FloatArray _exchangedSS; ///< λ㽻ͨ, δΪ. 
+	FloatArray _exchangedDD; ///< λ㽻ܶͨ, δΪ. 
+	bool _exchangedValid; ///< λ㽻ĸǷ뵱ǰֵһ. 
+	int64_t _memoryStepLatticeT; ///<  2 άеڴ沽. 
+	int64_t _memoryStepLattice; ///< һάڴ沽. 
 };
\ No newline at end of file
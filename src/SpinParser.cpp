@@ -6,11 +6,14 @@
  * @copyright Copyright (c) 2020
  */
 
+#include <deque>
 #include <boost/filesystem.hpp>
 #include "SpinParser.hpp"
 #include "CommandLineOptions.hpp"
 #include "TaskFileParser.hpp"
 #include "FrgCore.hpp"
+#include "FlowIntegrator.hpp"
+#include "BreakdownMonitor.hpp"
 #ifndef DISABLE_MPI
 #include "mpi.h"
 #endif
@@ -41,11 +44,24 @@ SpinParser::SpinParser()
 	_taskFileParser = nullptr;
 	_loadManager = HMP::newLoadManager();
 	_frgCore = nullptr;
+	_flowIntegrator = nullptr;
+	_breakdownMonitor = nullptr;
+	_coarsePass = nullptr;
 }
 
 SpinParser::~SpinParser()
 {
 	delete _commandLineOptions;
+	delete _flowIntegrator;
+	delete _breakdownMonitor;
+	if (_coarsePass != nullptr)
+	{
+		delete _coarsePass->frgCore;
+		delete _coarsePass->breakdownMonitor;
+		delete _coarsePass->frequency;
+		delete _coarsePass->cutoff;
+		delete _coarsePass;
+	}
 	delete _frgCore;
 }
 #pragma endregion
@@ -70,7 +86,7 @@ int SpinParser::run(int argc, char **argv)
 		_fileset.checkpointFile = boost::filesystem::path(_fileset.taskFile).replace_extension("checkpoint").string();
 
 		//ͨļ FrgCore
-		_taskFileParser = new TaskFileParser(_fileset.taskFile, FrgCommon::_frequency, FrgCommon::_cutoff, FrgCommon::_lattice, _frgCore, _computationStatus);
+		_taskFileParser = new TaskFileParser(_fileset.taskFile, FrgCommon::_frequency, FrgCommon::_cutoff, FrgCommon::_lattice, _frgCore, _computationStatus, _breakdownMonitor, _coarsePass);
 
 		//ֹͣ
 		if (_commandLineOptions->debugLattice())
@@ -128,23 +144,27 @@ void SpinParser::runCore()
 	//ȡǷΪѾڼ,Ҫ֮ǰļĻ,ȡ¼
 	if (_computationStatus.statusIdentifier == ComputationStatus::Identifier::New || _computationStatus.statusIdentifier == ComputationStatus::Identifier::Running)
 	{
-		CutoffIterator cutoff = FrgCommon::cutoff().begin();//ضֵ
+		//ڴԤ(¼)
+		if (_coarsePass != nullptr) runCoarsePass();
+
+		_flowIntegrator = new FlowIntegrator(_frgCore);
 		if (_computationStatus.statusIdentifier == ComputationStatus::Identifier::Running)
 		{
 			_frgCore->_flowingFunctional->readCheckpoint(_fileset.checkpointFile);
-			cutoff = FrgCommon::cutoff().find(_frgCore->_flowingFunctional->cutoff);
+			if (_isMasterRank) _flowIntegrator->readCheckpoint(_fileset.checkpointFile);
 		}
+		_flowIntegrator->initialize();
 
 		//м
 		//¼ʼʱ
 		if (_computationStatus.statusIdentifier == ComputationStatus::Identifier::New) _computationStatus.startTime = Timestamp::time();
 		_computationStatus.checkpointTime = Timestamp::time();
 		//ʼԽضϽе
-		while (cutoff != FrgCommon::cutoff().last())
+		while (!_flowIntegrator->isFinished())
 		{
-			//Ͳ
+			//Ͳ(ӦֲµĽֵֹ)
 			Log::log << Log::LogLevel::Debug << "ʼ." << Log::endl;
-			_frgCore->computeStep();
+			if (_flowIntegrator->requiresFlow()) _frgCore->computeStep();
 			Log::log << Log::LogLevel::Debug << "ʼֵ." << Log::endl;
 			_frgCore->takeMeasurements();
 
@@ -157,11 +177,27 @@ void SpinParser::runCore()
 			}
 
 			//ִлֲ
-			++cutoff;
-			_frgCore->finalizeStep(*cutoff);
+			_flowIntegrator->step();
 
 			//ӡȲд
 			Log::log << Log::LogLevel::Info << "ǰʱĽض(cutoff) " << std::fixed << std::setprecision(6) << _frgCore->_flowingFunctional->cutoff << Log::endl;
+
+			//Ƿ
+			if (_breakdownMonitor != nullptr && std::isnan(_computationStatus.breakdownCutoff))
+			{
+				bool isBreakdown = _breakdownMonitor->update(*_frgCore->_flowingFunctional);
+				Log::log << Log::LogLevel::Debug << "㷶Ķ " << _breakdownMonitor->growthRate() << Log::endl;
+				if (isBreakdown)
+				{
+					_computationStatus.breakdownCutoff = _breakdownMonitor->breakdownCutoff();
+					Log::log << Log::LogLevel::Info << "⵽,ֵֹΪ " << std::fixed << std::setprecision(6) << _computationStatus.breakdownCutoff << "." << Log::endl;
+					if (_breakdownMonitor->terminate())
+					{
+						Log::log << Log::LogLevel::Info << "ѱ.ֹͣ." << Log::endl;
+						break;
+					}
+				}
+			}
 			if (Timestamp::isOlder(_computationStatus.checkpointTime, _commandLineOptions->checkpointTime()))
 			{
 				_computationStatus.checkpointTime = Timestamp::time();
@@ -211,12 +247,98 @@ void SpinParser::runCore()
 
 }
 
+void SpinParser::runCoarsePass()
+{
+	Log::log << Log::LogLevel::Info << "ʼԤ." << Log::endl;
+	FrgCore *core = _coarsePass->frgCore;
+
+	//Ԥڼʹô
+	std::swap(FrgCommon::_frequency, _coarsePass->frequency);
+	std::swap(FrgCommon::_cutoff, _coarsePass->cutoff);
+
+	//¼Ŀ,ֵֹ
+	std::deque<std::pair<float, std::vector<float>>> snapshots;
+	auto takeSnapshot = [&]()
+	{
+		std::vector<float> data;
+		for (const auto &b : core->_flowingFunctional->getDataBundles())
+		{
+			data.resize(data.size() + b.size());
+			b.read(0, b.size(), data.data() + data.size() - b.size());
+		}
+		snapshots.push_back(std::make_pair(core->_flowingFunctional->cutoff, data));
+	};
+
+	//ֱ⵽
+	FlowIntegrator integrator(core);
+	integrator.initialize();
+	takeSnapshot();
+	float breakdownCutoff = NAN;
+	while (!integrator.isFinished())
+	{
+		if (integrator.requiresFlow()) core->computeStep();
+		integrator.step();
+		Log::log << Log::LogLevel::Debug << "ԤеĽض(cutoff) " << std::fixed << std::setprecision(6) << core->_flowingFunctional->cutoff << Log::endl;
+
+		//ɢһ״̬
+		if (core->_flowingFunctional->isDiverged())
+		{
+			breakdownCutoff = snapshots.back().first;
+			break;
+		}
+
+		bool isBreakdown = _coarsePass->breakdownMonitor->update(*core->_flowingFunctional);
+		takeSnapshot();
+		if (isBreakdown)
+		{
+			breakdownCutoff = _coarsePass->breakdownMonitor->breakdownCutoff();
+			break;
+		}
+
+		//ֵֹڵǰֵʵĽֵֹ,˿ԶٿܳΪϸĿ
+		while (snapshots.size() > 1 && snapshots[1].first >= _coarsePass->window * _coarsePass->breakdownMonitor->peakCutoff()) snapshots.pop_front();
+	}
+
+	//ָϸ
+	std::swap(FrgCommon::_frequency, _coarsePass->frequency);
+	std::swap(FrgCommon::_cutoff, _coarsePass->cutoff);
+
+	if (std::isnan(breakdownCutoff)) Log::log << Log::LogLevel::Info << "Ԥδ⵽.ϸӳʼֵֹʼ." << Log::endl;
+	else
+	{
+		Log::log << Log::LogLevel::Info << "Ԥм⵽,ֵֹΪ " << std::fixed << std::setprecision(6) << breakdownCutoff << "." << Log::endl;
+
+		//ѡֵֹ window * breakdownCutoff һ
+		auto snapshot = snapshots.begin();
+		for (auto i = snapshots.begin(); i != snapshots.end(); ++i) if (i->first >= _coarsePass->window * breakdownCutoff) snapshot = i;
+
+		//ղֵϸ
+		if (snapshot->first < *FrgCommon::cutoff().begin())
+		{
+			const float *data = snapshot->second.data();
+			for (auto &b : core->_flowingFunctional->getDataBundles())
+			{
+				b.write(0, b.size(), data);
+				data += b.size();
+			}
+			core->_flowingFunctional->cutoff = snapshot->first;
+			_frgCore->_flowingFunctional->regrid(*core->_flowingFunctional, *_coarsePass->frequency);
+			Log::log << Log::LogLevel::Info << "ϸӽֵֹ " << std::fixed << std::setprecision(6) << _frgCore->_flowingFunctional->cutoff << " ʼ." << Log::endl;
+		}
+	}
+
+	//ͷŴ
+	delete _coarsePass->frgCore;
+	_coarsePass->frgCore = nullptr;
+}
+
 void SpinParser::writeCheckpoint()
 {
 	if (_isMasterRank)
 	{
 		Log::log << Log::LogLevel::Info << "д." << Log::endl;
-		_frgCore->_flowingFunctional->writeCheckpoint(_fileset.checkpointFile);
+		int checkpointId = _frgCore->_flowingFunctional->writeCheckpoint(_fileset.checkpointFile);
+		if (_flowIntegrator != nullptr && checkpointId >= 0) _flowIntegrator->writeCheckpoint(_fileset.checkpointFile, checkpointId);
 		_taskFileParser->writeTaskFile(_computationStatus);
 	}
 }
\ No newline at end of file
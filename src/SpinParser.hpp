@@ -16,6 +16,8 @@
 #include "TaskFileParser.hpp"
 
 class FrgCore;
+class FlowIntegrator;
+struct BreakdownMonitor;
 
 /**
  * @brief ״̬.
@@ -37,6 +39,7 @@ struct ComputationStatus
 	Timestamp::Time startTime; ///< 㿪ʼʱ. 
 	Timestamp::Time checkpointTime; ///< ϴμʱ. 
 	Timestamp::Time endTime; ///< ʱ. 
+	float breakdownCutoff; ///< ⵽ʱĽֵֹ.δ⵽,Ϊ NaN. 
 };
 
 struct Fileset
@@ -47,6 +50,20 @@ struct Fileset
 	std::string checkpointFile; ///< ļ·. 
 };
 
+/**
+ * @brief Ԥе. 
+ * @details ھϸ֮ǰ,ԽٵƵʺͽֵֹ,ȷλ. 
+ * ϸӱֵֹ֮ϵĴ״̬ʼ,״ֵ̬ͨתƵϸƵ. 
+ */
+struct CoarsePass
+{
+	FrequencyDiscretization *frequency; ///< ԭƵɢ. 
+	CutoffDiscretization *cutoff; ///< ֹֽɢ. 
+	FrgCore *frgCore; ///< ڴе FRG . 
+	BreakdownMonitor *breakdownMonitor; ///< Ԥе. 
+	float window; ///< ϸʼֵֵֹֹ֮ȵ. 
+};
+
 /**
  * @brief pf-FRGҪͽӿ. 
  * @details SpinParser Ϊ pf-FRG ṩĽӿ. 
@@ -136,6 +153,11 @@ protected:
 	 */
 	void runCore();
 
+	/**
+	 * @brief ڴԤ,ֵֹ֮ϵֵϸ,Ϊϸ. 
+	 */
+	void runCoarsePass();
+
 	/**
 	 * @brief ǰ״̬дļ. 
 	 */
@@ -150,4 +172,7 @@ protected:
 	TaskFileParser *_taskFileParser; ///< ڲļ. 
 	HMP::LoadManager *_loadManager; ///< ڲع. 
 	FrgCore *_frgCore; ///< ڲֺ. 
+	FlowIntegrator *_flowIntegrator; ///< ڲ΢ַ. 
+	BreakdownMonitor *_breakdownMonitor; ///< ڲ. 
+	CoarsePass *_coarsePass; ///< Ԥ,ļδָΪ nullptr. 
 };
\ No newline at end of file
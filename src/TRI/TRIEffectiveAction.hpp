@@ -21,11 +21,14 @@ struct TRIEffectiveAction : public EffectiveAction
 public:
 	/**
 	 * @brief һµ TRIEffective Action . 
+	 * 
+	 * @param format ӶĴ洢ʽ. 
 	 */
-	TRIEffectiveAction()
+	TRIEffectiveAction(const FloatFormat format = FloatFormat::Float32)
 	{
+		vertexFormat = format;
 		vertexSingleParticle = new TRIVertexSingleParticle;
-		vertexTwoParticle = new TRIVertexTwoParticle;
+		vertexTwoParticle = new TRIVertexTwoParticle(format);
 	}
 
 	/**
@@ -37,27 +40,29 @@ public:
 	 */
 	TRIEffectiveAction(const float cutoff, const SpinModel &spinModel, const TRIFrgCore *core)
 	{
+		vertexFormat = core->vertexFormat;
 		vertexSingleParticle = new TRIVertexSingleParticle;
-		vertexTwoParticle = new TRIVertexTwoParticle;
+		vertexTwoParticle = new TRIVertexTwoParticle(core->vertexFormat);
 
-		//set initial value
+		//set initial value; the initial value does not depend on frequency, so interactions are written directly to their lattice sites for each frequency
 		this->cutoff = cutoff;
 
-		for (int linearIterator = 0; linearIterator < vertexTwoParticle->size; ++linearIterator)
+		int latticeSize = FrgCommon::lattice().size;
+		for (int64_t frequencyIterator = 0; frequencyIterator < vertexTwoParticle->sizeFrequency; ++frequencyIterator)
 		{
-			float s, t, u;
-			LatticeIterator i1;
-			SpinComponent s1, s2;
-			vertexTwoParticle->expandIterator(linearIterator, i1, s, t, u, s1, s2);
-
-			//skip initial conditions for density and spin/density interactions
-			if (static_cast<int>(s1) == 3 || static_cast<int>(s2) == 3) continue;
-			//set initial conditions for spin/spin interactions
-			for (auto i : spinModel.interactions)
+			//set initial conditions for spin/spin interactions, skip density and spin/density interactions
+			for (int s1 = 0; s1 < 3; ++s1)
 			{
-				if (i.first == i1)
+				for (int s2 = 0; s2 < 3; ++s2)
 				{
-					vertexTwoParticle->getValueRef(linearIterator) += 0.25f * i.second.interactionStrength[static_cast<int>(s1)][static_cast<int>(s2)] / core->normalization;
+					for (auto i : spinModel.interactions)
+					{
+						int rid = i.first - FrgCommon::lattice().begin();
+						if (rid < 0 || rid >= latticeSize) continue;
+
+						int64_t linearIterator = ((frequencyIterator * 4 + s1) * 4 + s2) * latticeSize + rid;
+						vertexTwoParticle->getValueRef(linearIterator) += 0.25f * i.second.interactionStrength[s1][s2] / core->normalization;
+					}
 				}
 			}
 		}
@@ -132,19 +137,30 @@ public:
 		H5Sclose(attrSpace);
 
 		//write vertex data
-		auto writeCheckpointDataset = [&group](const std::string &identifier, const int size, const float *data)
+		auto writeCheckpointDataset = [&group](const std::string &identifier, const int64_t size, const void *data, const hid_t memoryType, const hid_t fileType)
 		{
 			const int dataSpaceDim = 1;
 			const hsize_t dataSpaceSize[1] = { (hsize_t)size };
 			hid_t dataSpace = H5Screate_simple(dataSpaceDim, dataSpaceSize, NULL);
-			hid_t dataset = H5Dcreate(group, identifier.c_str(), H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-			H5Dwrite(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			hid_t dataset = H5Dcreate(group, identifier.c_str(), fileType, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+			H5Dwrite(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
 			H5Dclose(dataset);
 			H5Sclose(dataSpace);
 		};
-		writeCheckpointDataset("cutoff", 1, &cutoff);
-		writeCheckpointDataset("v2", vertexSingleParticle->size, vertexSingleParticle->_data);
-		writeCheckpointDataset("v4", vertexTwoParticle->size, vertexTwoParticle->_data);
+		auto writeVertexCheckpointDataset = [&writeCheckpointDataset](const std::string &identifier, const FloatArray &data, const hid_t fileType)
+		{
+			//compactly stored vertices are written directly in their storage format
+			hid_t memoryType = checkpointDatatype(data.format());
+			if (data.isCompact()) writeCheckpointDataset(identifier, data.size(), data.compactData(), memoryType, fileType);
+			else writeCheckpointDataset(identifier, data.size(), data.data(), memoryType, fileType);
+			H5Tclose(memoryType);
+		};
+		hid_t vertexType = checkpointDatatype(vertexFormat);
+		writeCheckpointDataset("cutoff", 1, &cutoff, H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT);
+		writeCheckpointDataset("v2", vertexSingleParticle->size, vertexSingleParticle->_data, H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT);
+		writeVertexCheckpointDataset("v4", vertexTwoParticle->_data, vertexType);
+		H5Tclose(vertexType);
+		writeFrequencyMesh(group);
 
 		//clean up and return
 		H5Gclose(group);
@@ -187,18 +203,35 @@ public:
 		hid_t group = H5Gopen(file, checkpointName.c_str(), H5P_DEFAULT);
 		if (group < 0) return false;
 
+		//ڲͬԭƵ,ֵǰ
+		std::vector<float> mesh = readFrequencyMesh(group);
+		if (!isCurrentFrequencyMesh(mesh))
+		{
+			H5Gclose(group);
+			H5Fclose(file);
+			return readRegriddedCheckpoint<TRIEffectiveAction>(dataFilePath, checkpointId, mesh);
+		}
+
 		//read dataset
-		auto readDataset = [&group](const std::string &name, float *data)->bool
+		auto readDataset = [&group](const std::string &name, void *data, const hid_t memoryType)->bool
 		{
 			hid_t dataset = H5Dopen(group, name.c_str(), H5P_DEFAULT);
 			if (dataset < 0) return false;
-			H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			H5Dread(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
 			H5Dclose(dataset);
 			return true;
 		};
-		if (!readDataset("cutoff", &cutoff)) return false;
-		if (!readDataset("v2", vertexSingleParticle->_data)) return false;
-		if (!readDataset("v4", vertexTwoParticle->_data)) return false;
+		auto readVertexDataset = [&readDataset](const std::string &name, const FloatArray &data)->bool
+		{
+			//for compactly stored vertices, HDF5 converts the dataset to the storage format
+			hid_t memoryType = checkpointDatatype(data.format());
+			bool success = (data.isCompact()) ? readDataset(name, data.compactData(), memoryType) : readDataset(name, data.data(), memoryType);
+			H5Tclose(memoryType);
+			return success;
+		};
+		if (!readDataset("cutoff", &cutoff, H5T_NATIVE_FLOAT)) return false;
+		if (!readDataset("v2", vertexSingleParticle->_data, H5T_NATIVE_FLOAT)) return false;
+		if (!readVertexDataset("v4", vertexTwoParticle->_data)) return false;
 
 		//clean up and return
 		H5Gclose(group);
@@ -207,23 +240,59 @@ public:
 	}
 
 	/**
-	 * @brief Indicate whether the vertex has diverged to NaN. 
+	 * @brief жб. 
 	 *
-	 * @return bool Return true if the vertex has diverged, otherwise return false. 
+	 * @return std::vector<FloatArray> б. 
 	 */
-	bool isDiverged() const override
+	std::vector<FloatArray> getDataBundles() const override
 	{
-		for (int i = 0; i < vertexSingleParticle->size; ++i)
-		{
-			if (std::isnan(vertexSingleParticle->getValueRef(i))) return true;
-		}
+		return {
+			FloatArray(vertexSingleParticle->_data, vertexSingleParticle->size),
+			vertexTwoParticle->_data
+		};
+	}
 
-		for (int i = 0; i < vertexTwoParticle->size; ++i)
+	/**
+	 * @brief ֵͨһƵϵЧתƵǰƵ. 
+	 * @details ֵͨ TRIVertexSingleParticle::getValue()  TRIVertexTwoParticle::getValue() Դϲֵõ. 
+	 * 
+	 * @param source ԴЧ, TRIEffectiveAction. 
+	 * @param sourceFrequency ԴЧڵԭƵɢ. 
+	 */
+	void regrid(const EffectiveAction &source, FrequencyDiscretization &sourceFrequency) override
+	{
+		const TRIEffectiveAction &sourceAction = static_cast<const TRIEffectiveAction &>(source);
+		cutoff = source.cutoff;
+
+		//ĿչƵʲ
+		std::vector<float> w(vertexSingleParticle->size);
+		for (int i = 0; i < vertexSingleParticle->size; ++i) vertexSingleParticle->expandIterator(i, w[i]);
+
+		std::vector<float> s(vertexTwoParticle->sizeFrequency), t(vertexTwoParticle->sizeFrequency), u(vertexTwoParticle->sizeFrequency);
+		vertexTwoParticle->expandIterators(0, vertexTwoParticle->sizeFrequency, s.data(), t.data(), u.data());
+
+		//Դϲֵ
+		FrequencyScope scope(sourceFrequency);
+		for (int i = 0; i < vertexSingleParticle->size; ++i) vertexSingleParticle->getValueRef(i) = sourceAction.vertexSingleParticle->getValue(w[i]);
+
+		int latticeSize = FrgCommon::lattice().size;
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(dynamic)
+		#endif
+		for (int64_t i = 0; i < vertexTwoParticle->sizeFrequency; ++i)
 		{
-			if (std::isnan(vertexTwoParticle->getValueRef(i))) return true;
+			for (int s1 = 0; s1 < 4; ++s1)
+			{
+				for (int s2 = 0; s2 < 4; ++s2)
+				{
+					for (int j = 0; j < latticeSize; ++j)
+					{
+						LatticeIterator i1 = FrgCommon::lattice().fromParametrization(j);
+						vertexTwoParticle->getValueRef(((i * 4 + s1) * 4 + s2) * latticeSize + j) = sourceAction.vertexTwoParticle->getValue(i1, FrgCommon::lattice().zero(), s[i], t[i], u[i], static_cast<SpinComponent>(s1), static_cast<SpinComponent>(s2), TRIVertexTwoParticle::FrequencyChannel::None);
+					}
+				}
+			}
 		}
-
-		return false;
 	}
 
 	TRIVertexSingleParticle *vertexSingleParticle; ///< Single-particle vertex data. 
@@ -8,6 +8,7 @@
 
 #pragma once
 #include "FrgCore.hpp"
+#include "PropagatorCache.hpp"
 
 /**
  * @brief ʱ䷴תģ͵ FrgCore ʵ.
@@ -41,7 +42,14 @@ public:
 	 */
 	void finalizeStep(const float newCutoff) override;
 
+	/**
+	 * @brief 㲥 MPI . 
+	 */
+	void synchronizeFlowingFunctional() override;
+
 	float normalization; ///< һ. 
+	FloatFormat vertexFormat; ///< ӶĴ洢ʽ. 
+	PropagatorCache propagatorCache; ///< ǰֵֹµĴӻ,ÿ蹹һ. 
 
 private:
 	int dataStacks[6]; ///< LoadManager::DataStack . 
@@ -58,5 +66,5 @@ private:
 	 * 
 	 * @param iterator Ե. 
 	 */
-	void _calculateVertexTwoParticle(const int iterator);
+	void _calculateVertexTwoParticle(const int64_t iterator);
 };
\ No newline at end of file
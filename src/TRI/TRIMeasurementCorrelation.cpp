@@ -127,7 +127,13 @@ TRIMeasurementCorrelation::~TRIMeasurementCorrelation()
 
 void TRIMeasurementCorrelation::takeMeasurement(const EffectiveAction &state, const bool isMasterTask) const
 {
-	if (_currentCutoff != state.cutoff) SpinParser::spinParser()->getLoadManager()->calculate(_loadManagedStacks.data(), int(_loadManagedStacks.size()));
+	if (_currentCutoff != state.cutoff)
+	{
+		//ûǰ½(һ֮),Ϊǰ״̬¹ӻ
+		TRIFrgCore *core = static_cast<TRIFrgCore *>(SpinParser::spinParser()->getFrgCore());
+		core->propagatorCache.update(state.cutoff, static_cast<const TRIEffectiveAction &>(state).vertexSingleParticle->_data, static_cast<TRIEffectiveAction *>(core->flow())->vertexSingleParticle->_data);
+		SpinParser::spinParser()->getLoadManager()->calculate(_loadManagedStacks.data(), int(_loadManagedStacks.size()));
+	}
 
 	if (isMasterTask)
 	{
@@ -149,30 +155,34 @@ void TRIMeasurementCorrelation::_calculateCorrelation(const int iterator) const
 	//calculate real space susceptibility
 	float nu = 0.0f;
 	float cut = SpinParser::spinParser()->getFrgCore()->flowingFunctional()->cutoff;
-	TRIVertexSingleParticle *v2 = static_cast<TRIEffectiveAction *>(SpinParser::spinParser()->getFrgCore()->flowingFunctional())->vertexSingleParticle;
+	const PropagatorCache &propagatorCache = static_cast<TRIFrgCore *>(SpinParser::spinParser()->getFrgCore())->propagatorCache;
 	TRIVertexTwoParticle *v4 = static_cast<TRIEffectiveAction *>(SpinParser::spinParser()->getFrgCore()->flowingFunctional())->vertexTwoParticle;
 
-	ValueSuperbundle<float, 16> susceptibility(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 16> stackBuffer(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 16> buffer1(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 16> buffer2(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 16> buffer3(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 16> buffer4(FrgCommon::lattice().size);
+	//ֲ߳̾ݴ仺ʱͳһͷ
+	ScratchArena &scratch = ScratchArena::local();
+	ScratchArena::Scope scratchScope(scratch);
+
+	ValueSuperbundle<float, 16> susceptibility(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 16> stackBuffer(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 16> buffer1(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 16> buffer2(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 16> buffer3(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 16> buffer4(FrgCommon::lattice().size, scratch);
 
 	//integration kernel
-	std::function<void(float, ValueSuperbundle<float, 16> &)> integralKernel = [&](const float w, ValueSuperbundle<float, 16> &returnBuffer) -> void
+	auto integralKernel = [&](const float w, ValueSuperbundle<float, 16> &returnBuffer) -> void
 	{
 		returnBuffer.reset();
 
 		//term1
-		float term1 = 1.0f / ((w + v2->getValue(w)) * (w + nu + v2->getValue(w + nu)));
+		float term1 = propagatorCache.propagator(w, w + nu);
 		returnBuffer.bundle(15)[0] += 2.0f * term1 / float(2.0f * M_PI);
 		returnBuffer.bundle(0)[0] += 0.5f * term1 / float(2.0f * M_PI);
 		returnBuffer.bundle(5)[0] += 0.5f * term1 / float(2.0f * M_PI);
 		returnBuffer.bundle(10)[0] += 0.5f * term1 / float(2.0f * M_PI);
 
 		//term2
-		std::function<void(float, ValueSuperbundle<float, 16> &)> innerKernel = [&](const float wp, ValueSuperbundle<float, 16> &ret) -> void
+		auto innerKernel = [&](const float wp, ValueSuperbundle<float, 16> &ret) -> void
 		{
 			ret.reset();
 			const TRIVertexTwoParticleAccessBuffer<8> ab0 = v4->generateAccessBuffer(w + wp + nu, nu, w - wp);
@@ -250,41 +260,13 @@ void TRIMeasurementCorrelation::_calculateCorrelation(const int iterator) const
 			ret.bundle(10)[0] -= 0.5f * vyy;
 			ret.bundle(10)[0] -= 0.5f * vxx;
 
-			float normalization = 1.0f / ((w + v2->getValue(w)) * (w + nu + v2->getValue(w + nu)) * (wp + v2->getValue(wp)) * (wp + nu + v2->getValue(wp + nu)) * float(4.0f * M_PI * M_PI));
+			float normalization = 1.0f / (propagatorCache.denominator(w) * propagatorCache.denominator(w + nu) * propagatorCache.denominator(wp) * propagatorCache.denominator(wp + nu) * float(4.0f * M_PI * M_PI));
 			ret *= normalization;
 		};
-		if (-(nu + cut) > *FrgCommon::frequency().beginNegative())
-		{
-			ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -cut - nu, innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
-		if (nu - cut > cut)
-		{
-			ImplicitIntegrator::integrateWithObscureBoundaries(-nu + cut, -cut, innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
-		if (cut < *FrgCommon::frequency().last())
-		{
-			ImplicitIntegrator::integrateWithObscureLeftBoundary(cut, FrgCommon::frequency().last(), innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
+		ImplicitIntegrator::integrateOutsideCutoff(nu, cut, innerKernel, buffer3, buffer4, returnBuffer);
 	};
 
-	if (-(nu + cut) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -cut - nu, integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
-	if (nu - cut > cut)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(-nu + cut, -cut, integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
-	if (cut < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cut, FrgCommon::frequency().last(), integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
+	ImplicitIntegrator::integrateOutsideCutoff(nu, cut, integralKernel, buffer1, buffer2, susceptibility);
 
 	int offset = iterator * _memoryStepLattice;
 	for (auto i = FrgCommon::lattice().getBasis(); i != FrgCommon::lattice().end(); ++i)
@@ -8,7 +8,10 @@
 
 #pragma once
 #include <istream>
+#include <cstdint>
+#include <vector>
 #include "lib/ValueBundle.hpp"
+#include "lib/FloatArray.hpp"
 #include "lib/Assert.hpp"
 #include "FrgCommon.hpp"
 
@@ -32,7 +35,7 @@ public:
 		for (int i = 0; i < 16 * size; ++i) (&sign[0][0][0])[i] = 1.0f;
 	}
 
-	int frequencyOffsets[size]; ///< Linear memory offset (number of elements) in the frequency dimensions of the two-particle vertex.  
+	int64_t frequencyOffsets[size]; ///< Linear memory offset (number of elements) in the frequency dimensions of the two-particle vertex.  
 	float frequencyWeights[size]; ///< Weight factors of the support values. 
 	float sign[size][4][4]; ///< Sign factors of the support values. 
 	bool pairExchange; ///< Site exchange indicator. 
@@ -58,8 +61,11 @@ public:
 
 	/**
 	 * @brief Construct a new TRIVertexTwoParticle object and initialize all entries to zero. 
+	 * @details If a 16 bit storage format is specified, vertex values are stored compactly in that format and decoded to single precision upon access. 
+	 * 
+	 * @param format Storage format of the vertex values. 
 	 */
-	TRIVertexTwoParticle()
+	TRIVertexTwoParticle(const FloatFormat format = FloatFormat::Float32)
 	{
 		//store width in all memory dimensions
 		_memoryStep[3] = FrgCommon::lattice().size;
@@ -67,12 +73,13 @@ public:
 		_memoryStep[1] = 4 * _memoryStep[2];
 		_memoryStep[0] = FrgCommon::frequency().size * _memoryStep[1];
 
-		sizeFrequency = FrgCommon::frequency().size * FrgCommon::frequency().size * (FrgCommon::frequency().size + 1) / 2;
+		sizeFrequency = int64_t(FrgCommon::frequency().size) * FrgCommon::frequency().size * (FrgCommon::frequency().size + 1) / 2;
 		size = 16 * FrgCommon::lattice().size * sizeFrequency;
 
 		//alloc and init memory
-		_data = new float[size];
-		memset(_data, 0, sizeof(float) * size);
+		_data = FloatArray::allocate(size, format);
+
+		_exchangedValid = false;
 	}
 
 	/**
@@ -80,7 +87,48 @@ public:
 	 */
 	~TRIVertexTwoParticle()
 	{
-		delete[] _data;
+		_data.release();
+		_exchanged.release();
+	}
+
+	/**
+	 * @brief Allocate a contiguous copy of the pair-exchanged and spin-permuted vertex, such that getValueSuperbundle() reads vertex values as unit-stride streams also upon pair exchange. 
+	 * @details The copy is valid after a call to updateExchangedCopy() until invalidateExchangedCopy() is called or vertex values are modified. The copy is stored in the storage format of the vertex and doubles its memory footprint. 
+	 */
+	void enableExchangedCopy()
+	{
+		if (hasExchangedCopy()) return;
+		_exchanged = FloatArray::allocate(size, _data.format());
+		_exchangedValid = false;
+	}
+
+	/**
+	 * @brief Check whether a copy of the pair-exchanged vertex has been allocated. 
+	 * 
+	 * @return bool True if enableExchangedCopy() has been called. 
+	 */
+	bool hasExchangedCopy() const
+	{
+		return _exchanged.size() > 0;
+	}
+
+	/**
+	 * @brief Update the copy of the pair-exchanged vertex from the current vertex values. The values of each frequency line are reordered according to the inverted site table, with exchanged and permuted spin components. Does nothing if no copy has been allocated. 
+	 */
+	void updateExchangedCopy()
+	{
+		if (!hasExchangedCopy()) return;
+		if (_data.isCompact()) _updateExchangedCopy(_data.compactData(), _exchanged.compactData());
+		else _updateExchangedCopy(_data.data(), _exchanged.data());
+		_exchangedValid = true;
+	}
+
+	/**
+	 * @brief Mark the copy of the pair-exchanged vertex as invalid. Subsequently, getValueSuperbundle() reads pair-exchanged values via the inverted site table again. 
+	 */
+	void invalidateExchangedCopy()
+	{
+		_exchangedValid = false;
 	}
 
 	/**
@@ -94,7 +142,7 @@ public:
 	 * @param[out] s1 First vertex channel. 
 	 * @param[out] s2 Second vertex channel. 
 	 */
-	void expandIterator(int iterator, LatticeIterator &i1, float &s, float &t, float &u, SpinComponent &s1, SpinComponent &s2) const
+	void expandIterator(int64_t iterator, LatticeIterator &i1, float &s, float &t, float &u, SpinComponent &s1, SpinComponent &s2) const
 	{
 		ASSERT(iterator >= 0 && iterator < size);
 		ASSERT(&s != &t);
@@ -102,30 +150,22 @@ public:
 		ASSERT(&s != &u);
 		ASSERT(&s1 != &s2);
 
-		int it = iterator;
+		int64_t it = iterator;
 
-		int su = it / _memoryStep[0];
+		int su = int(it / _memoryStep[0]);
 		it = it % _memoryStep[0];
 		t = FrgCommon::frequency()._data[it / _memoryStep[1]];
 		it = it % _memoryStep[1];
-		s1 = static_cast<SpinComponent>(it / _memoryStep[2]);
+		s1 = static_cast<SpinComponent>(int(it / _memoryStep[2]));
 		it = it % _memoryStep[2];
-		s2 = static_cast<SpinComponent>(it / _memoryStep[3]);
+		s2 = static_cast<SpinComponent>(int(it / _memoryStep[3]));
 		it = it % _memoryStep[3];
-		i1 = FrgCommon::lattice().fromParametrization(it);
+		i1 = FrgCommon::lattice().fromParametrization(int(it));
 
-		for (int so = 0; so <= su; ++so)
-		{
-			for (int uo = 0; uo <= so; ++uo)
-			{
-				if (su == so * (so + 1) / 2 + uo)
-				{
-					s = FrgCommon::frequency()._data[so];
-					u = FrgCommon::frequency()._data[uo];
-					return;
-				}
-			}
-		}
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(su, so, uo);
+		s = FrgCommon::frequency()._data[so];
+		u = FrgCommon::frequency()._data[uo];
 	}
 
 	/**
@@ -136,7 +176,7 @@ public:
 	 * @param[out] t Second frequency argument. 
 	 * @param[out] u Third frequency argument. 
 	 */
-	void expandIterator(int iterator, float &s, float &t, float &u) const
+	void expandIterator(int64_t iterator, float &s, float &t, float &u) const
 	{
 		ASSERT(iterator >= 0 && iterator < sizeFrequency);
 		ASSERT(iterator >= 0 && iterator < size);
@@ -144,18 +184,51 @@ public:
 		ASSERT(&t != &u);
 		ASSERT(&s != &u);
 
-		int su = iterator / FrgCommon::frequency().size;
+		int su = int(iterator / FrgCommon::frequency().size);
 		t = FrgCommon::frequency()._data[iterator % FrgCommon::frequency().size];
 
-		for (int so = 0; so <= su; ++so)
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(su, so, uo);
+		s = FrgCommon::frequency()._data[so];
+		u = FrgCommon::frequency()._data[uo];
+	}
+
+	/**
+	 * @brief Expand a contiguous range [begin,end) of linear iterators in the range [0,sizeFrequency) that iterate over all parametrized frequency values. 
+	 * @details The frequency arguments are advanced incrementally, such that the cost per iterator is constant. 
+	 * Within each frequency value, the lattice site is the fastest running memory dimension. 
+	 * 
+	 * @param[in] begin First linear iterator. 
+	 * @param[in] end Linear iterator past the last expanded iterator. 
+	 * @param[out] s First frequency arguments. Must provide space for end-begin values. 
+	 * @param[out] t Second frequency arguments. Must provide space for end-begin values. 
+	 * @param[out] u Third frequency arguments. Must provide space for end-begin values. 
+	 */
+	void expandIterators(const int64_t begin, const int64_t end, float *s, float *t, float *u) const
+	{
+		ASSERT(begin >= 0 && begin <= end && end <= sizeFrequency);
+
+		if (begin == end) return;
+		const int frequencySize = FrgCommon::frequency().size;
+		const float *frequency = FrgCommon::frequency()._data;
+
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(begin / frequencySize, so, uo);
+		int to = int(begin % frequencySize);
+
+		for (int64_t i = 0; i < end - begin; ++i)
 		{
-			for (int uo = 0; uo <= so; ++uo)
+			s[i] = frequency[so];
+			t[i] = frequency[to];
+			u[i] = frequency[uo];
+
+			if (++to == frequencySize)
 			{
-				if (su == so * (so + 1) / 2 + uo)
+				to = 0;
+				if (++uo > so)
 				{
-					s = FrgCommon::frequency()._data[so];
-					u = FrgCommon::frequency()._data[uo];
-					return;
+					uo = 0;
+					++so;
 				}
 			}
 		}
@@ -164,10 +237,12 @@ public:
 	/**
 	 * @brief Directly access a vertex value via a linear iterator in the range [0,size). 
 	 * 
+	 * @details Values which are written to a compactly stored vertex are rounded to the precision of the storage format. 
+	 * 
 	 * @param iterator Linear iterator. 
-	 * @return float& Vertex value. 
+	 * @return FloatArray::Reference Reference to the vertex value. 
 	 */
-	float &getValueRef(const int iterator) const
+	FloatArray::Reference getValueRef(const int64_t iterator) const
 	{
 		ASSERT(iterator >= 0 && iterator < size);
 
@@ -366,23 +441,41 @@ public:
 		ASSERT(superbundle.bundle(0).size() == FrgCommon::lattice().size);
 
 		superbundle.reset();
-		const LatticeSiteDescriptor *sites = (accessBuffer.pairExchange) ? FrgCommon::lattice().getInvertedSites() : FrgCommon::lattice().getSites();
+
+		//representative sites are the trivial representatives of their equivalence class, i.e. getSites()[j] has rid j and no spin permutation, such that the vertex values of a frequency line are contiguous without pair exchange. 
+		//upon pair exchange, they are read contiguously from the exchanged copy if it is valid. 
+		bool contiguous = !accessBuffer.pairExchange || _exchangedValid;
+		const FloatArray &data = (accessBuffer.pairExchange && _exchangedValid) ? _exchanged : _data;
+		const LatticeSiteDescriptor *sites = FrgCommon::lattice().getInvertedSites();
+		int size = FrgCommon::lattice().size;
+
+		//compactly stored frequency lines are decoded to a thread-local buffer
+		thread_local std::vector<float> lineBuffer;
+		if (_data.isCompact()) lineBuffer.resize(16 * size);
 
 		for (int i = 0; i < n; ++i)
 		{
+			const float *line = data.line(accessBuffer.frequencyOffsets[i], 16 * size, lineBuffer.data());
+
+			if (contiguous)
+			{
+				for (int s = 0; s < 16; ++s) SimdKernels::apply<SimdKernels::Operation::MultAddScalar>(superbundle.bundle(s).data(), line + s * size, static_cast<const float *>(nullptr), accessBuffer.sign[i][s / 4][s % 4] * accessBuffer.frequencyWeights[i], size);
+				continue;
+			}
+
 			for (int s1 = 0; s1 < 4; ++s1)
 			{
 				for (int s2 = 0; s2 < 4; ++s2)
 				{
 					for (int j = 0; j < FrgCommon::lattice().size; ++j)
 					{
-						int s1t = (accessBuffer.pairExchange) ? s2 : s1;
-						int s2t = (accessBuffer.pairExchange) ? s1 : s2;
+						int s1t = s2;
+						int s2t = s1;
 						if (s1t < 3) s1t = static_cast<int>(sites[j].spinPermutation[s1t]);
 						if (s2t < 3) s2t = static_cast<int>(sites[j].spinPermutation[s2t]);
 						int spinOffset = (4 * s1t + s2t) * FrgCommon::lattice().size;
 
-						superbundle.bundle(4 * s1 + s2)[j] += accessBuffer.sign[i][s1][s2] * accessBuffer.frequencyWeights[i] * _data[accessBuffer.frequencyOffsets[i] + spinOffset + sites[j].rid];
+						superbundle.bundle(4 * s1 + s2)[j] += accessBuffer.sign[i][s1][s2] * accessBuffer.frequencyWeights[i] * line[spinOffset + sites[j].rid];
 					}
 				}
 			}
@@ -676,10 +769,45 @@ public:
 		return (s1 <= 2) ? -1.0f : 1.0f;
 	}
 
+	/**
+	 * @brief Copy the pair-exchanged and spin-permuted vertex values to the exchanged copy without conversion between storage formats. 
+	 * 
+	 * @tparam T Storage type of the vertex values. 
+	 * @param data Vertex data. 
+	 * @param exchanged Exchanged copy. 
+	 */
+	template <class T> void _updateExchangedCopy(const T *data, T *exchanged) const
+	{
+		const LatticeSiteDescriptor *invertedSites = FrgCommon::lattice().getInvertedSites();
+		int latticeSize = FrgCommon::lattice().size;
+
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (int64_t line = 0; line < sizeFrequency; ++line)
+		{
+			int64_t offset = line * _memoryStep[1];
+			for (int s1 = 0; s1 < 4; ++s1)
+			{
+				for (int s2 = 0; s2 < 4; ++s2)
+				{
+					for (int j = 0; j < latticeSize; ++j)
+					{
+						int s1t = (s2 < 3) ? static_cast<int>(invertedSites[j].spinPermutation[s2]) : s2;
+						int s2t = (s1 < 3) ? static_cast<int>(invertedSites[j].spinPermutation[s1]) : s1;
+						exchanged[offset + (4 * s1 + s2) * latticeSize + j] = data[offset + (4 * s1t + s2t) * latticeSize + invertedSites[j].rid];
+					}
+				}
+			}
+		}
+	}
+
 	//vertex internal data
-	int size; ///< Size of the vertex (number of elements). 
-	int sizeFrequency; ///< Size of the vertex in the frequency subspace (number of elements). 
+	int64_t size; ///< Size of the vertex (number of elements). 
+	int64_t sizeFrequency; ///< Size of the vertex in the frequency subspace (number of elements). 
 
-	float *_data; ///< Vertex data. 
-	int _memoryStep[4]; ///< Memory stride width. 
+	FloatArray _data; ///< Vertex data. 
+	FloatArray _exchanged; ///< Contiguous copy of the pair-exchanged vertex data, or empty if not allocated. 
+	bool _exchangedValid; ///< Indicates whether the pair-exchanged copy agrees with the current vertex values. 
+	int64_t _memoryStep[4]; ///< Memory stride width. 
 };
\ No newline at end of file
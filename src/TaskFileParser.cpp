@@ -9,6 +9,7 @@
 #include "TaskFileParser.hpp"
 #include <set>
 #include <string>
+#include <climits>
 #include <boost/filesystem.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 #include "lib/InputParser.hpp"
@@ -16,9 +17,10 @@
 #include "LatticeModelFactory.hpp"
 #include "FrgCoreFactory.hpp"
 #include "SpinParser.hpp"
+#include "BreakdownMonitor.hpp"
 
 
-TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscretization *&frequency, CutoffDiscretization *&cutoff, Lattice *&lattice, FrgCore *&frgCore, ComputationStatus &computationStatus)
+TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscretization *&frequency, CutoffDiscretization *&cutoff, Lattice *&lattice, FrgCore *&frgCore, ComputationStatus &computationStatus, BreakdownMonitor *&breakdownMonitor, CoarsePass *&coarsePass)
 {
 	//parse xml document
 	boost::property_tree::read_xml(taskFilePath, _taskFile, boost::property_tree::xml_parser::no_concat_text);
@@ -26,13 +28,16 @@ TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscret
 	//validate global task file structure
 	_validateProperties(_taskFile, "", { "task" }, {});
 	_validateProperties(_taskFile, "task", { "parameters" }, {}, { "measurements", "calculation" });
-	_validateProperties(_taskFile, "task.parameters", { "frequency", "cutoff", "lattice", "model" }, {});
+	_validateProperties(_taskFile, "task.parameters", { "frequency", "cutoff", "lattice", "model" }, {}, { "breakdown", "refinement" });
 
 	//computation status
 	#pragma region computation status
+	computationStatus.breakdownCutoff = NAN;
 	if (SpinParser::spinParser()->getCommandLineOptions()->forceRestart()) computationStatus.statusIdentifier = ComputationStatus::Identifier::New;
 	else
 	{
+		if (_taskFile.get_optional<std::string>("task.calculation.<xmlattr>.breakdownCutoff")) computationStatus.breakdownCutoff = InputParser::stringToFloat(_taskFile.get<std::string>("task.calculation.<xmlattr>.breakdownCutoff"));
+
 		if (_taskFile.get_optional<std::string>("task.calculation.<xmlattr>.status"))
 		{
 			std::string status = _taskFile.get<std::string>("task.calculation.<xmlattr>.status");
@@ -152,11 +157,30 @@ TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscret
 
 	//cutoff
 	#pragma region cutoff
-	_validateProperties(_taskFile, "task.parameters.cutoff", {}, { "discretization" }, { "min", "max", "step", "value" });
+	_validateProperties(_taskFile, "task.parameters.cutoff", {}, { "discretization" }, { "min", "max", "step", "tolerance", "value" }, { "integrator", "order" });
+
+	//integrator for discrete cutoff discretizations
+	int multistepOrder = 1;
+	if (_taskFile.get_optional<std::string>("task.parameters.cutoff.<xmlattr>.integrator"))
+	{
+		std::string integrator = _taskFile.get<std::string>("task.parameters.cutoff.<xmlattr>.integrator");
+		if (integrator == "euler")
+		{
+			if (_taskFile.get_optional<std::string>("task.parameters.cutoff.<xmlattr>.order")) throw Exception(Exception::Type::InitializationError, "Invalid task file. Attribute 'task.parameters.cutoff.order' is only valid for the integrator 'adams-bashforth'");
+		}
+		else if (integrator == "adams-bashforth")
+		{
+			multistepOrder = 3;
+			if (_taskFile.get_optional<std::string>("task.parameters.cutoff.<xmlattr>.order")) multistepOrder = _parseIntegerAttribute("task.parameters.cutoff.order", 1, CutoffDiscretization::maxMultistepOrder);
+			Log::log << Log::LogLevel::Info << "Using Adams-Bashforth integrator of order " << multistepOrder << Log::endl;
+		}
+		else throw Exception(Exception::Type::InitializationError, "Invalid task file. Unknown attribute value '" + integrator + "' (task.parameters.cutoff.integrator)");
+	}
+	else if (_taskFile.get_optional<std::string>("task.parameters.cutoff.<xmlattr>.order")) throw Exception(Exception::Type::InitializationError, "Invalid task file. Attribute 'task.parameters.cutoff.order' is only valid for the integrator 'adams-bashforth'");
 
 	if (_taskFile.get<std::string>("task.parameters.cutoff.<xmlattr>.discretization") == "exponential")
 	{
-		_validateProperties(_taskFile, "task.parameters.cutoff", { "min", "max", "step" }, { "discretization" });
+		_validateProperties(_taskFile, "task.parameters.cutoff", { "min", "max", "step" }, { "discretization" }, {}, { "integrator", "order" });
 
 		//populate discretization automatically
 		float min = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.cutoff.min.<xmltext>"));
@@ -175,12 +199,32 @@ TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscret
 			max *= step;
 		}
 
-		cutoff = new CutoffDiscretization(cutoffValues);
+		cutoff = new CutoffDiscretization(cutoffValues, multistepOrder);
 		Log::log << Log::LogLevel::Info << "Generated exponential cutoff discretization with " << cutoffValues.size() << " values" << Log::endl;
 	}
+	else if (_taskFile.get<std::string>("task.parameters.cutoff.<xmlattr>.discretization") == "adaptive")
+	{
+		_validateProperties(_taskFile, "task.parameters.cutoff", { "min", "max", "step", "tolerance" }, { "discretization" });
+
+		//step sizes are chosen at runtime by the adaptive integrator
+		float min = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.cutoff.min.<xmltext>"));
+		if (min <= 0) throw Exception(Exception::Type::InitializationError, "Invalid task file. Parameter 'task.parameters.cutoff.min' must be positive");
+
+		float max = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.cutoff.max.<xmltext>"));
+		if (max <= min) throw Exception(Exception::Type::InitializationError, "Invalid task file. Parameter 'task.parameters.cutoff.max' must be greater than 'task.parameters.cutoff.min'");
+
+		float step = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.cutoff.step.<xmltext>"));
+		if (step <= 0 || step >= 1) throw Exception(Exception::Type::InitializationError, "Invalid task file. Parameter 'task.parameters.cutoff.step' must be in the range (0,1)");
+
+		float tolerance = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.cutoff.tolerance.<xmltext>"));
+		if (tolerance <= 0) throw Exception(Exception::Type::InitializationError, "Invalid task file. Parameter 'task.parameters.cutoff.tolerance' must be positive");
+
+		cutoff = new CutoffDiscretization(max, min, step, tolerance);
+		Log::log << Log::LogLevel::Info << "Generated adaptive cutoff discretization with relative tolerance " << tolerance << Log::endl;
+	}
 	else if (_taskFile.get<std::string>("task.parameters.cutoff.<xmlattr>.discretization") == "manual")
 	{
-		_validateProperties(_taskFile, "task.parameters.cutoff", {}, { "discretization" }, { "value" });
+		_validateProperties(_taskFile, "task.parameters.cutoff", {}, { "discretization" }, { "value" }, { "integrator", "order" });
 
 		//populate discretization manually
 		std::vector<float> cutoffValues;
@@ -193,11 +237,85 @@ TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscret
 			}
 		}
 		std::sort(cutoffValues.begin(), cutoffValues.end(), std::greater<float>());
-		cutoff = new CutoffDiscretization(cutoffValues);
+		cutoff = new CutoffDiscretization(cutoffValues, multistepOrder);
 	}
 	else throw Exception(Exception::Type::InitializationError, "Invalid task file. Unknown attribute value '" + _taskFile.get<std::string>("task.parameters.cutoff.<xmlattr>.discretization") + "' (task.parameters.cutoff.discretization)");
 	#pragma endregion
 
+	//breakdown monitor
+	#pragma region breakdown monitor
+	breakdownMonitor = nullptr;
+	float growth = 10.0f;
+	float kink = 0.0f;
+	if (_taskFile.get_child_optional("task.parameters.breakdown"))
+	{
+		_validateProperties(_taskFile, "task.parameters.breakdown", {}, {}, {}, { "growth", "kink", "terminate" });
+
+		if (_taskFile.get_optional<std::string>("task.parameters.breakdown.<xmlattr>.growth")) growth = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.breakdown.<xmlattr>.growth"));
+		if (growth <= 0) throw Exception(Exception::Type::InitializationError, "Invalid task file. Attribute 'task.parameters.breakdown.growth' must be positive");
+
+		if (_taskFile.get_optional<std::string>("task.parameters.breakdown.<xmlattr>.kink")) kink = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.breakdown.<xmlattr>.kink"));
+		if (kink != 0 && kink <= 1) throw Exception(Exception::Type::InitializationError, "Invalid task file. Attribute 'task.parameters.breakdown.kink' must be greater than one");
+
+		bool terminate = false;
+		if (_taskFile.get_optional<std::string>("task.parameters.breakdown.<xmlattr>.terminate"))
+		{
+			std::string value = _taskFile.get<std::string>("task.parameters.breakdown.<xmlattr>.terminate");
+			if (value == "true") terminate = true;
+			else if (value != "false") throw Exception(Exception::Type::InitializationError, "Invalid task file. Unknown attribute value '" + value + "' (task.parameters.breakdown.terminate)");
+		}
+
+		breakdownMonitor = new BreakdownMonitor(growth, kink, terminate);
+		Log::log << Log::LogLevel::Info << "Monitoring flow breakdown with maximum growth rate " << growth << Log::endl;
+	}
+	#pragma endregion
+
+	//coarse pass
+	#pragma region coarse pass
+	coarsePass = nullptr;
+	if (_taskFile.get_child_optional("task.parameters.refinement"))
+	{
+		_validateProperties(_taskFile, "task.parameters.refinement", {}, { "frequency" }, {}, { "cutoff", "window" });
+
+		int frequencyCount = _parseIntegerAttribute("task.parameters.refinement.frequency", 2, frequency->size);
+
+		int cutoffStride = 1;
+		if (_taskFile.get_optional<std::string>("task.parameters.refinement.<xmlattr>.cutoff")) cutoffStride = _parseIntegerAttribute("task.parameters.refinement.cutoff", 1, INT_MAX);
+
+		float window = 2.0f;
+		if (_taskFile.get_optional<std::string>("task.parameters.refinement.<xmlattr>.window")) window = InputParser::stringToFloat(_taskFile.get<std::string>("task.parameters.refinement.<xmlattr>.window"));
+		if (window < 1) throw Exception(Exception::Type::InitializationError, "Invalid task file. Attribute 'task.parameters.refinement.window' must not be smaller than one");
+
+		//the coarse pass only precedes new calculations; restarts resume from the checkpoint on the fine grid
+		if (computationStatus.statusIdentifier == ComputationStatus::Identifier::New)
+		{
+			coarsePass = new CoarsePass;
+			coarsePass->frgCore = nullptr;
+			coarsePass->window = window;
+
+			//coarse frequency mesh is an evenly spaced subset of the fine mesh, which includes the smallest and the largest frequency
+			std::vector<float> coarseFrequencies;
+			for (int i = 0; i < frequencyCount; ++i) coarseFrequencies.push_back(frequency->_data[int(std::round(float(i) * (frequency->size - 1) / (frequencyCount - 1)))]);
+			coarsePass->frequency = new FrequencyDiscretization(coarseFrequencies);
+
+			//coarse cutoff discretization is every n-th cutoff value of the fine discretization, such that the fine calculation can start from any coarse cutoff value
+			if (cutoff->isAdaptive()) coarsePass->cutoff = new CutoffDiscretization(*cutoff->begin(), *cutoff->last(), cutoff->initialStep(), cutoffStride * cutoff->tolerance());
+			else
+			{
+				std::vector<float> coarseCutoffValues;
+				int n = 0;
+				for (auto c = cutoff->begin(); c != cutoff->end(); ++c, ++n) if (n % cutoffStride == 0 || c == cutoff->last()) coarseCutoffValues.push_back(*c);
+				coarsePass->cutoff = new CutoffDiscretization(coarseCutoffValues, cutoff->multistepOrder());
+			}
+
+			//on finite meshes, breakdowns are typically regularized, hence kink detection is always enabled for the coarse pass
+			coarsePass->breakdownMonitor = new BreakdownMonitor(growth, (kink == 0.0f) ? 1.5f : kink, true);
+
+			Log::log << Log::LogLevel::Info << "Generated coarse pass with " << frequencyCount << " frequency values" << Log::endl;
+		}
+	}
+	#pragma endregion
+
 	//lattice model
 	#pragma region lattice model
 	_validateProperties(_taskFile, "task.parameters.lattice", {}, { "name", "range" });
@@ -318,6 +436,16 @@ TaskFileParser::TaskFileParser(const std::string &taskFilePath, FrequencyDiscret
 
 	frgCore = FrgCoreFactory::newFrgCore(coreIdentifier, *spinModel, measurements, coreOptions);
 
+	//make coarse frg core without measurements, which is constructed while the coarse discretizations are substituted
+	if (coarsePass != nullptr)
+	{
+		std::swap(frequency, coarsePass->frequency);
+		std::swap(cutoff, coarsePass->cutoff);
+		coarsePass->frgCore = FrgCoreFactory::newFrgCore(coreIdentifier, *spinModel, std::vector<FrgCoreFactory::MeasurementSpecification>(), coreOptions);
+		std::swap(frequency, coarsePass->frequency);
+		std::swap(cutoff, coarsePass->cutoff);
+	}
+
 	Log::log << Log::LogLevel::Info << Log::LogLevel::Info << "Generated FRG core with identifier " << coreIdentifier << "." << Log::endl;
 	#pragma endregion
 
@@ -357,6 +485,8 @@ void TaskFileParser::writeTaskFile(const ComputationStatus &computationStatus)
 		_taskFile.put("task.calculation.<xmlattr>.startTime", Timestamp::timestamp(computationStatus.startTime));
 		_taskFile.put("task.calculation.<xmlattr>.checkpointTime", Timestamp::timestamp(computationStatus.checkpointTime));
 
+		if (!std::isnan(computationStatus.breakdownCutoff)) _taskFile.put("task.calculation.<xmlattr>.breakdownCutoff", computationStatus.breakdownCutoff);
+
 		if (computationStatus.statusIdentifier == ComputationStatus::Identifier::Running) _taskFile.put("task.calculation.<xmlattr>.status", "running");
 		else if (computationStatus.statusIdentifier == ComputationStatus::Identifier::Postprocessing) _taskFile.put("task.calculation.<xmlattr>.status", "postprocessing");
 		else if (computationStatus.statusIdentifier == ComputationStatus::Identifier::Finished)
@@ -421,4 +551,25 @@ void TaskFileParser::_validateOptionalAttributes(const boost::property_tree::ptr
 	{
 		for (auto v : tree.get_child(((node == "") ? "" : node + ".") + "<xmlattr>")) if (optionalAttributes.find(v.first) == optionalAttributes.end()) throw Exception(Exception::Type::InitializationError, "Invalid task file. Unknown attribute '" + ((treePath == "") ? "" : treePath + ".") + ((node == "") ? "" : node + ".") + v.first + "'.");
 	}
-}
\ No newline at end of file
+}
+
+int TaskFileParser::_parseIntegerAttribute(const std::string &attribute, const int min, const int max) const
+{
+	std::string path = attribute.substr(0, attribute.rfind('.')) + ".<xmlattr>" + attribute.substr(attribute.rfind('.'));
+	std::string value = _taskFile.get<std::string>(path);
+
+	//reject values which are not entirely numeric or exceed the range of int
+	int result = 0;
+	size_t length = 0;
+	try
+	{
+		result = std::stoi(value, &length);
+	}
+	catch (const std::exception &)
+	{
+		length = 0;
+	}
+	if (length == 0 || length != value.size()) throw Exception(Exception::Type::ArgumentError, "Invalid task file. Attribute '" + attribute + "' must be an integer");
+	if (result < min || result > max) throw Exception(Exception::Type::ArgumentError, "Invalid task file. Attribute '" + attribute + "' must be in the range [" + std::to_string(min) + "," + std::to_string(max) + "]");
+	return result;
+}
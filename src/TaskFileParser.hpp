@@ -15,6 +15,8 @@ struct FrequencyDiscretization;
 struct CutoffDiscretization;
 struct Lattice;
 struct ComputationStatus;
+struct BreakdownMonitor;
+struct CoarsePass;
 class FrgCore;
 
 /**
@@ -36,8 +38,10 @@ public:
 	 * @param[out] lattice ɵLattice()
 	 * @param[out] frgCore ɵFRG
 	 * @param[out] computationStatus ļļ״̬.
+	 * @param[out] breakdownMonitor ɵBreakdownMonitor(),ļδָΪ nullptr.
+	 * @param[out] coarsePass ɵCoarsePass(Ԥ),ļδָ㲻¼Ϊ nullptr.
 	 */
-	TaskFileParser(const std::string &taskFilePath, FrequencyDiscretization *&frequency, CutoffDiscretization *&cutoff, Lattice *&lattice, FrgCore *&frgCore, ComputationStatus &computationStatus);
+	TaskFileParser(const std::string &taskFilePath, FrequencyDiscretization *&frequency, CutoffDiscretization *&cutoff, Lattice *&lattice, FrgCore *&frgCore, ComputationStatus &computationStatus, BreakdownMonitor *&breakdownMonitor, CoarsePass *&coarsePass);
 
 	/**
 	 * @brief ״̬дļ. 
@@ -100,5 +104,15 @@ protected:
 	 */
 	void _validateOptionalAttributes(const boost::property_tree::ptree &tree, const std::string &node, const std::set<std::string> &optionalAttributes, const std::string &treePath = "") const;
 
+	/**
+	 * @brief ļеֵΪ,ȷλڸΧ.ֵ򳬳Χ, Exception::Type::ArgumentError.
+	 * 
+	 * @param attribute Ե·, <xmlattr> , task.parameters.cutoff.order. 
+	 * @param min Сֵ. 
+	 * @param max ֵ. 
+	 * @return int ֵ. 
+	 */
+	int _parseIntegerAttribute(const std::string &attribute, const int min, const int max) const;
+
 	boost::property_tree::ptree _taskFile; ///< ļڲʾʽ. 
 };
\ No newline at end of file
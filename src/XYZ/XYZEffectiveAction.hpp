@@ -21,11 +21,14 @@ struct XYZEffectiveAction : public EffectiveAction
 public:
 	/**
 	 * @brief Construct a new XYZEffectiveAction object. 
+	 * 
+	 * @param format Storage format of the two-particle vertex. 
 	 */
-	XYZEffectiveAction()
+	XYZEffectiveAction(const FloatFormat format = FloatFormat::Float32)
 	{
+		vertexFormat = format;
 		vertexSingleParticle = new XYZVertexSingleParticle;
-		vertexTwoParticle = new XYZVertexTwoParticle;
+		vertexTwoParticle = new XYZVertexTwoParticle(format);
 	}
 
 	/**
@@ -37,23 +40,23 @@ public:
 	 */
 	XYZEffectiveAction(const float cutoff, const SpinModel &spinModel, const XYZFrgCore *core)
 	{
+		vertexFormat = core->vertexFormat;
 		vertexSingleParticle = new XYZVertexSingleParticle;
-		vertexTwoParticle = new XYZVertexTwoParticle;
+		vertexTwoParticle = new XYZVertexTwoParticle(core->vertexFormat);
 
-		//set initial value
+		//set initial value; the initial value does not depend on frequency, so interactions are written directly to their lattice sites for each frequency
 		this->cutoff = cutoff;
 
-		for (int linearIterator = 0; linearIterator < vertexTwoParticle->size; ++linearIterator)
+		int latticeSize = FrgCommon::lattice().size;
+		for (int64_t frequencyIterator = 0; frequencyIterator < vertexTwoParticle->sizeFrequency; ++frequencyIterator)
 		{
-			float s, t, u;
-			LatticeIterator i1;
-			vertexTwoParticle->expandIterator(linearIterator, i1, s, t, u);
-
 			//set initial conditions for spin/spin interactions
 			for (auto i : spinModel.interactions)
 			{
-				if (i.first == i1)
+				int rid = i.first - FrgCommon::lattice().begin();
+				if (rid >= 0 && rid < latticeSize)
 				{
+					int64_t linearIterator = frequencyIterator * latticeSize + rid;
 					vertexTwoParticle->getValueRef(linearIterator, SpinComponent::X) += 0.25f * i.second.interactionStrength[0][0] / core->normalization;
 					vertexTwoParticle->getValueRef(linearIterator, SpinComponent::Y) += 0.25f * i.second.interactionStrength[1][1] / core->normalization;
 					vertexTwoParticle->getValueRef(linearIterator, SpinComponent::Z) += 0.25f * i.second.interactionStrength[2][2] / core->normalization;
@@ -131,22 +134,33 @@ public:
 		H5Sclose(attrSpace);
 
 		//write vertex data
-		auto writeCheckpointDataset = [&group](const std::string &identifier, const int size, const float *data)
+		auto writeCheckpointDataset = [&group](const std::string &identifier, const int64_t size, const void *data, const hid_t memoryType, const hid_t fileType)
 		{
 			const int dataSpaceDim = 1;
 			const hsize_t dataSpaceSize[1] = { (hsize_t)size };
 			hid_t dataSpace = H5Screate_simple(dataSpaceDim, dataSpaceSize, NULL);
-			hid_t dataset = H5Dcreate(group, identifier.c_str(), H5T_NATIVE_FLOAT, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-			H5Dwrite(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			hid_t dataset = H5Dcreate(group, identifier.c_str(), fileType, dataSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+			H5Dwrite(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
 			H5Dclose(dataset);
 			H5Sclose(dataSpace);
 		};
-		writeCheckpointDataset("cutoff", 1, &cutoff);
-		writeCheckpointDataset("v2", vertexSingleParticle->size, vertexSingleParticle->_data);
-		writeCheckpointDataset("v4dd", vertexTwoParticle->size, vertexTwoParticle->_dataDD);
-		writeCheckpointDataset("v4xx", vertexTwoParticle->size, vertexTwoParticle->_dataXX);
-		writeCheckpointDataset("v4yy", vertexTwoParticle->size, vertexTwoParticle->_dataYY);
-		writeCheckpointDataset("v4zz", vertexTwoParticle->size, vertexTwoParticle->_dataZZ);
+		auto writeVertexCheckpointDataset = [&writeCheckpointDataset](const std::string &identifier, const FloatArray &data, const hid_t fileType)
+		{
+			//compactly stored vertices are written directly in their storage format
+			hid_t memoryType = checkpointDatatype(data.format());
+			if (data.isCompact()) writeCheckpointDataset(identifier, data.size(), data.compactData(), memoryType, fileType);
+			else writeCheckpointDataset(identifier, data.size(), data.data(), memoryType, fileType);
+			H5Tclose(memoryType);
+		};
+		hid_t vertexType = checkpointDatatype(vertexFormat);
+		writeCheckpointDataset("cutoff", 1, &cutoff, H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT);
+		writeCheckpointDataset("v2", vertexSingleParticle->size, vertexSingleParticle->_data, H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT);
+		writeVertexCheckpointDataset("v4dd", vertexTwoParticle->_dataDD, vertexType);
+		writeVertexCheckpointDataset("v4xx", vertexTwoParticle->_dataXX, vertexType);
+		writeVertexCheckpointDataset("v4yy", vertexTwoParticle->_dataYY, vertexType);
+		writeVertexCheckpointDataset("v4zz", vertexTwoParticle->_dataZZ, vertexType);
+		H5Tclose(vertexType);
+		writeFrequencyMesh(group);
 
 		//clean up and return
 		H5Gclose(group);
@@ -189,21 +203,38 @@ public:
 		hid_t group = H5Gopen(file, checkpointName.c_str(), H5P_DEFAULT);
 		if (group < 0) return false;
 
+		//if the checkpoint is defined on a different frequency mesh, interpolate it onto the current mesh
+		std::vector<float> mesh = readFrequencyMesh(group);
+		if (!isCurrentFrequencyMesh(mesh))
+		{
+			H5Gclose(group);
+			H5Fclose(file);
+			return readRegriddedCheckpoint<XYZEffectiveAction>(dataFilePath, checkpointId, mesh);
+		}
+
 		//read dataset
-		auto readDataset = [&group](const std::string &name, float *data)->bool
+		auto readDataset = [&group](const std::string &name, void *data, const hid_t memoryType)->bool
 		{
 			hid_t dataset = H5Dopen(group, name.c_str(), H5P_DEFAULT);
 			if (dataset < 0) return false;
-			H5Dread(dataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			H5Dread(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
 			H5Dclose(dataset);
 			return true;
 		};
-		if (!readDataset("cutoff", &cutoff)) return false;
-		if (!readDataset("v2", vertexSingleParticle->_data)) return false;
-		if (!readDataset("v4dd", vertexTwoParticle->_dataDD)) return false;
-		if (!readDataset("v4xx", vertexTwoParticle->_dataXX)) return false;
-		if (!readDataset("v4yy", vertexTwoParticle->_dataYY)) return false;
-		if (!readDataset("v4zz", vertexTwoParticle->_dataZZ)) return false;
+		auto readVertexDataset = [&readDataset](const std::string &name, const FloatArray &data)->bool
+		{
+			//for compactly stored vertices, HDF5 converts the dataset to the storage format
+			hid_t memoryType = checkpointDatatype(data.format());
+			bool success = (data.isCompact()) ? readDataset(name, data.compactData(), memoryType) : readDataset(name, data.data(), memoryType);
+			H5Tclose(memoryType);
+			return success;
+		};
+		if (!readDataset("cutoff", &cutoff, H5T_NATIVE_FLOAT)) return false;
+		if (!readDataset("v2", vertexSingleParticle->_data, H5T_NATIVE_FLOAT)) return false;
+		if (!readVertexDataset("v4dd", vertexTwoParticle->_dataDD)) return false;
+		if (!readVertexDataset("v4xx", vertexTwoParticle->_dataXX)) return false;
+		if (!readVertexDataset("v4yy", vertexTwoParticle->_dataYY)) return false;
+		if (!readVertexDataset("v4zz", vertexTwoParticle->_dataZZ)) return false;
 
 		//clean up and return
 		H5Gclose(group);
@@ -212,26 +243,57 @@ public:
 	}
 
 	/**
-	 * @brief Indicate whether the vertex has diverged to NaN. 
+	 * @brief Retrieve the list of all vertex data arrays. 
 	 *
-	 * @return bool Return true if the vertex has diverged, otherwise return false. 
+	 * @return std::vector<FloatArray> List of vertex data arrays. 
 	 */
-	bool isDiverged() const override
+	std::vector<FloatArray> getDataBundles() const override
 	{
-		for (int i = 0; i < vertexSingleParticle->size; ++i)
-		{
-			if (std::isnan(vertexSingleParticle->getValueRef(i))) return true;
-		}
+		return {
+			FloatArray(vertexSingleParticle->_data, vertexSingleParticle->size),
+			vertexTwoParticle->_dataDD,
+			vertexTwoParticle->_dataXX,
+			vertexTwoParticle->_dataYY,
+			vertexTwoParticle->_dataZZ
+		};
+	}
+
+	/**
+	 * @brief Transfer an effective action which is defined on a different frequency grid onto the current frequency grid via interpolation. 
+	 * @details Vertex values are interpolated on the source grid via XYZVertexSingleParticle::getValue() and XYZVertexTwoParticle::getValue(). 
+	 * 
+	 * @param source Source effective action. Must be an XYZEffectiveAction. 
+	 * @param sourceFrequency Matsubara frequency discretization on which the source effective action is defined. 
+	 */
+	void regrid(const EffectiveAction &source, FrequencyDiscretization &sourceFrequency) override
+	{
+		const XYZEffectiveAction &sourceAction = static_cast<const XYZEffectiveAction &>(source);
+		cutoff = source.cutoff;
 
-		for (int i = 0; i < vertexTwoParticle->size; ++i)
+		//expand frequency arguments on the target grid
+		std::vector<float> w(vertexSingleParticle->size);
+		for (int i = 0; i < vertexSingleParticle->size; ++i) vertexSingleParticle->expandIterator(i, w[i]);
+
+		std::vector<float> s(vertexTwoParticle->sizeFrequency), t(vertexTwoParticle->sizeFrequency), u(vertexTwoParticle->sizeFrequency);
+		vertexTwoParticle->expandIterators(0, vertexTwoParticle->sizeFrequency, s.data(), t.data(), u.data());
+
+		//interpolate vertex on the source grid
+		FrequencyScope scope(sourceFrequency);
+		for (int i = 0; i < vertexSingleParticle->size; ++i) vertexSingleParticle->getValueRef(i) = sourceAction.vertexSingleParticle->getValue(w[i]);
+
+		int latticeSize = FrgCommon::lattice().size;
+		const SpinComponent symmetries[4] = { SpinComponent::X, SpinComponent::Y, SpinComponent::Z, SpinComponent::None };
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(dynamic)
+		#endif
+		for (int64_t i = 0; i < vertexTwoParticle->sizeFrequency; ++i)
 		{
-			if (std::isnan(vertexTwoParticle->getValueRef(i, SpinComponent::None))) return true;
-			if (std::isnan(vertexTwoParticle->getValueRef(i, SpinComponent::X))) return true;
-			if (std::isnan(vertexTwoParticle->getValueRef(i, SpinComponent::Y))) return true;
-			if (std::isnan(vertexTwoParticle->getValueRef(i, SpinComponent::Z))) return true;
+			for (int j = 0; j < latticeSize; ++j)
+			{
+				LatticeIterator i1 = FrgCommon::lattice().fromParametrization(j);
+				for (auto symmetry : symmetries) vertexTwoParticle->getValueRef(i * latticeSize + j, symmetry) = sourceAction.vertexTwoParticle->getValue(i1, FrgCommon::lattice().zero(), s[i], t[i], u[i], symmetry, XYZVertexTwoParticle::FrequencyChannel::None);
+			}
 		}
-
-		return false;
 	}
 
 	XYZVertexSingleParticle *vertexSingleParticle; ///< Single-particle vertex data. 
@@ -11,6 +11,8 @@
 #include "lib/InputParser.hpp"
 #include "lib/Integrator.hpp"
 #include "SpinParser.hpp"
+#include "AccessBufferTable.hpp"
+#include "LatticeBubble.hpp"
 #include "XYZFrgCore.hpp"
 #include "XYZEffectiveAction.hpp"
 
@@ -18,20 +20,58 @@ XYZFrgCore::XYZFrgCore(const SpinModel &spinModel, const std::vector<Measurement
 {
 	//init options
 	normalization = NAN;
+	vertexFormat = FloatFormat::Float32;
+	bool exchangedVertexCopy = false;
+	bool momentumSpaceBubble = false;
 
 	for (auto option : options)
 	{
 		if (option.first == "normalization") normalization = InputParser::stringToFloat(option.second);
+		else if (option.first == "precision") vertexFormat = FloatCodec::parse(option.second);
+		else if (option.first == "bubble")
+		{
+			if (option.second == "direct") momentumSpaceBubble = false;
+			else if (option.second == "fft") momentumSpaceBubble = true;
+			else throw Exception(Exception::Type::InitializationError, "Unknown lattice bubble evaluation '" + option.second + "'.");
+		}
+		else if (option.first == "exchange")
+		{
+			if (option.second == "gather") exchangedVertexCopy = false;
+			else if (option.second == "copy") exchangedVertexCopy = true;
+			else throw Exception(Exception::Type::InitializationError, "Unknown site exchange evaluation '" + option.second + "'.");
+		}
 		else throw Exception(Exception::Type::InitializationError, "Unknown spin model option '" + option.first + "'.");
 	}
 	if (std::isnan(normalization)) normalization = 1.0f;
 
 	Log::log << Log::LogLevel::Info << "FRG core energy normalization is set to " << normalization << "." << Log::endl;
+	Log::log << Log::LogLevel::Info << "FRG core vertex storage precision is set to " << FloatCodec::name(vertexFormat) << "." << Log::endl;
+
+	//evaluate the lattice bubble in momentum space; fall back to the direct summation if the lattice symmetries permute the spin components, or if the direct summation is estimated to be faster
+	if (momentumSpaceBubble)
+	{
+		bubblePlan = LatticeBubble::FourierPlan(FrgCommon::lattice());
+		if (!bubblePlan.hasTrivialSpinPermutations()) bubblePlan = LatticeBubble::FourierPlan();
+		if (!bubblePlan.isApplicable()) Log::log << Log::LogLevel::Warning << "Lattice bubble cannot be evaluated in momentum space on this lattice. Falling back to direct summation." << Log::endl;
+		else if (!bubblePlan.isFavorable(4))
+		{
+			Log::log << Log::LogLevel::Info << "FRG core lattice bubble is evaluated by direct summation, which is estimated to be faster than the evaluation in momentum space on this lattice." << Log::endl;
+			bubblePlan = LatticeBubble::FourierPlan();
+		}
+		else Log::log << Log::LogLevel::Info << "FRG core lattice bubble is evaluated in momentum space on a periodic supercell of " << bubblePlan.dimensions()[0] << "x" << bubblePlan.dimensions()[1] << "x" << bubblePlan.dimensions()[2] << " unit cells." << Log::endl;
+	}
 
 	//init data
 	_flowingFunctional = new XYZEffectiveAction(*FrgCommon::cutoff().begin(), spinModel, this);
 	_flow = new XYZEffectiveAction();
 
+	//the site-exchanged copy of the vertex is updated once at the beginning of each step, such that vertex bundles are read contiguously also upon site exchange
+	if (exchangedVertexCopy)
+	{
+		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->enableExchangedCopy();
+		Log::log << Log::LogLevel::Info << "FRG core two-particle vertex keeps a contiguous site-exchanged copy." << Log::endl;
+	}
+
 	//init loadManager
 	//stack0
 	dataStacks[0] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
@@ -41,22 +81,20 @@ XYZFrgCore::XYZFrgCore(const SpinModel &spinModel, const std::vector<Measurement
 	dataStacks[1] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
 		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexSingleParticle->_data,
 		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexSingleParticle->size);
+	//compactly stored vertex channels are broadcasted in their storage format without conversion
+	auto addVertexStack = [](const FloatArray &data)
+	{
+		if (data.isCompact()) return SpinParser::spinParser()->getLoadManager()->addPassiveStack<uint16_t>(data.compactData(), data.size());
+		else return SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(data.data(), data.size());
+	};
 	//stack2
-	dataStacks[2] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataDD,
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size);
+	dataStacks[2] = addVertexStack(static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataDD);
 	//stack3
-	dataStacks[3] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataXX,
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size);
+	dataStacks[3] = addVertexStack(static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataXX);
 	//stack4
-	dataStacks[4] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataYY,
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size);
+	dataStacks[4] = addVertexStack(static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataYY);
 	//stack5
-	dataStacks[5] = SpinParser::spinParser()->getLoadManager()->addPassiveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataZZ,
-		static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size);
+	dataStacks[5] = addVertexStack(static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataZZ);
 	//stack6
 	dataStacks[6] = SpinParser::spinParser()->getLoadManager()->addMasterStackImplicit<float>(
 		&_flow->cutoff,
@@ -72,33 +110,39 @@ XYZFrgCore::XYZFrgCore(const SpinModel &spinModel, const std::vector<Measurement
 		1);
 	//stack8
 	dataStacks[8] = SpinParser::spinParser()->getLoadManager()->addMasterStackImplicit<float>(
-		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataDD,
+		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataDD.data(),
 		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->sizeFrequency,
-		[&](int x) { _calculateVertexTwoParticle(x); },
+		[&](int64_t x) { _calculateVertexTwoParticle(x); },
 		FrgCommon::lattice().size,
 		FrgCommon::frequency().size);
 	//stack9
 	dataStacks[9] = SpinParser::spinParser()->getLoadManager()->addSlaveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataXX,
+		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataXX.data(),
 		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->sizeFrequency,
 		dataStacks[8],
 		FrgCommon::lattice().size);
 	//stack10
 	dataStacks[10] = SpinParser::spinParser()->getLoadManager()->addSlaveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataYY,
+		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataYY.data(),
 		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->sizeFrequency,
 		dataStacks[8],
 		FrgCommon::lattice().size);
 	//stack11
 	dataStacks[11] = SpinParser::spinParser()->getLoadManager()->addSlaveStack<float>(
-		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataZZ,
+		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataZZ.data(),
 		static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->sizeFrequency,
 		dataStacks[8],
 		FrgCommon::lattice().size);
+	//the runtime of the two-particle vertex calculation depends strongly on the frequency arguments, but changes only slowly between consecutive steps; chunks of equal cost are formed from the timings of the previous step
+	SpinParser::spinParser()->getLoadManager()->enableCostLearning(dataStacks[8]);
+	//keep the assignment of two-particle vertex elements to MPI ranks between consecutive steps, and only migrate work to rebalance
+	SpinParser::spinParser()->getLoadManager()->enableAffinity(dataStacks[8]);
 }
 
 XYZFrgCore::~XYZFrgCore()
 {
+	//release the data stacks which refer to this core; slave stacks are released along with their master stack
+	for (int i = 0; i < 12; ++i) SpinParser::spinParser()->getLoadManager()->releaseStack(dataStacks[i]);
 	delete _flowingFunctional;
 	delete _flow;
 }
@@ -111,6 +155,10 @@ void XYZFrgCore::computeStep()
 	//calculate 1-particle vertices and broadcast (required for Katanin calculation)
 	SpinParser::spinParser()->getLoadManager()->calculate(dataStacks[7]);
 	SpinParser::spinParser()->getLoadManager()->broadcast(dataStacks[7]);
+	//build the propagator cache; the single-particle vertex and its flow remain fixed for the remainder of the step
+	propagatorCache.update(_flowingFunctional->cutoff, static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexSingleParticle->_data, static_cast<XYZEffectiveAction *>(_flow)->vertexSingleParticle->_data);
+	//update the site-exchanged copy of the vertex; the two-particle vertex remains fixed for the remainder of the step
+	static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->updateExchangedCopy();
 	//calculate 2-particle vertices and managed measurements
 	std::vector<int> managedMeasurementStacks;
 	for (auto m = _measurements.begin(); m != _measurements.end(); ++m)
@@ -143,21 +191,29 @@ void XYZFrgCore::finalizeStep(float newCutoff)
 	#ifndef DISABLE_OMP
 	#pragma omp parallel for schedule(static)
 	#endif
-	for (int i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataDD[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataDD[i];
+	for (int64_t i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataDD[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataDD[i];
 	#ifndef DISABLE_OMP
 	#pragma omp parallel for schedule(static)
 	#endif
-	for (int i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataXX[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataXX[i];
+	for (int64_t i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataXX[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataXX[i];
 	#ifndef DISABLE_OMP
 	#pragma omp parallel for schedule(static)
 	#endif
-	for (int i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataYY[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataYY[i];
+	for (int64_t i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataYY[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataYY[i];
 	#ifndef DISABLE_OMP
 	#pragma omp parallel for schedule(static)
 	#endif
-	for (int i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataZZ[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataZZ[i];
+	for (int64_t i = 0; i < static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->size; ++i) static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->_dataZZ[i] += cutoffStep * static_cast<XYZEffectiveAction *>(_flow)->vertexTwoParticle->_dataZZ[i];
 
 	//broadcast updated effective action
+	synchronizeFlowingFunctional();
+}
+
+void XYZFrgCore::synchronizeFlowingFunctional()
+{
+	//vertex values may have been modified; the site-exchanged copy is updated again at the beginning of the next step
+	static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle->invalidateExchangedCopy();
+
 	SpinParser::spinParser()->getLoadManager()->broadcast({ dataStacks[0], dataStacks[1], dataStacks[2], dataStacks[3], dataStacks[4], dataStacks[5] });
 }
 
@@ -192,25 +248,34 @@ void XYZFrgCore::_calculateVertexSingleParticle(const int iterator)
 	static_cast<XYZEffectiveAction *>(_flow)->vertexSingleParticle->_data[iterator] = v2CurrentValue;
 }
 
-void XYZFrgCore::_calculateVertexTwoParticle(const int iterator)
+void XYZFrgCore::_calculateVertexTwoParticle(const int64_t iterator)
 {
 	float cutoff = _flowingFunctional->cutoff;
-	XYZVertexSingleParticle *v2 = static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexSingleParticle;
 	XYZVertexTwoParticle *v4 = static_cast<XYZEffectiveAction *>(_flowingFunctional)->vertexTwoParticle;
 
 	float s, t, u;
 	v4->expandIterator(iterator, s, t, u);
 
+	//buffers are borrowed from the thread-local scratch arena and released when the function returns
+	ScratchArena &scratch = ScratchArena::local();
+	ScratchArena::Scope scratchScope(scratch);
+
 	//vertex buffers
-	ValueSuperbundle<float, 4> buffer1(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> buffer2(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> bufferRPA(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> v4CurrentValue(FrgCommon::lattice().size);
+	ValueSuperbundle<float, 4> buffer1(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> buffer2(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> bufferRPA(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> v4CurrentValue(FrgCommon::lattice().size, scratch);
 	ValueSuperbundle<float, 4> stackBuffers[4] = {
-		ValueSuperbundle<float, 4>(FrgCommon::lattice().size),
-		ValueSuperbundle<float, 4>(FrgCommon::lattice().size),
-		ValueSuperbundle<float, 4>(FrgCommon::lattice().size),
-		ValueSuperbundle<float, 4>(FrgCommon::lattice().size)
+		ValueSuperbundle<float, 4>(FrgCommon::lattice().size, scratch),
+		ValueSuperbundle<float, 4>(FrgCommon::lattice().size, scratch),
+		ValueSuperbundle<float, 4>(FrgCommon::lattice().size, scratch),
+		ValueSuperbundle<float, 4>(FrgCommon::lattice().size, scratch)
+	};
+
+	//site-major copies of the vertex values for the lattice bubble
+	float *siteMajorBuffers[2] = {
+		LatticeBubble::allocateSiteMajor(stackBuffers[0], scratch),
+		LatticeBubble::allocateSiteMajor(stackBuffers[1], scratch)
 	};
 
 	//transfer frequencies
@@ -220,346 +285,306 @@ void XYZFrgCore::_calculateVertexTwoParticle(const int iterator)
 	float w2 = 0.5f * (s + t - u);
 
 	//integrand of the ferquency integral
-	auto integralKernelS = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	//access buffers which are required by the S integration kernel at the integration frequency wp
+	auto accessBuffersS = [&](const float wp, XYZVertexTwoParticleAccessBuffer<4> *ab) -> void
 	{
 		//pp-ladder A and B (positive sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab0 = v4->generateAccessBuffer(s, -w1 - wp, -w2 - wp, XYZVertexTwoParticle::FrequencyChannel::S);
-		const XYZVertexTwoParticleAccessBuffer<4> ab1 = v4->generateAccessBuffer(s, w1p + wp, -w2p - wp, XYZVertexTwoParticle::FrequencyChannel::S);
+		ab[0] = v4->generateAccessBuffer(s, -w1 - wp, -w2 - wp, XYZVertexTwoParticle::FrequencyChannel::S);
+		ab[1] = v4->generateAccessBuffer(s, w1p + wp, -w2p - wp, XYZVertexTwoParticle::FrequencyChannel::S);
 		//pp-ladder A and B (positive sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab2 = v4->generateAccessBuffer(s, w2 + wp, w1 + wp, XYZVertexTwoParticle::FrequencyChannel::S);
-		const XYZVertexTwoParticleAccessBuffer<4> ab3 = v4->generateAccessBuffer(s, -w2p - wp, w1p + wp, XYZVertexTwoParticle::FrequencyChannel::S);
+		ab[2] = v4->generateAccessBuffer(s, w2 + wp, w1 + wp, XYZVertexTwoParticle::FrequencyChannel::S);
+		ab[3] = v4->generateAccessBuffer(s, -w2p - wp, w1p + wp, XYZVertexTwoParticle::FrequencyChannel::S);
+	};
+	//access buffer tables are kept per thread, such that their storage is reused between calculations
+	thread_local AccessBufferTable<XYZVertexTwoParticleAccessBuffer<4>, 4> tableS;
+	tableS.reset();
+
+	auto integralKernelS = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	{
+		XYZVertexTwoParticleAccessBuffer<4> abFallback[4];
+		const XYZVertexTwoParticleAccessBuffer<4> *ab = tableS.get(wp, accessBuffersS, abFallback);
 
-		v4->getValueSuperbundle(ab0, stackBuffers[0]);
-		v4->getValueSuperbundle(ab1, stackBuffers[1]);
-		v4->getValueSuperbundle(ab2, stackBuffers[2]);
-		v4->getValueSuperbundle(ab3, stackBuffers[3]);
+		v4->getValueSuperbundle(ab[0], stackBuffers[0]);
+		v4->getValueSuperbundle(ab[1], stackBuffers[1]);
+		v4->getValueSuperbundle(ab[2], stackBuffers[2]);
+		v4->getValueSuperbundle(ab[3], stackBuffers[3]);
 
 		//calculate flow
 		returnBuffer.reset();
 
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
+		returnBuffer.bundle(static_cast<int>(SpinComponent::X)) += stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)) += stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)) += stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::None)) += stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
 	};
 
-	auto integralKernelT = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	//access buffers which are required by the T integration kernel at the integration frequency wp
+	auto accessBuffersT = [&](const float wp, XYZVertexTwoParticleAccessBuffer<4> *ab) -> void
 	{
 		//RPA diagram A and B equal chalice diagram A and inverse chalice diagram B, respectively (negative sign)
 		//chalice diagram A (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab0 = v4->generateAccessBuffer(w1 - wp, t, w1p + wp, XYZVertexTwoParticle::FrequencyChannel::T);
+		ab[0] = v4->generateAccessBuffer(w1 - wp, t, w1p + wp, XYZVertexTwoParticle::FrequencyChannel::T);
 		//inverse chalice diagram B (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab1 = v4->generateAccessBuffer(w2p - wp, t, -w2 - wp, XYZVertexTwoParticle::FrequencyChannel::T);
+		ab[1] = v4->generateAccessBuffer(w2p - wp, t, -w2 - wp, XYZVertexTwoParticle::FrequencyChannel::T);
 		//chalice diagram A (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab2 = v4->generateAccessBuffer(w1p + wp, t, w1 - wp, XYZVertexTwoParticle::FrequencyChannel::T);
+		ab[2] = v4->generateAccessBuffer(w1p + wp, t, w1 - wp, XYZVertexTwoParticle::FrequencyChannel::T);
 		//inverse chalice diagram B (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab3 = v4->generateAccessBuffer(w2 + wp, t, wp - w2p, XYZVertexTwoParticle::FrequencyChannel::T);
+		ab[3] = v4->generateAccessBuffer(w2 + wp, t, wp - w2p, XYZVertexTwoParticle::FrequencyChannel::T);
+		//chalice diagram B (negative sign)
+		ab[4] = v4->generateAccessBuffer(w2p - wp, -w2 - wp, t, XYZVertexTwoParticle::FrequencyChannel::U);
+		//inverse chalice diagram A (negative sign)
+		ab[5] = v4->generateAccessBuffer(w1 - wp, -w1p - wp, -t, XYZVertexTwoParticle::FrequencyChannel::U);
+		//chalice diagram B (negative sign)
+		ab[6] = v4->generateAccessBuffer(w2 + wp, wp - w2p, t, XYZVertexTwoParticle::FrequencyChannel::U);
+		//inverse chalice diagram A (negative sign)
+		ab[7] = v4->generateAccessBuffer(w1p + wp, wp - w1, -t, XYZVertexTwoParticle::FrequencyChannel::U);
+	};
+	thread_local AccessBufferTable<XYZVertexTwoParticleAccessBuffer<4>, 8> tableT;
+	tableT.reset();
 
-		v4->getValueSuperbundle(ab0, stackBuffers[0]);
-		v4->getValueSuperbundle(ab1, stackBuffers[1]);
-		v4->getValueSuperbundle(ab2, stackBuffers[2]);
-		v4->getValueSuperbundle(ab3, stackBuffers[3]);
+	auto integralKernelT = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	{
+		XYZVertexTwoParticleAccessBuffer<4> abFallback[8];
+		const XYZVertexTwoParticleAccessBuffer<4> *ab = tableT.get(wp, accessBuffersT, abFallback);
+
+		v4->getValueSuperbundle(ab[0], stackBuffers[0]);
+		v4->getValueSuperbundle(ab[1], stackBuffers[1]);
+		v4->getValueSuperbundle(ab[2], stackBuffers[2]);
+		v4->getValueSuperbundle(ab[3], stackBuffers[3]);
 
 		//calculate flow
 		returnBuffer.reset();
-		bufferRPA.reset();
-		for (int rid = 0; rid < FrgCommon::lattice().size; ++rid)
+		//lattice bubble
+		if (bubblePlan.isApplicable()) bubblePlan.product(stackBuffers[0], stackBuffers[1], bufferRPA, scratch);
+		else
 		{
-			//lattice bubble
-			const LatticeOverlap &overlap = FrgCommon::lattice().getOverlap(rid);
-
-			for (int i = 0; i < overlap.size; ++i)
-			{
-				bufferRPA.bundle(static_cast<int>(SpinComponent::X))[rid] += stackBuffers[0].bundle(static_cast<int>(overlap.transformedX1[i]))[overlap.rid1[i]] * stackBuffers[1].bundle(static_cast<int>(overlap.transformedX2[i]))[overlap.rid2[i]];
-			}
-
-			for (int i = 0; i < overlap.size; ++i)
-			{
-				bufferRPA.bundle(static_cast<int>(SpinComponent::Y))[rid] += stackBuffers[0].bundle(static_cast<int>(overlap.transformedY1[i]))[overlap.rid1[i]] * stackBuffers[1].bundle(static_cast<int>(overlap.transformedY2[i]))[overlap.rid2[i]];
-			}
-
-			for (int i = 0; i < overlap.size; ++i)
-			{
-				bufferRPA.bundle(static_cast<int>(SpinComponent::Z))[rid] += stackBuffers[0].bundle(static_cast<int>(overlap.transformedZ1[i]))[overlap.rid1[i]] * stackBuffers[1].bundle(static_cast<int>(overlap.transformedZ2[i]))[overlap.rid2[i]];
-			}
-
-			for (int i = 0; i < overlap.size; ++i)
-			{
-				bufferRPA.bundle(static_cast<int>(SpinComponent::None))[rid] += stackBuffers[0].bundle(3)[overlap.rid1[i]] * stackBuffers[1].bundle(3)[overlap.rid2[i]];
-			}
+			LatticeBubble::transpose(stackBuffers[0], siteMajorBuffers[0]);
+			LatticeBubble::transpose(stackBuffers[1], siteMajorBuffers[1]);
+			LatticeBubble::productSpinPermuted(FrgCommon::lattice().getOverlapTable(), siteMajorBuffers[0], siteMajorBuffers[1], bufferRPA);
 		}
 		returnBuffer.multAdd(4.0f, bufferRPA);
 
-		//chalice diagram B (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab4 = v4->generateAccessBuffer(w2p - wp, -w2 - wp, t, XYZVertexTwoParticle::FrequencyChannel::U);
-		//inverse chalice diagram A (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab5 = v4->generateAccessBuffer(w1 - wp, -w1p - wp, -t, XYZVertexTwoParticle::FrequencyChannel::U);
-		//chalice diagram B (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab6 = v4->generateAccessBuffer(w2 + wp, wp - w2p, t, XYZVertexTwoParticle::FrequencyChannel::U);
-		//inverse chalice diagram A (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab7 = v4->generateAccessBuffer(w1p + wp, wp - w1, -t, XYZVertexTwoParticle::FrequencyChannel::U);
-
-		const float valCbx = v4->getValueLocal(SpinComponent::X, ab4);
-		const float valCby = v4->getValueLocal(SpinComponent::Y, ab4);
-		const float valCbz = v4->getValueLocal(SpinComponent::Z, ab4);
-		const float valCbd = v4->getValueLocal(SpinComponent::None, ab4);
-		const float valICax = v4->getValueLocal(SpinComponent::X, ab5);
-		const float valICay = v4->getValueLocal(SpinComponent::Y, ab5);
-		const float valICaz = v4->getValueLocal(SpinComponent::Z, ab5);
-		const float valICad = v4->getValueLocal(SpinComponent::None, ab5);
-		const float valCbx2 = v4->getValueLocal(SpinComponent::X, ab6);
-		const float valCby2 = v4->getValueLocal(SpinComponent::Y, ab6);
-		const float valCbz2 = v4->getValueLocal(SpinComponent::Z, ab6);
-		const float valCbd2 = v4->getValueLocal(SpinComponent::None, ab6);
-		const float valICax2 = v4->getValueLocal(SpinComponent::X, ab7);
-		const float valICay2 = v4->getValueLocal(SpinComponent::Y, ab7);
-		const float valICaz2 = v4->getValueLocal(SpinComponent::Z, ab7);
-		const float valICad2 = v4->getValueLocal(SpinComponent::None, ab7);
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), valCbd);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), valCby);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), valCbz);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), valCbx);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(valICad, stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(valICaz, stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(valICay, stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(valICax, stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), valCbd2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), valCby2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), valCbz2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), valCbx2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(valICad2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(valICaz2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multAdd(valICay2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(valICax2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), valCbd);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), valCbx);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), valCbz);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), valCby);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(valICad, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(valICaz, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(valICax, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(valICay, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), valCbd2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), valCbx2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), valCbz2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), valCby2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(valICad2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(valICaz2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multAdd(valICax2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(valICay2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), valCbd);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), valCbx);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), valCby);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), valCbz);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(valICad, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(valICax, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(valICay, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(valICaz, stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), valCbd2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), valCbx2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), valCby2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), valCbz2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(valICad2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(valICax2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multAdd(valICay2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(valICaz2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), valCbd);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), valCbx);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), valCby);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), valCbz);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICad, stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICax, stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICay, stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICaz, stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), valCbd2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), valCbx2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), valCby2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), valCbz2);
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICad2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICax2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICay2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(valICaz2, stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
+		const float valCbx = v4->getValueLocal(SpinComponent::X, ab[4]);
+		const float valCby = v4->getValueLocal(SpinComponent::Y, ab[4]);
+		const float valCbz = v4->getValueLocal(SpinComponent::Z, ab[4]);
+		const float valCbd = v4->getValueLocal(SpinComponent::None, ab[4]);
+		const float valICax = v4->getValueLocal(SpinComponent::X, ab[5]);
+		const float valICay = v4->getValueLocal(SpinComponent::Y, ab[5]);
+		const float valICaz = v4->getValueLocal(SpinComponent::Z, ab[5]);
+		const float valICad = v4->getValueLocal(SpinComponent::None, ab[5]);
+		const float valCbx2 = v4->getValueLocal(SpinComponent::X, ab[6]);
+		const float valCby2 = v4->getValueLocal(SpinComponent::Y, ab[6]);
+		const float valCbz2 = v4->getValueLocal(SpinComponent::Z, ab[6]);
+		const float valCbd2 = v4->getValueLocal(SpinComponent::None, ab[6]);
+		const float valICax2 = v4->getValueLocal(SpinComponent::X, ab[7]);
+		const float valICay2 = v4->getValueLocal(SpinComponent::Y, ab[7]);
+		const float valICaz2 = v4->getValueLocal(SpinComponent::Z, ab[7]);
+		const float valICad2 = v4->getValueLocal(SpinComponent::None, ab[7]);
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::X)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * valCbd
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * valCby
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * valCbz
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * valCbx
+			+ valICad * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			- valICaz * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			- valICay * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ valICax * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * valCbd2
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * valCby2
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * valCbz2
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * valCbx2
+			+ valICad2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			- valICaz2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			- valICay2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			+ valICax2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * valCbd
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * valCbx
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * valCbz
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * valCby
+			+ valICad * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			- valICaz * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			- valICax * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ valICay * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * valCbd2
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * valCbx2
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * valCbz2
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * valCby2
+			+ valICad2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			- valICaz2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			- valICax2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ valICay2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * valCbd
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * valCbx
+			- stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * valCby
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * valCbz
+			+ valICad * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			- valICax * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			- valICay * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ valICaz * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * valCbd2
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * valCbx2
+			- stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * valCby2
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * valCbz2
+			+ valICad2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z))
+			- valICax2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z))
+			- valICay2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z))
+			+ valICaz2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::None)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * valCbd
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * valCbx
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * valCby
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * valCbz
+			+ valICad * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ valICax * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ valICay * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ valICaz * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * valCbd2
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * valCbx2
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * valCby2
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * valCbz2
+			+ valICad2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ valICax2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ valICay2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ valICaz2 * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None));
 	};
 
-	auto integralKernelU = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	//access buffers which are required by the U integration kernel at the integration frequency wp
+	auto accessBuffersU = [&](const float wp, XYZVertexTwoParticleAccessBuffer<4> *ab) -> void
 	{
 		//u-Channel, to be combined with P(wp, u + wp) + P(u + wp, wp)
 		//ph-ladder A and B, respectively (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab0 = v4->generateAccessBuffer(w1 + wp, wp - w2p, u, XYZVertexTwoParticle::FrequencyChannel::U);
-		const XYZVertexTwoParticleAccessBuffer<4> ab1 = v4->generateAccessBuffer(w1p + wp, w2 - wp, u, XYZVertexTwoParticle::FrequencyChannel::U);
+		ab[0] = v4->generateAccessBuffer(w1 + wp, wp - w2p, u, XYZVertexTwoParticle::FrequencyChannel::U);
+		ab[1] = v4->generateAccessBuffer(w1p + wp, w2 - wp, u, XYZVertexTwoParticle::FrequencyChannel::U);
 		//ph-ladder A and B, respectively (negative sign)
-		const XYZVertexTwoParticleAccessBuffer<4> ab2 = v4->generateAccessBuffer(w2p - wp, -w1 - wp, u, XYZVertexTwoParticle::FrequencyChannel::U);
-		const XYZVertexTwoParticleAccessBuffer<4> ab3 = v4->generateAccessBuffer(w2 - wp, w1p + wp, u, XYZVertexTwoParticle::FrequencyChannel::U);
+		ab[2] = v4->generateAccessBuffer(w2p - wp, -w1 - wp, u, XYZVertexTwoParticle::FrequencyChannel::U);
+		ab[3] = v4->generateAccessBuffer(w2 - wp, w1p + wp, u, XYZVertexTwoParticle::FrequencyChannel::U);
+	};
+	thread_local AccessBufferTable<XYZVertexTwoParticleAccessBuffer<4>, 4> tableU;
+	tableU.reset();
 
-		v4->getValueSuperbundle(ab0, stackBuffers[0]);
-		v4->getValueSuperbundle(ab1, stackBuffers[1]);
-		v4->getValueSuperbundle(ab2, stackBuffers[2]);
-		v4->getValueSuperbundle(ab3, stackBuffers[3]);
+	auto integralKernelU = [&](const float wp, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	{
+		XYZVertexTwoParticleAccessBuffer<4> abFallback[4];
+		const XYZVertexTwoParticleAccessBuffer<4> *ab = tableU.get(wp, accessBuffersU, abFallback);
+
+		v4->getValueSuperbundle(ab[0], stackBuffers[0]);
+		v4->getValueSuperbundle(ab[1], stackBuffers[1]);
+		v4->getValueSuperbundle(ab[2], stackBuffers[2]);
+		v4->getValueSuperbundle(ab[3], stackBuffers[3]);
 
 		//calculate flow
 		returnBuffer.reset();
 
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::X)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::None)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::X)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y)));
-		returnBuffer.bundle(static_cast<int>(SpinComponent::None)).multSub(stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)), stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z)));
-	};
-
-	//propagator bubble
-	auto p = [&](const float w1, const float w2) -> float
-	{
-		return 1.0f / ((w1 + v2->getValue(w1)) *(w2 + v2->getValue(w2)));
-	};
-
-	//Katanin contribution, call only once the flow has been fully calculated and broadcasted
-	auto pKataninContribution = [&](const float w1, const float w2) -> float
-	{
-		float denomW1 = w1 + v2->getValue(w1);
-		return static_cast<XYZEffectiveAction *>(_flow)->vertexSingleParticle->getValue(w1) / (denomW1 * denomW1 * (w2 + v2->getValue(w2)));
+		returnBuffer.bundle(static_cast<int>(SpinComponent::X)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::Y)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::Z)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X));
+
+		returnBuffer.bundle(static_cast<int>(SpinComponent::None)) -= stackBuffers[0].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[0].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[1].bundle(static_cast<int>(SpinComponent::Z))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::None)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::None))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::X)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::X))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Y)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Y))
+			+ stackBuffers[2].bundle(static_cast<int>(SpinComponent::Z)) * stackBuffers[3].bundle(static_cast<int>(SpinComponent::Z));
 	};
 
 	//begin calculation of vertices here
 	//conventional contribution
 	integralKernelS(cutoff, buffer1);
-	v4CurrentValue.multAdd(p(cutoff, cutoff + s), buffer1);
+	v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(s), buffer1);
 	if (s > 2.0f * cutoff)
 	{
 		integralKernelS(-cutoff, buffer1);
-		v4CurrentValue.multAdd(p(cutoff, cutoff - s), buffer1);
+		v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(-s), buffer1);
 	}
 	integralKernelT(cutoff, buffer1);
-	v4CurrentValue.multAdd(p(cutoff, cutoff + t), buffer1);
+	v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(t), buffer1);
 	if (t > 2.0f * cutoff)
 	{
 		integralKernelT(-cutoff, buffer1);
-		v4CurrentValue.multAdd(p(cutoff, cutoff - t), buffer1);
+		v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(-t), buffer1);
 	}
 	integralKernelU(cutoff, buffer1);
-	v4CurrentValue.multAdd(p(cutoff, cutoff + u), buffer1);
+	v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(u), buffer1);
 	if (u > 2.0f * cutoff)
 	{
 		integralKernelU(-cutoff, buffer1);
-		v4CurrentValue.multAdd(p(cutoff, cutoff - u), buffer1);
+		v4CurrentValue.multAdd(propagatorCache.propagatorCutoff(-u), buffer1);
 	}
 
 	//Katanin contribution
-	std::function<void(float, ValueSuperbundle<float, 4> &)> integralKernelSKatanin = [&](float wp, ValueSuperbundle<float, 4> &returnBuffer)->void { integralKernelS(wp, returnBuffer); returnBuffer *= pKataninContribution(wp, s + wp); };
-	std::function<void(float, ValueSuperbundle<float, 4> &)> integralKernelTKatanin = [&](float wp, ValueSuperbundle<float, 4> &returnBuffer)->void { integralKernelT(wp, returnBuffer); returnBuffer *= pKataninContribution(wp, t + wp); };
-	std::function<void(float, ValueSuperbundle<float, 4> &)> integralKernelUKatanin = [&](float wp, ValueSuperbundle<float, 4> &returnBuffer)->void { integralKernelU(wp, returnBuffer); returnBuffer *= pKataninContribution(wp, u + wp); };
+	auto integralKernelSKatanin = [&](float wp, ValueSuperbundle<float, 4> &returnBuffer)->void { integralKernelS(wp, returnBuffer); returnBuffer *= propagatorCache.kataninPropagator(wp, s + wp); };
+	auto integralKernelTKatanin = [&](float wp, ValueSuperbundle<float, 4> &returnBuffer)->void { integralKernelT(wp, returnBuffer); returnBuffer *= propagatorCache.kataninPropagator(wp, t + wp); };
+	auto integralKernelUKatanin = [&](float wp, ValueSuperbundle<float, 4> &returnBuffer)->void { integralKernelU(wp, returnBuffer); returnBuffer *= propagatorCache.kataninPropagator(wp, u + wp); };
 
-	if (-(s + cutoff) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(s + cutoff), integralKernelSKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (s - cutoff > cutoff)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - s, -cutoff, integralKernelSKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (cutoff < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integralKernelSKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
+	//tabulate the access buffers of the S channel at the frequency mesh points inside the integration range
+	tableS.generate(accessBuffersS, s, cutoff);
+	ImplicitIntegrator::integrateOutsideCutoff(s, cutoff, integralKernelSKatanin, buffer1, buffer2, v4CurrentValue);
 
-	if (-(t + cutoff) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(t + cutoff), integralKernelTKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (t - cutoff > cutoff)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - t, -cutoff, integralKernelTKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (cutoff < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integralKernelTKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
+	//tabulate the access buffers of the T channel at the frequency mesh points inside the integration range
+	tableT.generate(accessBuffersT, t, cutoff);
+	ImplicitIntegrator::integrateOutsideCutoff(t, cutoff, integralKernelTKatanin, buffer1, buffer2, v4CurrentValue);
 
-	if (-(u + cutoff) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(u + cutoff), integralKernelUKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (u - cutoff > cutoff)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - u, -cutoff, integralKernelUKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
-	if (cutoff < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integralKernelUKatanin, buffer1, buffer2);
-		v4CurrentValue += buffer2;
-	}
+	//tabulate the access buffers of the U channel at the frequency mesh points inside the integration range
+	tableU.generate(accessBuffersU, u, cutoff);
+	ImplicitIntegrator::integrateOutsideCutoff(u, cutoff, integralKernelUKatanin, buffer1, buffer2, v4CurrentValue);
 
 	//prefactor
 	v4CurrentValue /= (2.0f * (float)M_PI);
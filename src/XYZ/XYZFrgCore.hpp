@@ -8,6 +8,8 @@
 
 #pragma once
 #include "FrgCore.hpp"
+#include "PropagatorCache.hpp"
+#include "LatticeBubble.hpp"
 
 /**
  * @brief FrgCore implementation for models with diagonal interactions.
@@ -41,7 +43,15 @@ public:
 	 */
 	void finalizeStep(const float newCutoff) override;
 
+	/**
+	 * @brief Broadcast the flowing functional to all MPI ranks. 
+	 */
+	void synchronizeFlowingFunctional() override;
+
 	float normalization; ///< Energy normalization factor. 
+	FloatFormat vertexFormat; ///< Storage format of the two-particle vertex of the flowing functional. 
+	PropagatorCache propagatorCache; ///< Propagator cache at the current cutoff, which is built once per step. 
+	LatticeBubble::FourierPlan bubblePlan; ///< Plan for the evaluation of the lattice bubble in momentum space. Only applicable if requested by the option bubble=fft, supported by the lattice, and estimated to be faster than the direct summation. 
 
 private:
 	int dataStacks[12]; ///< References to the LoadManager::DataStack. 
@@ -58,5 +68,5 @@ private:
 	 * 
 	 * @param iterator Linear iterator. 
 	 */
-	void _calculateVertexTwoParticle(const int iterator);
+	void _calculateVertexTwoParticle(const int64_t iterator);
 };
\ No newline at end of file
@@ -84,7 +84,13 @@ XYZMeasurementCorrelation::~XYZMeasurementCorrelation()
 
 void XYZMeasurementCorrelation::takeMeasurement(const EffectiveAction &state, const bool isMasterTask) const
 {
-	if (_currentCutoff != state.cutoff) SpinParser::spinParser()->getLoadManager()->calculate(_loadManagedStacks.data(), int(_loadManagedStacks.size()));
+	if (_currentCutoff != state.cutoff)
+	{
+		//measurements may be taken without a preceding flow step (e.g. after the final step), hence rebuild the propagator cache for the current state
+		XYZFrgCore *core = static_cast<XYZFrgCore *>(SpinParser::spinParser()->getFrgCore());
+		core->propagatorCache.update(state.cutoff, static_cast<const XYZEffectiveAction &>(state).vertexSingleParticle->_data, static_cast<XYZEffectiveAction *>(core->flow())->vertexSingleParticle->_data);
+		SpinParser::spinParser()->getLoadManager()->calculate(_loadManagedStacks.data(), int(_loadManagedStacks.size()));
+	}
 
 	if (isMasterTask)
 	{
@@ -100,30 +106,34 @@ void XYZMeasurementCorrelation::_calculateCorrelation(const int iterator) const
 	//calculate real space susceptibility
 	float nu = 0.0f;
 	float cut = SpinParser::spinParser()->getFrgCore()->flowingFunctional()->cutoff;
-	XYZVertexSingleParticle *v2 = static_cast<XYZEffectiveAction *>(SpinParser::spinParser()->getFrgCore()->flowingFunctional())->vertexSingleParticle;
+	const PropagatorCache &propagatorCache = static_cast<XYZFrgCore *>(SpinParser::spinParser()->getFrgCore())->propagatorCache;
 	XYZVertexTwoParticle *v4 = static_cast<XYZEffectiveAction *>(SpinParser::spinParser()->getFrgCore()->flowingFunctional())->vertexTwoParticle;
 
-	ValueSuperbundle<float, 4> susceptibility(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> stackBuffer(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> buffer1(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> buffer2(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> buffer3(FrgCommon::lattice().size);
-	ValueSuperbundle<float, 4> buffer4(FrgCommon::lattice().size);
+	//buffers are borrowed from the thread-local scratch arena and released when the function returns
+	ScratchArena &scratch = ScratchArena::local();
+	ScratchArena::Scope scratchScope(scratch);
+
+	ValueSuperbundle<float, 4> susceptibility(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> stackBuffer(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> buffer1(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> buffer2(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> buffer3(FrgCommon::lattice().size, scratch);
+	ValueSuperbundle<float, 4> buffer4(FrgCommon::lattice().size, scratch);
 
 	//integration kernel
-	std::function<void(float, ValueSuperbundle<float, 4> &)> integralKernel = [&](const float w, ValueSuperbundle<float, 4> &returnBuffer) -> void
+	auto integralKernel = [&](const float w, ValueSuperbundle<float, 4> &returnBuffer) -> void
 	{
 		returnBuffer.reset();
 
 		//term1
-		float term1 = 1.0f / ((w + v2->getValue(w)) * (w + nu + v2->getValue(w + nu)));
+		float term1 = propagatorCache.propagator(w, w + nu);
 		returnBuffer.bundle(static_cast<int>(SpinComponent::X))[0] += term1 / float(4.0f * M_PI);
 		returnBuffer.bundle(static_cast<int>(SpinComponent::Y))[0] += term1 / float(4.0f * M_PI);
 		returnBuffer.bundle(static_cast<int>(SpinComponent::Z))[0] += term1 / float(4.0f * M_PI);
 		returnBuffer.bundle(static_cast<int>(SpinComponent::None))[0] += term1 / float(M_PI);
 
 		//term2
-		std::function<void(float, ValueSuperbundle<float, 4> &)> innerKernel = [&](const float wp, ValueSuperbundle<float, 4> &ret) -> void
+		auto innerKernel = [&](const float wp, ValueSuperbundle<float, 4> &ret) -> void
 		{
 			ret.reset();
 			const XYZVertexTwoParticleAccessBuffer<8> ab0 = v4->generateAccessBuffer(w + wp + nu, nu, w - wp);
@@ -146,41 +156,13 @@ void XYZMeasurementCorrelation::_calculateCorrelation(const int iterator) const
 			ret.bundle(static_cast<int>(SpinComponent::Z))[0] += 0.5f * (-vx - vy + vz + vd);
 			ret.bundle(static_cast<int>(SpinComponent::None))[0] += 2.0f * (vx + vy + vz + vd);
 
-			float normalization = 1.0f / ((w + v2->getValue(w)) * (w + nu + v2->getValue(w + nu)) * (wp + v2->getValue(wp)) * (wp + nu + v2->getValue(wp + nu)) * float(4.0f * M_PI * M_PI));
+			float normalization = 1.0f / (propagatorCache.denominator(w) * propagatorCache.denominator(w + nu) * propagatorCache.denominator(wp) * propagatorCache.denominator(wp + nu) * float(4.0f * M_PI * M_PI));
 			ret *= normalization;
 		};
-		if (-(nu + cut) > *FrgCommon::frequency().beginNegative())
-		{
-			ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -cut - nu, innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
-		if (nu - cut > cut)
-		{
-			ImplicitIntegrator::integrateWithObscureBoundaries(-nu + cut, -cut, innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
-		if (cut < *FrgCommon::frequency().last())
-		{
-			ImplicitIntegrator::integrateWithObscureLeftBoundary(cut, FrgCommon::frequency().last(), innerKernel, buffer3, buffer4);
-			returnBuffer += buffer4;
-		}
+		ImplicitIntegrator::integrateOutsideCutoff(nu, cut, innerKernel, buffer3, buffer4, returnBuffer);
 	};
 
-	if (-(nu + cut) > *FrgCommon::frequency().beginNegative())
-	{
-		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -cut - nu, integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
-	if (nu - cut > cut)
-	{
-		ImplicitIntegrator::integrateWithObscureBoundaries(-nu + cut, -cut, integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
-	if (cut < *FrgCommon::frequency().last())
-	{
-		ImplicitIntegrator::integrateWithObscureLeftBoundary(cut, FrgCommon::frequency().last(), integralKernel, buffer1, buffer2);
-		susceptibility += buffer2;
-	}
+	ImplicitIntegrator::integrateOutsideCutoff(nu, cut, integralKernel, buffer1, buffer2, susceptibility);
 
 	int offset = iterator * _memoryStepLattice;
 	for (auto i = FrgCommon::lattice().getBasis(); i != FrgCommon::lattice().end(); ++i)
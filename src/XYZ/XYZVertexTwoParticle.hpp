@@ -8,7 +8,10 @@
 
 #pragma once
 #include <istream>
+#include <cstdint>
+#include <vector>
 #include "lib/ValueBundle.hpp"
+#include "lib/FloatArray.hpp"
 #include "lib/Assert.hpp"
 #include "FrgCommon.hpp"
 
@@ -29,7 +32,7 @@ public:
 	 */
 	XYZVertexTwoParticleAccessBuffer() : siteExchange(false) {}
 
-	int frequencyOffsets[size]; ///< Linear memory offset (number of elements) in the frequency dimensions of the two-particle vertex.  
+	int64_t frequencyOffsets[size]; ///< Linear memory offset (number of elements) in the frequency dimensions of the two-particle vertex.  
 	float frequencyWeights[size]; ///< Weight factors of the support values. 
 	int signFlag[size]; ///< Sign factors of the support values. 
 	bool siteExchange; ///< Site exchange indicator. 
@@ -55,26 +58,26 @@ public:
 
 	/**
 	 * @brief Construct a new XYZVertexTwoParticle object and initialize all entries to zero. 
+	 * @details If a 16 bit storage format is specified, vertex values are stored compactly in that format and decoded to single precision upon access. 
 	 * 
+	 * @param format Storage format of the vertex values. 
 	 */
-	XYZVertexTwoParticle()
+	XYZVertexTwoParticle(const FloatFormat format = FloatFormat::Float32)
 	{
 		//store width in all memory dimensions
 		_memoryStepLattice = FrgCommon::lattice().size;
 		_memoryStepLatticeT = _memoryStepLattice * FrgCommon::frequency().size;
 
-		sizeFrequency = FrgCommon::frequency().size * FrgCommon::frequency().size * (FrgCommon::frequency().size + 1) / 2;
+		sizeFrequency = int64_t(FrgCommon::frequency().size) * FrgCommon::frequency().size * (FrgCommon::frequency().size + 1) / 2;
 		size = FrgCommon::lattice().size * sizeFrequency;
 
 		//alloc and init memory
-		_dataXX = new float[size];
-		_dataYY = new float[size];
-		_dataZZ = new float[size];
-		_dataDD = new float[size];
-		memset(_dataXX, 0, sizeof(float) * size);
-		memset(_dataYY, 0, sizeof(float) * size);
-		memset(_dataZZ, 0, sizeof(float) * size);
-		memset(_dataDD, 0, sizeof(float) * size);
+		_dataXX = FloatArray::allocate(size, format);
+		_dataYY = FloatArray::allocate(size, format);
+		_dataZZ = FloatArray::allocate(size, format);
+		_dataDD = FloatArray::allocate(size, format);
+
+		_exchangedValid = false;
 	}
 
 	/**
@@ -82,10 +85,61 @@ public:
 	 */
 	~XYZVertexTwoParticle()
 	{
-		delete[] _dataXX;
-		delete[] _dataYY;
-		delete[] _dataZZ;
-		delete[] _dataDD;
+		_dataXX.release();
+		_dataYY.release();
+		_dataZZ.release();
+		_dataDD.release();
+		for (int c = 0; c < 4; ++c) _exchanged[c].release();
+	}
+
+	/**
+	 * @brief Allocate a contiguous copy of the site-exchanged and spin-permuted vertex, such that getValueSuperbundle() reads vertex values as unit-stride streams also upon site exchange. 
+	 * @details The copy is valid after a call to updateExchangedCopy() until invalidateExchangedCopy() is called or vertex values are modified. The copy is stored in the storage format of the vertex and doubles its memory footprint. 
+	 */
+	void enableExchangedCopy()
+	{
+		if (hasExchangedCopy()) return;
+		for (int c = 0; c < 4; ++c) _exchanged[c] = FloatArray::allocate(size, _dataDD.format());
+		_exchangedValid = false;
+	}
+
+	/**
+	 * @brief Check whether a copy of the site-exchanged vertex has been allocated. 
+	 * 
+	 * @return bool True if enableExchangedCopy() has been called. 
+	 */
+	bool hasExchangedCopy() const
+	{
+		return _exchanged[0].size() > 0;
+	}
+
+	/**
+	 * @brief Update the copy of the site-exchanged vertex from the current vertex values. The values of each frequency line are reordered according to the inverted site table, including the spin permutations. Does nothing if no copy has been allocated. 
+	 */
+	void updateExchangedCopy()
+	{
+		if (!hasExchangedCopy()) return;
+		if (_dataDD.isCompact())
+		{
+			const uint16_t *base[4] = { _dataXX.compactData(), _dataYY.compactData(), _dataZZ.compactData(), _dataDD.compactData() };
+			uint16_t *exchanged[4] = { _exchanged[0].compactData(), _exchanged[1].compactData(), _exchanged[2].compactData(), _exchanged[3].compactData() };
+			_updateExchangedCopy(base, exchanged);
+		}
+		else
+		{
+			const float *base[4] = { _dataXX.data(), _dataYY.data(), _dataZZ.data(), _dataDD.data() };
+			float *exchanged[4] = { _exchanged[0].data(), _exchanged[1].data(), _exchanged[2].data(), _exchanged[3].data() };
+			_updateExchangedCopy(base, exchanged);
+		}
+		_exchangedValid = true;
+	}
+
+	/**
+	 * @brief Mark the copy of the site-exchanged vertex as invalid. Subsequently, getValueSuperbundle() reads site-exchanged values via the inverted site table again. 
+	 */
+	void invalidateExchangedCopy()
+	{
+		_exchangedValid = false;
 	}
 
 	/**
@@ -97,7 +151,7 @@ public:
 	 * @param[out] t Second frequency argument. 
 	 * @param[out] u Third frequency argument. 
 	 */
-	void expandIterator(int iterator, LatticeIterator &i1, float &s, float &t, float &u) const
+	void expandIterator(int64_t iterator, LatticeIterator &i1, float &s, float &t, float &u) const
 	{
 		ASSERT(iterator >= 0 && iterator < size);
 		ASSERT(iterator >= 0 && iterator < size);
@@ -105,24 +159,16 @@ public:
 		ASSERT(&t != &u);
 		ASSERT(&s != &u);
 
-		int it = iterator;
-		int su = it / _memoryStepLatticeT;
+		int64_t it = iterator;
+		int su = int(it / _memoryStepLatticeT);
 		it = it % _memoryStepLatticeT;
 		t = FrgCommon::frequency()._data[it / _memoryStepLattice];
-		i1 = FrgCommon::lattice().fromParametrization(it % _memoryStepLattice);
+		i1 = FrgCommon::lattice().fromParametrization(int(it % _memoryStepLattice));
 
-		for (int so = 0; so <= su; ++so)
-		{
-			for (int uo = 0; uo <= so; ++uo)
-			{
-				if (su == so * (so + 1) / 2 + uo)
-				{
-					s = FrgCommon::frequency()._data[so];
-					u = FrgCommon::frequency()._data[uo];
-					return;
-				}
-			}
-		}
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(su, so, uo);
+		s = FrgCommon::frequency()._data[so];
+		u = FrgCommon::frequency()._data[uo];
 	}
 
 	/**
@@ -133,7 +179,7 @@ public:
 	 * @param[out] t Second frequency argument. 
 	 * @param[out] u Third frequency argument. 
 	 */
-	void expandIterator(int iterator, float &s, float &t, float &u) const
+	void expandIterator(int64_t iterator, float &s, float &t, float &u) const
 	{
 		ASSERT(iterator >= 0 && iterator < sizeFrequency);
 		ASSERT(iterator >= 0 && iterator < size);
@@ -141,18 +187,51 @@ public:
 		ASSERT(&t != &u);
 		ASSERT(&s != &u);
 
-		int su = iterator / FrgCommon::frequency().size;
+		int su = int(iterator / FrgCommon::frequency().size);
 		t = FrgCommon::frequency()._data[iterator % FrgCommon::frequency().size];
 
-		for (int so = 0; so <= su; ++so)
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(su, so, uo);
+		s = FrgCommon::frequency()._data[so];
+		u = FrgCommon::frequency()._data[uo];
+	}
+
+	/**
+	 * @brief Expand a contiguous range [begin,end) of linear iterators in the range [0,sizeFrequency) that iterate over all parametrized frequency values. 
+	 * @details The frequency arguments are advanced incrementally, such that the cost per iterator is constant. 
+	 * Within each frequency value, the lattice site is the fastest running memory dimension. 
+	 * 
+	 * @param[in] begin First linear iterator. 
+	 * @param[in] end Linear iterator past the last expanded iterator. 
+	 * @param[out] s First frequency arguments. Must provide space for end-begin values. 
+	 * @param[out] t Second frequency arguments. Must provide space for end-begin values. 
+	 * @param[out] u Third frequency arguments. Must provide space for end-begin values. 
+	 */
+	void expandIterators(const int64_t begin, const int64_t end, float *s, float *t, float *u) const
+	{
+		ASSERT(begin >= 0 && begin <= end && end <= sizeFrequency);
+
+		if (begin == end) return;
+		const int frequencySize = FrgCommon::frequency().size;
+		const float *frequency = FrgCommon::frequency()._data;
+
+		int so, uo;
+		FrequencyDiscretization::expandTriangularIndex(begin / frequencySize, so, uo);
+		int to = int(begin % frequencySize);
+
+		for (int64_t i = 0; i < end - begin; ++i)
 		{
-			for (int uo = 0; uo <= so; ++uo)
+			s[i] = frequency[so];
+			t[i] = frequency[to];
+			u[i] = frequency[uo];
+
+			if (++to == frequencySize)
 			{
-				if (su == so * (so + 1) / 2 + uo)
+				to = 0;
+				if (++uo > so)
 				{
-					s = FrgCommon::frequency()._data[so];
-					u = FrgCommon::frequency()._data[uo];
-					return;
+					uo = 0;
+					++so;
 				}
 			}
 		}
@@ -161,11 +240,13 @@ public:
 	/**
 	 * @brief Directly access a vertex value via a linear iterator in the range [0,size). 
 	 * 
+	 * @details Values which are written to a compactly stored vertex are rounded to the precision of the storage format. 
+	 * 
 	 * @param iterator Linear iterator. 
 	 * @param symmetry Vertex channel. 
-	 * @return float& Vertex value. 
+	 * @return FloatArray::Reference Reference to the vertex value. 
 	 */
-	float &getValueRef(const int iterator, const SpinComponent symmetry) const
+	FloatArray::Reference getValueRef(const int64_t iterator, const SpinComponent symmetry) const
 	{
 		if (symmetry == SpinComponent::X) return _dataXX[iterator];
 		if (symmetry == SpinComponent::Y) return _dataYY[iterator];
@@ -385,23 +466,45 @@ public:
 	template <int n> void getValueSuperbundle(const XYZVertexTwoParticleAccessBuffer<n> &accessBuffer, ValueSuperbundle<float, 4> &superbundle) const
 	{
 		superbundle.reset();
-		const LatticeSiteDescriptor *sites = (accessBuffer.siteExchange) ? FrgCommon::lattice().getInvertedSites() : FrgCommon::lattice().getSites();
 
-		float *base[4] = { _dataXX, _dataYY, _dataZZ, _dataDD };
+		//representative sites are the trivial representatives of their equivalence class, i.e. getSites()[j] has rid j and no spin permutation, such that the vertex values of a frequency line are contiguous without site exchange. 
+		//upon site exchange, they are read contiguously from the exchanged copy if it is valid. 
+		const FloatArray *base[4] = { &_dataXX, &_dataYY, &_dataZZ, &_dataDD };
+		bool contiguous = !accessBuffer.siteExchange || _exchangedValid;
+		if (accessBuffer.siteExchange && _exchangedValid)
+		{
+			for (int c = 0; c < 4; ++c) base[c] = &_exchanged[c];
+		}
+		const LatticeSiteDescriptor *sites = FrgCommon::lattice().getInvertedSites();
+		int size = FrgCommon::lattice().size;
+
+		//compactly stored frequency lines are decoded to a thread-local buffer
+		thread_local std::vector<float> lineBuffer;
+		if (_dataDD.isCompact()) lineBuffer.resize(4 * size);
 
 		for (int i = 0; i < n; ++i)
 		{
 			float weight = accessBuffer.frequencyWeights[i];
 			float signedWeight = accessBuffer.signFlag[i] * accessBuffer.frequencyWeights[i];
-			int frequencyOffset = accessBuffer.frequencyOffsets[i];
-			int size = FrgCommon::lattice().size;
+			int64_t frequencyOffset = accessBuffer.frequencyOffsets[i];
 
-			for (int j = 0; j < size; ++j)
+			const float *line[4];
+			for (int c = 0; c < 4; ++c) line[c] = base[c]->line(frequencyOffset, size, lineBuffer.data() + c * size);
+
+			if (contiguous)
+			{
+				for (int c = 0; c < 3; ++c) SimdKernels::apply<SimdKernels::Operation::MultAddScalar>(superbundle.bundle(c).data(), line[c], static_cast<const float *>(nullptr), weight, size);
+				SimdKernels::apply<SimdKernels::Operation::MultAddScalar>(superbundle.bundle(3).data(), line[3], static_cast<const float *>(nullptr), signedWeight, size);
+			}
+			else
 			{
-				superbundle.bundle(0)[j] += weight * base[static_cast<int>(sites[j].spinPermutation[0])][frequencyOffset + sites[j].rid];
-				superbundle.bundle(1)[j] += weight * base[static_cast<int>(sites[j].spinPermutation[1])][frequencyOffset + sites[j].rid];
-				superbundle.bundle(2)[j] += weight * base[static_cast<int>(sites[j].spinPermutation[2])][frequencyOffset + sites[j].rid];
-				superbundle.bundle(3)[j] += signedWeight * base[3][frequencyOffset + sites[j].rid];
+				for (int j = 0; j < size; ++j)
+				{
+					superbundle.bundle(0)[j] += weight * line[static_cast<int>(sites[j].spinPermutation[0])][sites[j].rid];
+					superbundle.bundle(1)[j] += weight * line[static_cast<int>(sites[j].spinPermutation[1])][sites[j].rid];
+					superbundle.bundle(2)[j] += weight * line[static_cast<int>(sites[j].spinPermutation[2])][sites[j].rid];
+					superbundle.bundle(3)[j] += signedWeight * line[3][sites[j].rid];
+				}
 			}
 		}
 	}
@@ -622,7 +725,7 @@ public:
 		if (symmetry == SpinComponent::X) return _dataXX[_memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset];
 		if (symmetry == SpinComponent::Y) return _dataYY[_memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset];
 		if (symmetry == SpinComponent::Z) return _dataZZ[_memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset];
-		else return *(_dataDD + _memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset);
+		else return _dataDD[_memoryStepLatticeT * (sOffset * (sOffset + 1) / 2 + uOffset) + _memoryStepLattice * tOffset + siteOffset];
 	}
 
 	/**
@@ -632,9 +735,9 @@ public:
 	 * @param[in] tOffset Second frequency offset (number of elements). 
 	 * @param[in] uOffset Third frequency offset (number of elements). 
 	 * @param[out] signFlag Sign flag to be stored in the access buffer. 
-	 * @return int Memory offset (number of elements). 
+	 * @return int64_t Memory offset (number of elements). 
 	 */
-	int _generateAccessBufferOffset(const int sOffset, const int tOffset, const int uOffset, int &signFlag) const
+	int64_t _generateAccessBufferOffset(const int sOffset, const int tOffset, const int uOffset, int &signFlag) const
 	{
 		ASSERT(sOffset >= 0 && sOffset < FrgCommon::frequency().size);
 		ASSERT(tOffset >= 0 && tOffset < FrgCommon::frequency().size);
@@ -652,13 +755,41 @@ public:
 		}
 	}
 
-	int size; ///< Size of the vertex per vertex channel (number of elements). 
-	int sizeFrequency; ///< Size of the vertex per vertex channel in the frequency subspace (number of elements). 
+	/**
+	 * @brief Copy the site-exchanged and spin-permuted vertex values to the exchanged copy without conversion between storage formats. 
+	 * 
+	 * @tparam T Storage type of the vertex values. 
+	 * @param base Spin-X, spin-Y, spin-Z, and density channels of the vertex. 
+	 * @param exchanged Spin-X, spin-Y, spin-Z, and density channels of the exchanged copy. 
+	 */
+	template <class T> void _updateExchangedCopy(const T *const base[4], T *const exchanged[4]) const
+	{
+		const LatticeSiteDescriptor *invertedSites = FrgCommon::lattice().getInvertedSites();
+		int latticeSize = FrgCommon::lattice().size;
+
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (int64_t line = 0; line < sizeFrequency; ++line)
+		{
+			int64_t offset = line * latticeSize;
+			for (int j = 0; j < latticeSize; ++j)
+			{
+				for (int c = 0; c < 3; ++c) exchanged[c][offset + j] = base[static_cast<int>(invertedSites[j].spinPermutation[c])][offset + invertedSites[j].rid];
+				exchanged[3][offset + j] = base[3][offset + invertedSites[j].rid];
+			}
+		}
+	}
 
-	float *_dataXX; ///< Spin-X channel of the vertex. 
-	float *_dataYY; ///< Spin-Y channel of the vertex. 
-	float *_dataZZ; ///< Spin-Z channel of the vertex. 
-	float *_dataDD; ///< Density channel of the vertex. 
-	int _memoryStepLatticeT; ///< Memory stride width in the last-2 dimension. 
-	int _memoryStepLattice; ///< Memory stride width in the last-1 dimension. 
+	int64_t size; ///< Size of the vertex per vertex channel (number of elements). 
+	int64_t sizeFrequency; ///< Size of the vertex per vertex channel in the frequency subspace (number of elements). 
+
+	FloatArray _dataXX; ///< Spin-X channel of the vertex. 
+	FloatArray _dataYY; ///< Spin-Y channel of the vertex. 
+	FloatArray _dataZZ; ///< Spin-Z channel of the vertex. 
+	FloatArray _dataDD; ///< Density channel of the vertex. 
+	FloatArray _exchanged[4]; ///< Contiguous copies of the site-exchanged spin-X, spin-Y, spin-Z, and density channels, or empty if not allocated. 
+	bool _exchangedValid; ///< Indicates whether the site-exchanged copies agree with the current vertex values. 
+	int64_t _memoryStepLatticeT; ///< Memory stride width in the last-2 dimension. 
+	int64_t _memoryStepLattice; ///< Memory stride width in the last-1 dimension. 
 };
\ No newline at end of file
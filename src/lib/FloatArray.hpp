@@ -0,0 +1,312 @@
+/**
+ * @file FloatArray.hpp
+ * @author Finn Lasse Buessen
+ * @brief Array of single precision values which are stored either in single precision or in a 16 bit storage format.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include "lib/Assert.hpp"
+#include "lib/FloatFormat.hpp"
+
+/**
+ * @brief Non-owning view of an array of single precision values, which are stored either in single precision or, compactly, in a 16 bit storage format.
+ * @details Compactly stored values are decoded on every read and encoded on every write, such that the array behaves like an array of single precision values
+ * whose precision is limited to the storage format. Copies of the view refer to the same memory.
+ */
+struct FloatArray
+{
+public:
+	/**
+	 * @brief Proxy reference to a single value of a FloatArray.
+	 */
+	struct Reference
+	{
+	public:
+		/**
+		 * @brief Construct a new reference to a single value.
+		 *
+		 * @param data Pointer to the value if it is stored in single precision, otherwise nullptr.
+		 * @param compactData Pointer to the encoded value if it is stored in a 16 bit storage format, otherwise nullptr.
+		 * @param format Storage format.
+		 */
+		Reference(float *data, uint16_t *compactData, const FloatFormat format) : _data(data), _compactData(compactData), _format(format) {}
+
+		/**
+		 * @brief Read the referenced value.
+		 *
+		 * @return float Value.
+		 */
+		operator float() const
+		{
+			return (_compactData == nullptr) ? *_data : FloatCodec::decode(*_compactData, _format);
+		}
+
+		/**
+		 * @brief Write the referenced value, which is rounded to the storage format.
+		 *
+		 * @param value Value to write.
+		 * @return Reference& Reference to the written value.
+		 */
+		Reference &operator=(const float value)
+		{
+			if (_compactData == nullptr) *_data = value;
+			else *_compactData = FloatCodec::encode(value, _format);
+			return *this;
+		}
+
+		/**
+		 * @brief Copy a value from another reference.
+		 *
+		 * @param rhs Reference to the source value.
+		 * @return Reference& Reference to the written value.
+		 */
+		Reference &operator=(const Reference &rhs)
+		{
+			return *this = float(rhs);
+		}
+
+		/**
+		 * @brief Add to the referenced value.
+		 *
+		 * @param value Value to add.
+		 * @return Reference& Reference to the written value.
+		 */
+		Reference &operator+=(const float value)
+		{
+			return *this = float(*this) + value;
+		}
+
+	private:
+		float *_data; ///< Pointer to the value if it is stored in single precision, otherwise nullptr.
+		uint16_t *_compactData; ///< Pointer to the encoded value if it is stored in a 16 bit storage format, otherwise nullptr.
+		FloatFormat _format; ///< Storage format.
+	};
+
+	/**
+	 * @brief Construct an empty array.
+	 */
+	FloatArray() : _data(nullptr), _compactData(nullptr), _size(0), _format(FloatFormat::Float32) {}
+
+	/**
+	 * @brief Construct a view of single precision data.
+	 *
+	 * @param data Pointer to the first value.
+	 * @param size Number of values.
+	 */
+	FloatArray(float *data, const int64_t size) : _data(data), _compactData(nullptr), _size(size), _format(FloatFormat::Float32) {}
+
+	/**
+	 * @brief Construct a view of data in a 16 bit storage format.
+	 *
+	 * @param data Pointer to the first encoded value.
+	 * @param size Number of values.
+	 * @param format Storage format, must be either FloatFormat::Float16 or FloatFormat::BFloat16.
+	 */
+	FloatArray(uint16_t *data, const int64_t size, const FloatFormat format) : _data(nullptr), _compactData(data), _size(size), _format(format)
+	{
+		ASSERT(format != FloatFormat::Float32);
+	}
+
+	/**
+	 * @brief Allocate memory for a zero-initialized array in the specified storage format. The memory must be released by release().
+	 *
+	 * @param size Number of values.
+	 * @param format Storage format.
+	 * @return FloatArray View of the allocated array.
+	 */
+	static FloatArray allocate(const int64_t size, const FloatFormat format)
+	{
+		if (format == FloatFormat::Float32)
+		{
+			float *data = new float[size];
+			memset(data, 0, sizeof(float) * size);
+			return FloatArray(data, size);
+		}
+		else
+		{
+			//zero is encoded as zero in all 16 bit formats
+			uint16_t *data = new uint16_t[size];
+			memset(data, 0, sizeof(uint16_t) * size);
+			return FloatArray(data, size, format);
+		}
+	}
+
+	/**
+	 * @brief Release the memory of an array which has been allocated by allocate(). The view is reset to an empty array.
+	 */
+	void release()
+	{
+		delete[] _data;
+		delete[] _compactData;
+		*this = FloatArray();
+	}
+
+	/**
+	 * @brief Retrieve the number of values.
+	 *
+	 * @return int64_t Number of values.
+	 */
+	int64_t size() const
+	{
+		return _size;
+	}
+
+	/**
+	 * @brief Retrieve the storage format.
+	 *
+	 * @return FloatFormat Storage format.
+	 */
+	FloatFormat format() const
+	{
+		return _format;
+	}
+
+	/**
+	 * @brief Check whether the values are stored in a 16 bit storage format.
+	 *
+	 * @return bool True if the values are stored in a 16 bit storage format.
+	 */
+	bool isCompact() const
+	{
+		return _compactData != nullptr;
+	}
+
+	/**
+	 * @brief Retrieve the single precision data.
+	 *
+	 * @return float* Pointer to the first value, or nullptr if the values are stored in a 16 bit storage format.
+	 */
+	float *data() const
+	{
+		return _data;
+	}
+
+	/**
+	 * @brief Retrieve the encoded data.
+	 *
+	 * @return uint16_t* Pointer to the first encoded value, or nullptr if the values are stored in single precision.
+	 */
+	uint16_t *compactData() const
+	{
+		return _compactData;
+	}
+
+	/**
+	 * @brief Retrieve the number of bytes occupied by the values.
+	 *
+	 * @return int64_t Number of bytes.
+	 */
+	int64_t bytes() const
+	{
+		return _size * ((isCompact()) ? sizeof(uint16_t) : sizeof(float));
+	}
+
+	/**
+	 * @brief Construct a view of a contiguous range of values.
+	 *
+	 * @param offset Index of the first value.
+	 * @param count Number of values.
+	 * @return FloatArray View of the range.
+	 */
+	FloatArray subarray(const int64_t offset, const int64_t count) const
+	{
+		ASSERT(offset >= 0 && count >= 0 && offset + count <= _size);
+
+		if (isCompact()) return FloatArray(_compactData + offset, count, _format);
+		else return FloatArray(_data + offset, count);
+	}
+
+	/**
+	 * @brief Read a value.
+	 *
+	 * @param i Index of the value.
+	 * @return float Value.
+	 */
+	float get(const int64_t i) const
+	{
+		ASSERT(i >= 0 && i < _size);
+		return (_compactData == nullptr) ? _data[i] : FloatCodec::decode(_compactData[i], _format);
+	}
+
+	/**
+	 * @brief Write a value, which is rounded to the storage format.
+	 *
+	 * @param i Index of the value.
+	 * @param value Value to write.
+	 */
+	void set(const int64_t i, const float value) const
+	{
+		ASSERT(i >= 0 && i < _size);
+		if (_compactData == nullptr) _data[i] = value;
+		else _compactData[i] = FloatCodec::encode(value, _format);
+	}
+
+	/**
+	 * @brief Access a value.
+	 *
+	 * @param i Index of the value.
+	 * @return Reference Proxy reference to the value.
+	 */
+	Reference operator[](const int64_t i) const
+	{
+		ASSERT(i >= 0 && i < _size);
+		if (_compactData == nullptr) return Reference(_data + i, nullptr, _format);
+		else return Reference(nullptr, _compactData + i, _format);
+	}
+
+	/**
+	 * @brief Read a contiguous range of values.
+	 *
+	 * @param[in] offset Index of the first value.
+	 * @param[in] count Number of values.
+	 * @param[out] buffer Values. Must hold at least count elements.
+	 */
+	void read(const int64_t offset, const int64_t count, float *buffer) const
+	{
+		ASSERT(offset >= 0 && count >= 0 && offset + count <= _size);
+
+		if (_compactData == nullptr) memcpy(buffer, _data + offset, sizeof(float) * count);
+		else for (int64_t i = 0; i < count; ++i) buffer[i] = FloatCodec::decode(_compactData[offset + i], _format);
+	}
+
+	/**
+	 * @brief Write a contiguous range of values, which are rounded to the storage format.
+	 *
+	 * @param offset Index of the first value.
+	 * @param count Number of values.
+	 * @param buffer Values.
+	 */
+	void write(const int64_t offset, const int64_t count, const float *buffer) const
+	{
+		ASSERT(offset >= 0 && count >= 0 && offset + count <= _size);
+
+		if (_compactData == nullptr) memcpy(_data + offset, buffer, sizeof(float) * count);
+		else for (int64_t i = 0; i < count; ++i) _compactData[offset + i] = FloatCodec::encode(buffer[i], _format);
+	}
+
+	/**
+	 * @brief Retrieve a contiguous range of values in single precision.
+	 * @details If the values are stored in single precision, a pointer into the array is returned. Otherwise, the values are decoded into the buffer.
+	 *
+	 * @param offset Index of the first value.
+	 * @param count Number of values.
+	 * @param buffer Buffer for decoded values. Must hold at least count elements.
+	 * @return const float* Pointer to the values.
+	 */
+	const float *line(const int64_t offset, const int64_t count, float *buffer) const
+	{
+		if (_compactData == nullptr) return _data + offset;
+		read(offset, count, buffer);
+		return buffer;
+	}
+
+private:
+	float *_data; ///< Single precision data, or nullptr if the values are stored in a 16 bit storage format.
+	uint16_t *_compactData; ///< Encoded data, or nullptr if the values are stored in single precision.
+	int64_t _size; ///< Number of values.
+	FloatFormat _format; ///< Storage format.
+};
@@ -0,0 +1,197 @@
+/**
+ * @file FloatFormat.hpp
+ * @author Finn Lasse Buessen
+ * @brief Conversion of single precision floating point data to reduced precision storage formats.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include "lib/Exception.hpp"
+
+/**
+ * @brief Floating point storage formats.
+ */
+enum struct FloatFormat
+{
+	Float32, ///< IEEE 754 single precision (8 exponent bits, 23 mantissa bits).
+	Float16, ///< IEEE 754 half precision (5 exponent bits, 10 mantissa bits).
+	BFloat16 ///< Brain floating point format (8 exponent bits, 7 mantissa bits), which covers the full single precision range.
+};
+
+/**
+ * @brief Conversion between single precision values and 16 bit storage formats.
+ * @details All conversions round to the nearest representable value, with ties rounded to even.
+ * Values which exceed the range of the half precision format are converted to infinity. NaN values remain NaN.
+ */
+struct FloatCodec
+{
+public:
+	/**
+	 * @brief Parse the name of a storage format.
+	 *
+	 * @param name Format name, either "fp32", "fp16" or "bf16".
+	 * @return FloatFormat Storage format.
+	 */
+	static FloatFormat parse(const std::string &name)
+	{
+		if (name == "fp32") return FloatFormat::Float32;
+		else if (name == "fp16") return FloatFormat::Float16;
+		else if (name == "bf16") return FloatFormat::BFloat16;
+		else throw Exception(Exception::Type::ArgumentError, "Unknown floating point format '" + name + "'");
+	}
+
+	/**
+	 * @brief Retrieve the name of a storage format.
+	 *
+	 * @param format Storage format.
+	 * @return std::string Format name.
+	 */
+	static std::string name(const FloatFormat format)
+	{
+		if (format == FloatFormat::Float16) return "fp16";
+		else if (format == FloatFormat::BFloat16) return "bf16";
+		else return "fp32";
+	}
+
+	/**
+	 * @brief Encode a single precision value in a 16 bit storage format.
+	 *
+	 * @param value Value to encode.
+	 * @param format Storage format, must be either FloatFormat::Float16 or FloatFormat::BFloat16.
+	 * @return uint16_t Encoded value.
+	 */
+	static uint16_t encode(const float value, const FloatFormat format)
+	{
+		uint32_t x;
+		memcpy(&x, &value, sizeof(float));
+
+		if (format == FloatFormat::BFloat16)
+		{
+			//quiet NaN
+			if ((x & 0x7fffffffu) > 0x7f800000u) return uint16_t((x >> 16) | 0x0040u);
+			x += 0x7fffu + ((x >> 16) & 1u);
+			return uint16_t(x >> 16);
+		}
+
+		uint32_t sign = (x >> 16) & 0x8000u;
+		uint32_t magnitude = x & 0x7fffffffu;
+
+		//infinity and NaN
+		if (magnitude >= 0x7f800000u) return uint16_t(sign | 0x7c00u | ((magnitude > 0x7f800000u) ? 0x0200u : 0u));
+		//overflow
+		if (magnitude >= 0x477ff000u) return uint16_t(sign | 0x7c00u);
+		//subnormal values and underflow
+		if (magnitude < 0x38800000u)
+		{
+			if (magnitude < 0x33000000u) return uint16_t(sign);
+			uint32_t mantissa = (magnitude & 0x007fffffu) | 0x00800000u;
+			int shift = 126 - int(magnitude >> 23);
+			uint32_t result = mantissa >> shift;
+			uint32_t remainder = mantissa & ((1u << shift) - 1u);
+			uint32_t halfway = 1u << (shift - 1);
+			if (remainder > halfway || (remainder == halfway && (result & 1u))) ++result;
+			return uint16_t(sign | result);
+		}
+		//normal values; a carry from the mantissa correctly increments the exponent
+		uint32_t result = (magnitude - 0x38000000u) >> 13;
+		uint32_t remainder = magnitude & 0x1fffu;
+		if (remainder > 0x1000u || (remainder == 0x1000u && (result & 1u))) ++result;
+		return uint16_t(sign | result);
+	}
+
+	/**
+	 * @brief Decode a value from a 16 bit storage format.
+	 *
+	 * @param value Encoded value.
+	 * @param format Storage format, must be either FloatFormat::Float16 or FloatFormat::BFloat16.
+	 * @return float Decoded value.
+	 */
+	static float decode(const uint16_t value, const FloatFormat format)
+	{
+		uint32_t x;
+		if (format == FloatFormat::BFloat16) x = uint32_t(value) << 16;
+		else
+		{
+			uint32_t sign = uint32_t(value & 0x8000u) << 16;
+			uint32_t exponent = (value >> 10) & 0x1fu;
+			uint32_t mantissa = value & 0x03ffu;
+			if (exponent == 0x1fu) x = sign | 0x7f800000u | (mantissa << 13);
+			else if (exponent == 0)
+			{
+				float result = std::ldexp(float(mantissa), -24);
+				return (sign != 0) ? -result : result;
+			}
+			else x = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+		}
+
+		float result;
+		memcpy(&result, &x, sizeof(float));
+		return result;
+	}
+
+	/**
+	 * @brief Round a single precision value to the nearest value which is representable in the specified storage format.
+	 *
+	 * @param value Value to round.
+	 * @param format Storage format.
+	 * @return float Rounded value.
+	 */
+	static float round(const float value, const FloatFormat format)
+	{
+		if (format == FloatFormat::Float32) return value;
+		return decode(encode(value, format), format);
+	}
+
+	/**
+	 * @brief Encode an array of single precision values in a 16 bit storage format.
+	 *
+	 * @param[in] data Values to encode.
+	 * @param[out] buffer Encoded values. Must hold at least size elements.
+	 * @param[in] size Number of values.
+	 * @param[in] format Storage format, must be either FloatFormat::Float16 or FloatFormat::BFloat16.
+	 */
+	static void encode(const float *data, uint16_t *buffer, const int size, const FloatFormat format)
+	{
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (int i = 0; i < size; ++i) buffer[i] = encode(data[i], format);
+	}
+
+	/**
+	 * @brief Decode an array of values from a 16 bit storage format.
+	 *
+	 * @param[in] buffer Encoded values.
+	 * @param[out] data Decoded values. Must hold at least size elements.
+	 * @param[in] size Number of values.
+	 * @param[in] format Storage format, must be either FloatFormat::Float16 or FloatFormat::BFloat16.
+	 */
+	static void decode(const uint16_t *buffer, float *data, const int size, const FloatFormat format)
+	{
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (int i = 0; i < size; ++i) data[i] = decode(buffer[i], format);
+	}
+
+	/**
+	 * @brief Round an array of single precision values in place to the specified storage format.
+	 *
+	 * @param data Values to round.
+	 * @param size Number of values.
+	 * @param format Storage format.
+	 */
+	static void round(float *data, const int size, const FloatFormat format)
+	{
+		if (format == FloatFormat::Float32) return;
+		#ifndef DISABLE_OMP
+		#pragma omp parallel for schedule(static)
+		#endif
+		for (int i = 0; i < size; ++i) data[i] = round(data[i], format);
+	}
+};
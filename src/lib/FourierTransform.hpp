@@ -0,0 +1,250 @@
+/**
+ * @file FourierTransform.hpp
+ * @author Finn Lasse Buessen
+ * @brief Discrete Fourier transform of complex data on a periodic three-dimensional grid.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <complex>
+#include <utility>
+#include "lib/Assert.hpp"
+
+/**
+ * @brief Discrete Fourier transform on a periodic grid with L0 x L1 x L2 points, where each extent is a power of two.
+ * @details The transform is evaluated by an iterative radix-2 algorithm along each dimension, which costs O(N log N) operations for N grid points.
+ * Grid point (x0,x1,x2) is stored at the linear index (x0 * L1 + x1) * L2 + x2. Lines along the outer dimensions are transformed in batches, such that
+ * the innermost loop runs over contiguous memory.
+ *
+ * Transforms can be pruned to a box of grid points |x_d| <= extent_d (measured periodically): The forward transform assumes that the data vanishes outside
+ * of the box, and the backward transform only guarantees correct results within the box. Both transforms then skip all lines which do not intersect the box
+ * along the dimensions which have not been transformed yet. Twiddle factors are computed once upon construction, such that a single FourierTransform object
+ * can be shared by all threads.
+ */
+class FourierTransform
+{
+public:
+	/**
+	 * @brief Construct a FourierTransform object for a grid with a single point.
+	 */
+	FourierTransform() : _dimensions({ { 1, 1, 1 } }), _size(1) {}
+
+	/**
+	 * @brief Construct a new FourierTransform object.
+	 *
+	 * @param dimensions Extent of the grid in each dimension. Must be powers of two.
+	 */
+	FourierTransform(const std::array<int, 3> &dimensions) : _dimensions(dimensions), _size(dimensions[0] * dimensions[1] * dimensions[2])
+	{
+		const double pi = 3.14159265358979323846;
+		for (int d = 0; d < 3; ++d)
+		{
+			ASSERT(dimensions[d] > 0 && (dimensions[d] & (dimensions[d] - 1)) == 0);
+
+			_twiddles[d].resize(dimensions[d] / 2);
+			for (int k = 0; k < dimensions[d] / 2; ++k) _twiddles[d][k] = std::polar(1.0, -2.0 * pi * double(k) / double(dimensions[d]));
+		}
+	}
+
+	/**
+	 * @brief Determine the smallest power of two which is not smaller than the specified size.
+	 *
+	 * @param minimalSize Minimal size.
+	 * @return int Power of two.
+	 */
+	static int paddedSize(const int minimalSize)
+	{
+		int size = 1;
+		while (size < minimalSize) size *= 2;
+		return size;
+	}
+
+	/**
+	 * @brief Retrieve the extent of the grid in each dimension.
+	 *
+	 * @return const std::array<int, 3>& Extents.
+	 */
+	const std::array<int, 3> &dimensions() const
+	{
+		return _dimensions;
+	}
+
+	/**
+	 * @brief Retrieve the total number of grid points.
+	 *
+	 * @return int Number of grid points.
+	 */
+	int size() const
+	{
+		return _size;
+	}
+
+	/**
+	 * @brief Compute the forward transform X(k) = sum_x x(x) exp(-2 pi i k x / L) in place.
+	 *
+	 * @param data Array of FourierTransform::size() values.
+	 */
+	void forward(std::complex<double> *data) const
+	{
+		_transform(data, _dimensions, false);
+	}
+
+	/**
+	 * @brief Compute the forward transform of data which vanishes outside of the box |x_d| <= extent_d in place.
+	 *
+	 * @param data Array of FourierTransform::size() values.
+	 * @param extent Extent of the box in each dimension.
+	 */
+	void forward(std::complex<double> *data, const std::array<int, 3> &extent) const
+	{
+		_transform(data, extent, false);
+	}
+
+	/**
+	 * @brief Compute the normalized backward transform x(x) = 1/N sum_k X(k) exp(2 pi i k x / L) in place, which inverts FourierTransform::forward().
+	 *
+	 * @param data Array of FourierTransform::size() values.
+	 */
+	void backward(std::complex<double> *data) const
+	{
+		backward(data, _dimensions);
+	}
+
+	/**
+	 * @brief Compute the normalized backward transform in place, where only the results within the box |x_d| <= extent_d are correct.
+	 * The results outside of the box are left unnormalized.
+	 *
+	 * @param data Array of FourierTransform::size() values.
+	 * @param extent Extent of the box in each dimension.
+	 */
+	void backward(std::complex<double> *data, const std::array<int, 3> &extent) const
+	{
+		_transform(data, extent, true);
+		const double normalization = 1.0 / double(_size);
+		for (int i = 0; i < _size; ++i) data[i] *= normalization;
+	}
+
+	/**
+	 * @brief Count the butterfly operations of a forward or backward transform which is pruned to the box |x_d| <= extent_d.
+	 *
+	 * @param extent Extent of the box in each dimension.
+	 * @return double Number of butterfly operations.
+	 */
+	double butterflies(const std::array<int, 3> &extent) const
+	{
+		double count = 0.0;
+		int outer = 1;
+		int activeOuter = 1;
+		for (int d = 0; d < 3; ++d)
+		{
+			const int length = _dimensions[d];
+			int log2Length = 0;
+			while ((1 << log2Length) < length) ++log2Length;
+			count += double(activeOuter) * double(_size / (outer * length)) * double(length / 2) * double(log2Length);
+
+			int activeLength = 0;
+			for (int x = 0; x < length; ++x) activeLength += _isInside(x, length, extent[d]);
+			outer *= length;
+			activeOuter *= activeLength;
+		}
+		return count;
+	}
+
+private:
+	/**
+	 * @brief Check whether a grid coordinate lies within the box |x| <= extent, measured periodically.
+	 *
+	 * @param x Grid coordinate.
+	 * @param length Extent of the grid.
+	 * @param extent Extent of the box.
+	 * @return bool True if the coordinate lies within the box.
+	 */
+	static bool _isInside(const int x, const int length, const int extent)
+	{
+		return x <= extent || x >= length - extent;
+	}
+
+	/**
+	 * @brief Transform all lines of the grid along each dimension, skipping lines outside of the box along the dimensions which have not been transformed yet.
+	 * @details The forward transform proceeds from the innermost to the outermost dimension, and the backward transform in reverse order.
+	 *
+	 * @param data Array of FourierTransform::size() values.
+	 * @param extent Extent of the box in each dimension.
+	 * @param inverse Use the conjugate twiddle factors if true.
+	 */
+	void _transform(std::complex<double> *data, const std::array<int, 3> &extent, const bool inverse) const
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			const int d = inverse ? i : 2 - i;
+			const int length = _dimensions[d];
+			if (length == 1) continue;
+
+			const int inner = (d == 2) ? 1 : ((d == 1) ? _dimensions[2] : _dimensions[1] * _dimensions[2]);
+			const int outer = _size / (length * inner);
+			for (int o = 0; o < outer; ++o)
+			{
+				//lines are required if the data does not vanish (forward) or the result is requested (backward) at the coordinates of all outer dimensions
+				if (d == 2 && !(_isInside(o / _dimensions[1], _dimensions[0], extent[0]) && _isInside(o % _dimensions[1], _dimensions[1], extent[1]))) continue;
+				if (d == 1 && !_isInside(o, _dimensions[0], extent[0])) continue;
+				_transformLines(data + o * length * inner, length, inner, _twiddles[d], inverse);
+			}
+		}
+	}
+
+	/**
+	 * @brief Iterative radix-2 transform of a batch of interleaved lines. Element x of line t is stored at index x * count + t.
+	 *
+	 * @param data Pointer to the first element of the first line.
+	 * @param length Number of elements of each line.
+	 * @param count Number of lines.
+	 * @param twiddles Twiddle factors exp(-2 pi i k / length) for k < length / 2.
+	 * @param inverse Use the conjugate twiddle factors if true.
+	 */
+	static void _transformLines(std::complex<double> *data, const int length, const int count, const std::vector<std::complex<double>> &twiddles, const bool inverse)
+	{
+		//bit reversal permutation
+		for (int i = 1, j = 0; i < length; ++i)
+		{
+			int bit = length >> 1;
+			for (; j & bit; bit >>= 1) j ^= bit;
+			j ^= bit;
+			if (i < j) std::swap_ranges(data + i * count, data + (i + 1) * count, data + j * count);
+		}
+
+		//butterflies; complex products are expanded explicitly, which avoids the special value handling of std::complex
+		double *values = reinterpret_cast<double *>(data);
+		for (int width = 2; width <= length; width *= 2)
+		{
+			const int half = width / 2;
+			const int step = length / width;
+			for (int i = 0; i < length; i += width)
+			{
+				for (int k = 0; k < half; ++k)
+				{
+					const double wr = twiddles[k * step].real();
+					const double wi = inverse ? -twiddles[k * step].imag() : twiddles[k * step].imag();
+					double *x1 = values + 2 * (i + k) * count;
+					double *x2 = values + 2 * (i + k + half) * count;
+					for (int t = 0; t < count; ++t)
+					{
+						const double vr = x2[2 * t] * wr - x2[2 * t + 1] * wi;
+						const double vi = x2[2 * t] * wi + x2[2 * t + 1] * wr;
+						x2[2 * t] = x1[2 * t] - vr;
+						x2[2 * t + 1] = x1[2 * t + 1] - vi;
+						x1[2 * t] += vr;
+						x1[2 * t + 1] += vi;
+					}
+				}
+			}
+		}
+	}
+
+	std::array<int, 3> _dimensions; ///< Extent of the grid in each dimension.
+	int _size; ///< Total number of grid points.
+	std::vector<std::complex<double>> _twiddles[3]; ///< Twiddle factors of each dimension.
+};
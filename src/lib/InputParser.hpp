@@ -11,6 +11,7 @@
 #include <sstream>
 #include "boost/regex.hpp"
 #include "lib/Log.hpp"
+#include "lib/Exception.hpp"
 
 namespace InputParser
 {
@@ -66,4 +67,28 @@ namespace InputParser
 	{
 		return float(stringToDouble(input));
 	}
+
+	/**
+	 * @brief ַΪ.ַһ int Χڵʮ. 
+	 * 
+	 * @param input ַ. 
+	 * @return int ֵ. 
+	 * @throws Exception ַ򳬳 int ķΧ,׳ Exception::Type::InitializationError. 
+	 */
+	inline int stringToInt(const std::string &input)
+	{
+		//ܾǴֻ򳬳 int Χֵ
+		int result = 0;
+		size_t length = 0;
+		try
+		{
+			result = std::stoi(input, &length);
+		}
+		catch (const std::exception &)
+		{
+			length = 0;
+		}
+		if (length == 0 || length != input.size()) throw Exception(Exception::Type::InitializationError, "Cannot parse '" + input + "' as an integer.");
+		return result;
+	}
 }
\ No newline at end of file
@@ -128,14 +128,15 @@ namespace ImplicitIntegrator
 	 * First argument of the integrand function is the frequency value, the second argument is the return value of the integrand, passed by reference. 
 	 * 
 	 * @tparam T Integrand type. 
+	 * @tparam Integrand Callable type void(float, T &). Lambdas should be passed directly rather than wrapped in a std::function, such that they can be inlined into the quadrature loop. 
 	 * @param[in] min Lower boundary frequency value. 
 	 * @param[in] max Iterator to upper boundary frequency value. 
 	 * @param[in] integrand Integrand function. 
 	 * @param[out] integrandBuffer Return value buffer of the integrand. 
 	 * @param[out] resultBuffer Value of the integral. 
 	 */
-	template <class T>
-	void integrateWithObscureLeftBoundary(const float min, const FrequencyIterator max, const std::function<void(float, T &)> &integrand, T &integrandBuffer, T &resultBuffer)
+	template <class T, class Integrand>
+	void integrateWithObscureLeftBoundary(const float min, const FrequencyIterator max, const Integrand &integrand, T &integrandBuffer, T &resultBuffer)
 	{
 		ASSERT(&integrandBuffer != &resultBuffer);
 		ASSERT(min <= *max, "Lower integration boundary must not be larger than upper boundary. ");
@@ -178,14 +179,15 @@ namespace ImplicitIntegrator
 	 * First argument of the integrand function is the frequency value, the second argument is the return value of the integrand, passed by reference. 
 	 * 
 	 * @tparam T Integrand type. 
+	 * @tparam Integrand Callable type void(float, T &). Lambdas should be passed directly rather than wrapped in a std::function, such that they can be inlined into the quadrature loop. 
 	 * @param[in] min Iterator to lower boundary frequency value. 
 	 * @param[in] max Upper boundary frequency value. 
 	 * @param[in] integrand Integrand function. 
 	 * @param[out] integrandBuffer Return value buffer of the integrand. 
 	 * @param[out] resultBuffer Value of the integral. 
 	 */
-	template <class T>
-	void integrateWithObscureRightBoundary(const FrequencyIterator min, const float max, const std::function<void(float, T &)> &integrand, T &integrandBuffer, T &resultBuffer)
+	template <class T, class Integrand>
+	void integrateWithObscureRightBoundary(const FrequencyIterator min, const float max, const Integrand &integrand, T &integrandBuffer, T &resultBuffer)
 	{
 		ASSERT(&integrandBuffer != &resultBuffer);
 		ASSERT(*min <= max, "Lower integration boundary must not be larger than upper boundary. ");
@@ -229,14 +231,15 @@ namespace ImplicitIntegrator
 	 * First argument of the integrand function is the frequency value, the second argument is the return value of the integrand, passed by reference. 
 	 * 
 	 * @tparam T Integrand type. 
+	 * @tparam Integrand Callable type void(float, T &). Lambdas should be passed directly rather than wrapped in a std::function, such that they can be inlined into the quadrature loop. 
 	 * @param[in] min Lower boundary frequency value. 
 	 * @param[in] max Upper boundary frequency value. 
 	 * @param[in] integrand Integrand function. 
 	 * @param[out] integrandBuffer Return value buffer of the integrand. 
 	 * @param[out] resultBuffer Value of the integral. 
 	 */
-	template <class T>
-	void integrateWithObscureBoundaries(const float min, const float max, const std::function<void(float, T &)> &integrand, T &integrandBuffer, T &resultBuffer)
+	template <class T, class Integrand>
+	void integrateWithObscureBoundaries(const float min, const float max, const Integrand &integrand, T &integrandBuffer, T &resultBuffer)
 	{
 		ASSERT(&integrandBuffer != &resultBuffer);
 		ASSERT(min <= max, "Lower integration boundary must not be larger than upper boundary. ");
@@ -285,4 +288,37 @@ namespace ImplicitIntegrator
 			resultBuffer *= 0.5f * (max - min);
 		}
 	}
+
+	/**
+	 * @brief Integrate over all frequencies wp outside of the cutoff windows, i.e. |wp| > cutoff and |wp + shift| > cutoff, and add the result to the accumulator. 
+	 * The integral is split into up to three ranges at the window boundaries, as required by the transfer frequency channels of the flow equations. 
+	 * 
+	 * @tparam T Integrand type. 
+	 * @tparam Integrand Callable type void(float, T &). 
+	 * @param[in] shift Transfer frequency by which the second cutoff window is shifted. 
+	 * @param[in] cutoff Frequency cutoff. 
+	 * @param[in] integrand Integrand function. 
+	 * @param[out] integrandBuffer Return value buffer of the integrand. 
+	 * @param[out] rangeBuffer Buffer for the value of the integral over a single range. 
+	 * @param[in,out] accumulator Buffer to which the value of the integral is added. 
+	 */
+	template <class T, class Integrand>
+	void integrateOutsideCutoff(const float shift, const float cutoff, const Integrand &integrand, T &integrandBuffer, T &rangeBuffer, T &accumulator)
+	{
+		if (-(shift + cutoff) > *FrgCommon::frequency().beginNegative())
+		{
+			integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(shift + cutoff), integrand, integrandBuffer, rangeBuffer);
+			accumulator += rangeBuffer;
+		}
+		if (shift - cutoff > cutoff)
+		{
+			integrateWithObscureBoundaries(cutoff - shift, -cutoff, integrand, integrandBuffer, rangeBuffer);
+			accumulator += rangeBuffer;
+		}
+		if (cutoff < *FrgCommon::frequency().last())
+		{
+			integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integrand, integrandBuffer, rangeBuffer);
+			accumulator += rangeBuffer;
+		}
+	}
 }
\ No newline at end of file
@@ -8,12 +8,21 @@
 
 #pragma once
 #include <vector>
+#include <deque>
 #include <functional>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <climits>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
 #include <boost/date_time.hpp>
 #include "lib/Log.hpp"
 #include "lib/Exception.hpp"
+#include "lib/FloatFormat.hpp"
 
 #ifndef DISABLE_MPI
 #include "mpi.h"
@@ -26,6 +35,22 @@
 #define HMP_CHUNK_PROPERTY_BEGIN 1 ///< Memory offset of the workload begin in the chunk properties. 
 #define HMP_CHUNK_PROPERTY_END 2 ///< Memory offset of the workload end in the chunk properties. 
 
+#ifndef HMP_MAX_MESSAGE_SIZE
+#define HMP_MAX_MESSAGE_SIZE INT_MAX ///< Maximum size of a single MPI message in bytes. Larger transfers are split into multiple messages. 
+#endif
+
+#ifndef HMP_TRANSFER_BUFFER_SIZE
+#define HMP_TRANSFER_BUFFER_SIZE 4194304 ///< Maximum size in bytes of the buffer in which reduced precision broadcasts are encoded. Larger transfers are encoded and sent block by block. 
+#endif
+
+#ifndef HMP_MAX_POLL_INTERVAL
+#define HMP_MAX_POLL_INTERVAL 200 ///< Maximum interval in microseconds between two tests for completed chunk results on the server rank. 
+#endif
+
+#ifndef HMP_CHUNKS_IN_FLIGHT
+#define HMP_CHUNKS_IN_FLIGHT 2 ///< Maximum number of workload chunks which are issued to a single rank, but whose results have not been returned yet. 
+#endif
+
 #ifndef DISABLE_MPI
 #define HMP_MPI_ENABLED ///< Defined, if MPI parallelization is enabled. 
 #define HMP_ENABLE_IF_MPI(X) X ///< Print argument if MPI parallelization is enabled. 
@@ -41,6 +66,7 @@ namespace HMP
 {
 	class LoadManager;
 	typedef int StackIdentifier; ///< DataStack identifier. 
+	typedef int64_t StackIndex; ///< Index of an element (or element tuple) in a DataStack. 
 
 	/**
 	 * @brief Common load manager interface for both, the MPI server rank and slave ranks. 
@@ -129,18 +155,25 @@ namespace HMP
 			 * 
 			 * @param n Specifies the index to which the calculator should be applied. 
 			 */
-			virtual void applyCalculator(const int n) {};
+			virtual void applyCalculator(const StackIndex n) {};
+
+			/**
+			 * @brief Virtual function to round the stack's data to the precision of its transfer format. 
+			 * @see DataStackBase::format
+			 */
+			virtual void roundToFormat() {};
 
 			#ifdef HMP_MPI_ENABLED
 			/**
-			 * @brief Virtual function to send a data block to a DataStack on a different MPI rank, typically the server rank. 
+			 * @brief Virtual function to asynchronously send a data block to a DataStack on a different MPI rank, typically the server rank. 
 			 * 
-			 * @param offset Offset to the beginning of the data block to be sent, measured in number of entries (or number of entry tuples, if DataStackBase::typeMultiplicity is greater than one).
-			 * @param count Number of entries to be sent. 
-			 * @param serverRank Receiver's MPI rank, typically the server rank. 
-			 * @param communicator The MPI communicator used for communication. 
+			 * @param[in] offset Offset to the beginning of the data block to be sent, measured in number of entries (or number of entry tuples, if DataStackBase::typeMultiplicity is greater than one).
+			 * @param[in] count Number of entries to be sent. 
+			 * @param[in] serverRank Receiver's MPI rank, typically the server rank. 
+			 * @param[in] communicator The MPI communicator used for communication. 
+			 * @param[out] requests MPI request objects for the communication are appended to this list; The data block must not be modified before the requests have completed. 
 			 */
-			virtual void send(const int offset, const int count, const int serverRank, const MPI_Comm communicator) const {};
+			virtual void send(const StackIndex offset, const StackIndex count, const int serverRank, const MPI_Comm communicator, std::vector<MPI_Request> &requests) const {};
 
 			/**
 			 * @brief Virtual function to asynchronously receive a data block from a different MPI rank. 
@@ -149,9 +182,9 @@ namespace HMP
 			 * @param[in] count Number of entries to be received. 
 			 * @param[in] rank Sender's MPI rank. 
 			 * @param[in] communicator The MPI communicator used for communication. 
-			 * @param[out] request MPI request object for the communication; Should be used to determine whether the non-blocking receive has been completed. 
+			 * @param[out] requests MPI request objects for the communication are appended to this list; Should be used to determine whether the non-blocking receive has been completed. 
 			 */
-			virtual void receive(const int offset, const int count, const int rank, const MPI_Comm communicator, MPI_Request &request) {};
+			virtual void receive(const StackIndex offset, const StackIndex count, const int rank, const MPI_Comm communicator, std::vector<MPI_Request> &requests) {};
 
 			/**
 			 * @brief Virtual function to broadcast a data block from the server rank to all other MPI ranks. 
@@ -164,11 +197,16 @@ namespace HMP
 
 			StackType type; ///< Specifies the trait of the stack @see StackType.
 			StackIdentifier master; ///< Specifies the id of an associated stack. Only relevant for slave stacks, otherwise set to -1. @see StackType::Slave
-			int size; ///< Number of elements (or tuples of elements if DataStackBase::typeMultiplicity is greater than one) stored in the stack. 
+			StackIndex size; ///< Number of elements (or tuples of elements if DataStackBase::typeMultiplicity is greater than one) stored in the stack. 
 			int typeMultiplicity; ///< Multiplicity of each element. Cannot be greater than one for explicit stacks. If greater than one, the data stack is assumed to consist of tuples of fundamental data types. Element indexing then refers to the tuples, not the fundamental data types. 
 			int recommendedChunkSizeMultiple; ///< When breaking the data stack down into smaller work chunks, attempt to form chunks whose size is a multiple of the given value. This is helpful if calculators vary in runtime, but can be joined to groups whose collective runtime is expected to be constant. 
 			int recommendedChunksPerRank; ///< When breaking the data stack down into smaller work chunks, attempt to form approximately the specified number of chunks per MPI rank. 
 			bool autoBroadcast; ///< If set to true, modifications to the stack's data that are a consequence of the onvication of calculators are automatically communicated across all MPI ranks. If set to false, they are only sent to the MPI server rank. 
+			FloatFormat format; ///< Format in which the stack's data is broadcasted. Only relevant for passive stacks of single precision data. If a 16 bit format is specified, the data is also rounded to that precision on the server rank, such that all MPI ranks hold identical values. 
+			bool nodeShared; ///< If set to true, the stack's data resides in memory which is shared by all MPI ranks on the same node. Broadcasts are then only sent to one rank per node. Only relevant for passive stacks. 
+			std::function<float(StackIndex)> costEstimator; ///< Optional estimate of the relative runtime of the calculator for each element. Only relevant on the server rank. @see LoadManager::setCostEstimator
+			bool learnCost; ///< If set to true, the relative runtime of the calculator for each element is learned from the chunk timings of the previous calculation. Only relevant on the server rank. @see LoadManager::enableCostLearning
+			bool affinity; ///< If set to true, each rank preferentially computes the same range of elements as in the previous calculation. Only relevant on the server rank. @see LoadManager::enableAffinity
 		};
 
 		/**
@@ -188,31 +226,50 @@ namespace HMP
 			 * @see LoadManager::addSlaveStack
 			 * @see LoadManager::addPassiveStack
 			 */
-			DataStack() {}
+			DataStack()
+			{
+				format = FloatFormat::Float32;
+				nodeShared = false;
+				learnCost = false;
+				affinity = false;
+			}
 
 			/**
 			 * @brief Invoke internal calculator and write result to the data array at the specified index. 
 			 * 
 			 * @param i Index of the element to which the result is written. 
 			 */
-			void applyCalculator(const int i) override
+			void applyCalculator(const StackIndex i) override
 			{
 				if (type == StackType::Implicit) implicitCalculator(i);
 				else if (type == StackType::Explicit) data[i] = explicitCalculator(i);
 			}
 
+			/**
+			 * @brief Round the stack's data to the precision of its transfer format. 
+			 */
+			void roundToFormat() override
+			{
+				if (format != FloatFormat::Float32) FloatCodec::round(reinterpret_cast<float *>(data), typeMultiplicity * size, format);
+			}
+
 			#ifdef HMP_MPI_ENABLED
 			/**
-			 * @brief Send a data block to a different MPI rank, typically the server rank. 
+			 * @brief Asynchronously send a data block to a different MPI rank, typically the server rank. 
 			 * 
-			 * @param offset Id of the first element of the data block to be sent, measured in number of entries (or number of entry tuples, if DataStackBase::typeMultiplicity is greater than one).
-			 * @param count Number of elements (or element tuples) to be sent. 
-			 * @param serverRank Receiver's MPI rank, typically the server rank. 
-			 * @param communicator The MPI communicator used for communication. 
+			 * @param[in] offset Id of the first element of the data block to be sent, measured in number of entries (or number of entry tuples, if DataStackBase::typeMultiplicity is greater than one).
+			 * @param[in] count Number of elements (or element tuples) to be sent. 
+			 * @param[in] serverRank Receiver's MPI rank, typically the server rank. 
+			 * @param[in] communicator The MPI communicator used for communication. 
+			 * @param[out] requests MPI request objects for the communication are appended to this list; The data block must not be modified before the requests have completed. 
 			 */
-			void send(const int offset, const int count, const int serverRank, const MPI_Comm communicator) const override
+			void send(const StackIndex offset, const StackIndex count, const int serverRank, const MPI_Comm communicator, std::vector<MPI_Request> &requests) const override
 			{
-				MPI_Send(static_cast<void *>(data + typeMultiplicity * offset), typeMultiplicity *count * sizeof(StackT), MPI_BYTE, serverRank, static_cast<int>(MessageTag::ChunkReturn), communicator);
+				_splitMessage(data + typeMultiplicity * offset, typeMultiplicity * count * sizeof(StackT), [&](void *buffer, const int bytes)
+				{
+					requests.push_back(MPI_REQUEST_NULL);
+					MPI_Isend(buffer, bytes, MPI_BYTE, serverRank, static_cast<int>(MessageTag::ChunkReturn), communicator, &requests.back());
+				});
 			}
 
 			/**
@@ -222,11 +279,15 @@ namespace HMP
 			 * @param[in] count Number of elements (or element tuples) to be received. 
 			 * @param[in] rank Sender's MPI rank. 
 			 * @param[in] communicator The MPI communicator used for communication. 
-			 * @param[out] request MPI request object for the communication; Should be used to determine whether the non-blocking receive has been completed. 
+			 * @param[out] requests MPI request objects for the communication are appended to this list; Should be used to determine whether the non-blocking receive has been completed. 
 			 */
-			void receive(const int offset, const int count, const int rank, const MPI_Comm communicator, MPI_Request &request) override
+			void receive(const StackIndex offset, const StackIndex count, const int rank, const MPI_Comm communicator, std::vector<MPI_Request> &requests) override
 			{
-				MPI_Irecv(static_cast<void *>(data + typeMultiplicity * offset), typeMultiplicity *count * sizeof(StackT), MPI_BYTE, rank, static_cast<int>(MessageTag::ChunkReturn), communicator, &request);
+				_splitMessage(data + typeMultiplicity * offset, typeMultiplicity * count * sizeof(StackT), [&](void *buffer, const int bytes)
+				{
+					requests.push_back(MPI_REQUEST_NULL);
+					MPI_Irecv(buffer, bytes, MPI_BYTE, rank, static_cast<int>(MessageTag::ChunkReturn), communicator, &requests.back());
+				});
 			}
 
 			/**
@@ -237,13 +298,49 @@ namespace HMP
 			 */
 			void broadcast(const int serverRank, const MPI_Comm communicator) override
 			{
-				MPI_Bcast(static_cast<void *>(data), typeMultiplicity * size * sizeof(StackT), MPI_BYTE, serverRank, communicator);
+				if (format == FloatFormat::Float32) _splitMessage(data, typeMultiplicity * size * sizeof(StackT), [&](void *buffer, const int bytes) { MPI_Bcast(buffer, bytes, MPI_BYTE, serverRank, communicator); });
+				else
+				{
+					//transfer 16 bit representation block by block through a reusable buffer and decode on all ranks, including the server rank
+					int rank;
+					MPI_Comm_rank(communicator, &rank);
+					float *values = reinterpret_cast<float *>(data);
+					const int64_t count = int64_t(typeMultiplicity) * size;
+					const int64_t blockSize = std::max<int64_t>(1, std::min<int64_t>(HMP_MAX_MESSAGE_SIZE, HMP_TRANSFER_BUFFER_SIZE) / int64_t(sizeof(uint16_t)));
+					_transferBuffer.resize(size_t(std::min(count, blockSize)));
+					for (int64_t offset = 0; offset < count; offset += blockSize)
+					{
+						int n = int(std::min(blockSize, count - offset));
+						if (rank == serverRank) FloatCodec::encode(values + offset, _transferBuffer.data(), n, format);
+						MPI_Bcast(_transferBuffer.data(), n * int(sizeof(uint16_t)), MPI_BYTE, serverRank, communicator);
+						FloatCodec::decode(_transferBuffer.data(), values + offset, n, format);
+					}
+				}
+			}
+
+			/**
+			 * @brief Split a data block into messages of at most HMP_MAX_MESSAGE_SIZE bytes, such that the byte count of each message fits into the MPI count type. 
+			 * Sender and receiver split identical blocks into identical sequences of messages. 
+			 * 
+			 * @tparam T Data type of the block. 
+			 * @tparam F Communication routine, invoked as f(void *buffer, int bytes) for each message in order. 
+			 * @param data Pointer to the beginning of the data block. 
+			 * @param bytes Size of the data block in bytes. 
+			 * @param f Communication routine. 
+			 */
+			template <class T, class F> static void _splitMessage(T *data, const int64_t bytes, F f)
+			{
+				char *begin = reinterpret_cast<char *>(data);
+				for (int64_t offset = 0; offset < bytes; offset += HMP_MAX_MESSAGE_SIZE) f(static_cast<void *>(begin + offset), int(std::min<int64_t>(HMP_MAX_MESSAGE_SIZE, bytes - offset)));
 			}
 			#endif
 
-			std::function<StackT(int)> explicitCalculator; ///< Explicit calculator. Only relevant if DataStackBase::type is set to StackType::Explicit. 
-			std::function<void(int)> implicitCalculator; ///< Implicit calculator. Only relevant if DataStackBase::type is set to StackType::Implicit. 
+			std::function<StackT(StackIndex)> explicitCalculator; ///< Explicit calculator. Only relevant if DataStackBase::type is set to StackType::Explicit. 
+			std::function<void(StackIndex)> implicitCalculator; ///< Implicit calculator. Only relevant if DataStackBase::type is set to StackType::Implicit. 
 			StackT *data; ///< Internal data array. 
+			#ifdef HMP_MPI_ENABLED
+			std::vector<uint16_t> _transferBuffer; ///< Buffer for the 16 bit representation of a single block of a reduced precision broadcast. Only relevant if DataStackBase::format is not FloatFormat::Float32. 
+			#endif
 		};
 
 		/**
@@ -267,7 +364,7 @@ namespace HMP
 			 * @param begin Index of the first element whose calculator should be invoked. 
 			 * @param end Index of the last element whose calculator should be invoked. 
 			 */
-			Chunk(const int stackId, const int begin, const int end)
+			Chunk(const int stackId, const StackIndex begin, const StackIndex end)
 			{
 				properties[HMP_CHUNK_PROPERTY_STACK] = stackId;
 				properties[HMP_CHUNK_PROPERTY_BEGIN] = begin;
@@ -292,14 +389,52 @@ namespace HMP
 				return !this->operator==(rhs);
 			}
 
-			int properties[3]; ///< Workload specification. First value describes the stack id, second value describes the first element of the workload, and the third value the last element of the workload.  
+			StackIndex properties[3]; ///< Workload specification. First value describes the stack id, second value describes the first element of the workload, and the third value the last element of the workload.  
+		};
+
+		/**
+		 * @brief Contiguous sub-range of the iterators of a workload chunk, which is processed by a single thread. 
+		 */
+		struct ChunkRange
+		{
+			StackIndex begin; ///< First iterator of the sub-range. 
+			StackIndex end; ///< Iterator past the last iterator of the sub-range. 
+			int slot; ///< Index of the associated chunk in the list of chunks in flight. 
+		};
+
+		/**
+		 * @brief Queue of sub-ranges which are assigned to a single thread. The owner takes sub-ranges from the front, other threads steal from the back. 
+		 */
+		struct ChunkQueue
+		{
+			std::mutex lock; ///< Lock to synchronize access to the queue. 
+			std::deque<ChunkRange> ranges; ///< Queued sub-ranges. 
+		};
+
+		/**
+		 * @brief Workload chunk in flight, i.e. a chunk which has been fetched, but whose calculators have not all been applied yet. 
+		 */
+		struct ChunkSlot
+		{
+			///Construct an inactive slot
+			ChunkSlot() : remaining(0), active(false), completed(false) {}
+
+			Chunk chunk; ///< Workload definition. 
+			std::atomic<StackIndex> remaining; ///< Number of iterators whose calculators have not been applied yet. 
+			bool active; ///< Specifies whether the slot holds a chunk in flight. 
+			bool completed; ///< Specifies whether all calculators of the chunk have been applied, while the completion of an earlier chunk is still pending. 
+			boost::posix_time::ptime fetchTime; ///< Time at which the chunk has been fetched. 
 		};
 
 	public:
 		///Destroy the LoadManager object
 		virtual ~LoadManager()
 		{
-			HMP_ENABLE_IF_MPI(MPI_Comm_free(&_communicator));
+			#ifdef HMP_MPI_ENABLED
+			MPI_Comm_free(&_communicator);
+			MPI_Comm_free(&_nodeCommunicator);
+			if (_leaderCommunicator != MPI_COMM_NULL) MPI_Comm_free(&_leaderCommunicator);
+			#endif
 
 			while (_stacks.size() > 0)
 			{
@@ -323,7 +458,7 @@ namespace HMP
 		 * @see DataStackBase::StackType::Explicit
 		 * @see DataStack
 		 */
-		template <class StackT> StackIdentifier addMasterStackExplicit(StackT *const data, const int size, const std::function<StackT(int)> &calculator, const int recommendedChunkSizeMultiple = 1, const int recommendedChunksPerRank = 10, const bool autoBroadcast = false)
+		template <class StackT> StackIdentifier addMasterStackExplicit(StackT *const data, const StackIndex size, const std::function<StackT(StackIndex)> &calculator, const int recommendedChunkSizeMultiple = 1, const int recommendedChunksPerRank = 10, const bool autoBroadcast = false)
 		{
 			DataStack<StackT> *ds = new DataStack<StackT>();
 			ds->type = DataStackBase::StackType::Explicit;
@@ -354,7 +489,7 @@ namespace HMP
 		 * @see DataStackBase::StackType::Implicit
 		 * @see DataStack
 		 */
-		template <class StackT> StackIdentifier addMasterStackImplicit(StackT *const data, const int size, const std::function<void(int)> &calculator, const int typeMultiplicity = 1, const int recommendedChunkSizeMultiple = 1, const int recommendedChunksPerRank = 10, const bool autoBroadcast = false)
+		template <class StackT> StackIdentifier addMasterStackImplicit(StackT *const data, const StackIndex size, const std::function<void(StackIndex)> &calculator, const int typeMultiplicity = 1, const int recommendedChunkSizeMultiple = 1, const int recommendedChunksPerRank = 10, const bool autoBroadcast = false)
 		{
 			DataStack<StackT> *ds = new DataStack<StackT>();
 			ds->type = DataStackBase::StackType::Implicit;
@@ -382,7 +517,7 @@ namespace HMP
 		 * @see DataStackBase::StackType::Slave
 		 * @see DataStack
 		 */
-		template <class StackT> StackIdentifier addSlaveStack(StackT *const data, const int size, const StackIdentifier master, const int typeMultiplicity = 1)
+		template <class StackT> StackIdentifier addSlaveStack(StackT *const data, const StackIndex size, const StackIdentifier master, const int typeMultiplicity = 1)
 		{
 			DataStack<StackT> *ds = new DataStack<StackT>();
 			ds->type = DataStackBase::StackType::Slave;
@@ -400,23 +535,102 @@ namespace HMP
 		 * @tparam StackT The fundamental data type of the DataStack to be created. 
 		 * @param data Data array on which the stack operates. The allocated size should be at least size * typeMultiplicity * typeof(StackT). 
 		 * @param size Number of elements (or element tuples) in the stack.
+		 * @param format Format in which the data is broadcasted. Formats other than FloatFormat::Float32 are only supported for single precision data. 
+		 * @param nodeShared Specifies whether the data array resides in memory which is shared by all MPI ranks on the same node, where the lowest rank on each node is the node leader. Requires the server rank to be a node leader. 
 		 * @return StackIdentifier Id of the newly generated stack as registered with the LoadManager. 
 		 * 
 		 * @see DataStackBase::StackType::Passive
+		 * @see DataStackBase::format
+		 * @see DataStackBase::nodeShared
 		 * @see DataStack
 		 */
-		template <class StackT> StackIdentifier addPassiveStack(StackT *const data, const int size)
+		template <class StackT> StackIdentifier addPassiveStack(StackT *const data, const StackIndex size, const FloatFormat format = FloatFormat::Float32, const bool nodeShared = false)
 		{
+			if (format != FloatFormat::Float32 && !std::is_same<StackT, float>::value) throw Exception(Exception::Type::ArgumentError, "Reduced precision broadcasts are only supported for single precision data");
+			#ifdef HMP_MPI_ENABLED
+			if (nodeShared && !_isServerNodeLeader) throw Exception(Exception::Type::ArgumentError, "Node-shared stacks require the server rank to be the lowest rank on its node");
+			#endif
+
 			DataStack<StackT> *ds = new DataStack<StackT>();
 			ds->type = DataStackBase::StackType::Passive;
 			ds->master = -1;
 			ds->size = size;
 			ds->typeMultiplicity = 1;
 			ds->autoBroadcast = false;
+			ds->format = format;
+			ds->nodeShared = nodeShared;
 			ds->data = data;
 			return _registerStack(ds);
 		}
 
+		/**
+		 * @brief Provide an estimate of the relative runtime of the calculator for each element of an explicit or implicit stack. 
+		 * @details If an estimate is available, the workload is broken down into chunks of equal estimated cost rather than of equal number of elements. 
+		 * The estimator is only evaluated on the server rank, once per calculate() call for each element. It takes precedence over learned costs. 
+		 * 
+		 * @param stackId StackIdentifier of the stack. 
+		 * @param estimator Function which returns a non-negative cost for each element index. Only the relative magnitude of the costs is relevant. 
+		 * 
+		 * @see LoadManager::enableCostLearning
+		 */
+		void setCostEstimator(const StackIdentifier stackId, const std::function<float(StackIndex)> &estimator)
+		{
+			if (_stacks[stackId]->type != DataStackBase::StackType::Explicit && _stacks[stackId]->type != DataStackBase::StackType::Implicit) throw Exception(Exception::Type::ArgumentError, "Cost estimators can only be assigned to explicit or implicit stacks.");
+			_stacks[stackId]->costEstimator = estimator;
+		}
+
+		/**
+		 * @brief Learn the relative runtime of the calculator for each element of an explicit or implicit stack from the chunk timings of the previous calculation. 
+		 * @details The time spent on each chunk is distributed evenly among its elements, and the resulting cost profile is used to form chunks of equal cost in the next calculate() call of the stack. 
+		 * This is useful if the runtime of calculators varies strongly between elements, but only slowly between consecutive calculations. 
+		 * 
+		 * @param stackId StackIdentifier of the stack. 
+		 * 
+		 * @see LoadManager::setCostEstimator
+		 */
+		void enableCostLearning(const StackIdentifier stackId)
+		{
+			if (_stacks[stackId]->type != DataStackBase::StackType::Explicit && _stacks[stackId]->type != DataStackBase::StackType::Implicit) throw Exception(Exception::Type::ArgumentError, "Cost learning can only be enabled for explicit or implicit stacks.");
+			_stacks[stackId]->learnCost = true;
+		}
+
+		/**
+		 * @brief Schedule an explicit or implicit stack with sticky iterator-to-rank affinity across calculate() calls. 
+		 * @details Each rank is assigned a contiguous home range of elements, whose size is its share of the workload in the previous calculation of the stack. 
+		 * Ranks compute chunks from the front of their own home range first, and only then steal chunks from the back of the largest remaining home range of another rank. 
+		 * Hence, if the compute power of the ranks is stable, elements are calculated on the same rank in every calculate() call, and only the work that is needed to rebalance migrates. 
+		 * In the first calculation, the stack is split into home ranges of equal workload. 
+		 * 
+		 * @param stackId StackIdentifier of the stack. 
+		 */
+		void enableAffinity(const StackIdentifier stackId)
+		{
+			if (_stacks[stackId]->type != DataStackBase::StackType::Explicit && _stacks[stackId]->type != DataStackBase::StackType::Implicit) throw Exception(Exception::Type::ArgumentError, "Affinity can only be enabled for explicit or implicit stacks.");
+			_stacks[stackId]->affinity = true;
+		}
+
+		/**
+		 * @brief Detach a stack from the LoadManager and destroy it, along with all slave stacks associated with it. Must be called on all MPI ranks. 
+		 * @details Stacks hold references to their data arrays and calculators. A stack must therefore be released before the objects it refers to are destroyed. 
+		 * The data array itself is not freed. The identifiers of released stacks are not reused, such that the identifiers of all other stacks remain valid. 
+		 * Releasing a stack which has already been released has no effect. 
+		 * 
+		 * @param stackId StackIdentifier of the stack. 
+		 */
+		virtual void releaseStack(const StackIdentifier stackId)
+		{
+			if (stackId < 0 || stackId >= StackIdentifier(_stacks.size())) throw Exception(Exception::Type::ArgumentError, "Invalid stack identifier.");
+
+			for (StackIdentifier s = 0; s < StackIdentifier(_stacks.size()); ++s)
+			{
+				if (_stacks[s] != nullptr && (s == stackId || _stacks[s]->master == stackId))
+				{
+					delete _stacks[s];
+					_stacks[s] = nullptr;
+				}
+			}
+		}
+
 		/**
 		 * @brief Calculate a list of stacks, where the stack identifiers are provided in list form. 
 		 * 
@@ -450,28 +664,38 @@ namespace HMP
 		 */
 		void calculateAll()
 		{
-			std::vector<StackIdentifier> all(_stacks.size());
-			for (StackIdentifier i = 0; i < StackIdentifier(_stacks.size()); ++i) all[i] = i;
+			std::vector<StackIdentifier> all;
+			for (StackIdentifier i = 0; i < StackIdentifier(_stacks.size()); ++i) if (_stacks[i] != nullptr) all.push_back(i);
 			calculate(all.data(), int(all.size()));
 		}
 
 		/**
 		 * @brief Broadcast a list of stacks, where the stack identifiers are provided in list form. 
+		 * @details Stacks with a 16 bit transfer format are rounded to that precision on all ranks, even if MPI parallelization is disabled. 
+		 * Node-shared stacks are only sent to the node leaders, which write the data to the shared memory in place. 
+		 * The owner of the shared memory is responsible for synchronizing the ranks on each node before the data is read. 
 		 * 
 		 * @param stackIds Pointer to the first StackIdentifier. 
 		 * @param size Number of stacks. 
 		 */
 		void broadcast(const StackIdentifier *stackIds, const int size)
 		{
-			#ifdef HMP_MPI_ENABLED
 			for (int i = 0; i < size; ++i)
 			{
 				for (StackIdentifier s = 0; s < StackIdentifier(_stacks.size()); ++s)
 				{
-					if (s == stackIds[i] || _stacks[s]->master == stackIds[i]) _stacks[s]->broadcast(_serverRank, _communicator);
+					if (_stacks[s] == nullptr) continue;
+					#ifdef HMP_MPI_ENABLED
+					if (s == stackIds[i] || _stacks[s]->master == stackIds[i])
+					{
+						if (!_stacks[s]->nodeShared) _stacks[s]->broadcast(_serverRank, _communicator);
+						else if (_leaderCommunicator != MPI_COMM_NULL) _stacks[s]->broadcast(_leaderServerRank, _leaderCommunicator);
+					}
+					#else
+					if (s == stackIds[i]) _stacks[s]->roundToFormat();
+					#endif
 				}
 			}
-			#endif
 		}
 
 		/**
@@ -499,8 +723,8 @@ namespace HMP
 		 */
 		void broadcastAll()
 		{
-			std::vector<StackIdentifier> all(_stacks.size());
-			for (StackIdentifier i = 0; i < StackIdentifier(_stacks.size()); ++i) all[i] = i;
+			std::vector<StackIdentifier> all;
+			for (StackIdentifier i = 0; i < StackIdentifier(_stacks.size()); ++i) if (_stacks[i] != nullptr) all.push_back(i);
 			broadcast(all.data(), int(all.size()));
 		}
 
@@ -526,6 +750,29 @@ namespace HMP
 
 			if (serverRank >= _commSize) throw Exception(Exception::Type::MpiError, "Server rank must not exceed communicator size.");
 			else _serverRank = serverRank;
+
+			#ifdef HMP_MPI_ENABLED
+			//group ranks by node; the lowest rank on each node is the node leader, and the node leaders share a separate communicator for node-shared stacks
+			MPI_Comm_split_type(_communicator, MPI_COMM_TYPE_SHARED, _rank, MPI_INFO_NULL, &_nodeCommunicator);
+			int nodeRank;
+			MPI_Comm_rank(_nodeCommunicator, &nodeRank);
+			MPI_Comm_split(_communicator, (nodeRank == 0) ? 0 : MPI_UNDEFINED, _rank, &_leaderCommunicator);
+
+			int isServerNodeLeader = (nodeRank == 0) ? 1 : 0;
+			MPI_Bcast(&isServerNodeLeader, 1, MPI_INT, _serverRank, _communicator);
+			_isServerNodeLeader = (isServerNodeLeader != 0);
+
+			_leaderServerRank = MPI_UNDEFINED;
+			if (_leaderCommunicator != MPI_COMM_NULL)
+			{
+				MPI_Group group, leaderGroup;
+				MPI_Comm_group(_communicator, &group);
+				MPI_Comm_group(_leaderCommunicator, &leaderGroup);
+				MPI_Group_translate_ranks(group, 1, &_serverRank, leaderGroup, &_leaderServerRank);
+				MPI_Group_free(&group);
+				MPI_Group_free(&leaderGroup);
+			}
+			#endif
 		}
 
 		/**
@@ -544,16 +791,176 @@ namespace HMP
 		}
 
 		/**
-		 * @brief Calculate the workload defined by a specific chunk. 
+		 * @brief Calculate a sequence of workload chunks on a team of threads which persists for the entire sequence. 
+		 * @details Each chunk is split into sub-ranges of iterators, which are distributed in contiguous blocks to per-thread queues. 
+		 * Threads process their own queue front to back and steal sub-ranges from the back of other queues once their own queue has run empty, 
+		 * such that threads which finish early continue on the remaining work of the same chunk or on the next chunk instead of waiting at a barrier. 
+		 * The calling thread (thread 0 of the team) additionally acts as the coordinator: It is the only thread which invokes fetch and complete, 
+		 * and it fetches the next chunk as soon as fewer than maximumChunks chunks are in flight, such that the next chunk is queued behind the current one before the threads run out of work. 
+		 * Hence, MPI communication in fetch and complete is always performed by the calling thread. Chunks are completed in the order in which they have been fetched. 
 		 * 
-		 * @param chunk Provides the workload definition. 
+		 * @tparam FetchT Callable of type bool(Chunk &), which retrieves the next workload chunk, or a void chunk if there is no further work. 
+		 * It returns false if the next chunk is not available yet, in which case the coordinator continues computing and retries later. 
+		 * @tparam CompleteT Callable of type void(const Chunk &, float), which is invoked once all calculators of a chunk and of all previously fetched chunks have been applied. 
+		 * The second argument is the time in milliseconds since the chunk has been fetched or since the previous chunk has been completed, whichever is later, 
+		 * such that the times of overlapping chunks add up to the total time spent computing. 
+		 * @param fetch Routine to fetch the next workload chunk. 
+		 * @param complete Routine to finalize a completed workload chunk. 
+		 * @param maximumChunks Maximum number of chunks which are in flight simultaneously. 
 		 */
-		void _calculateChunk(const Chunk &chunk)
+		template <class FetchT, class CompleteT> void _calculateChunks(FetchT fetch, CompleteT complete, const int maximumChunks)
 		{
+			int threads = 1;
 			#ifndef DISABLE_OMP
-			#pragma omp parallel for schedule(guided)
+			threads = omp_get_max_threads();
 			#endif
-			for (int i = chunk.properties[HMP_CHUNK_PROPERTY_BEGIN]; i < chunk.properties[HMP_CHUNK_PROPERTY_END]; ++i) _stacks[chunk.properties[HMP_CHUNK_PROPERTY_STACK]]->applyCalculator(i);
+
+			std::vector<ChunkQueue> queues(threads);
+			std::vector<ChunkSlot> slots(maximumChunks);
+			std::atomic<bool> done(false);
+			std::mutex completedLock;
+			std::vector<int> completed;
+			std::deque<int> fetchOrder;
+
+			int activeChunks = 0;
+			bool exhausted = false;
+			boost::posix_time::ptime lastCompletion = boost::posix_time::microsec_clock::local_time();
+
+			#ifndef DISABLE_OMP
+			#pragma omp parallel num_threads(threads)
+			#endif
+			{
+				int thread = 0;
+				#ifndef DISABLE_OMP
+				thread = omp_get_thread_num();
+				#endif
+
+				for (;;)
+				{
+					if (thread == 0)
+					{
+						//finalize completed chunks in the order in which they have been fetched
+						{
+							std::lock_guard<std::mutex> lock(completedLock);
+							for (int slot : completed) slots[slot].completed = true;
+							completed.clear();
+						}
+						while (!fetchOrder.empty() && slots[fetchOrder.front()].completed)
+						{
+							int slot = fetchOrder.front();
+							fetchOrder.pop_front();
+							boost::posix_time::ptime now = boost::posix_time::microsec_clock::local_time();
+							boost::posix_time::ptime begin = std::max(slots[slot].fetchTime, lastCompletion);
+							complete(slots[slot].chunk, float((now - begin).total_microseconds()) / 1000.0f);
+							lastCompletion = now;
+							slots[slot].active = false;
+							slots[slot].completed = false;
+							--activeChunks;
+						}
+
+						//fetch the next chunk before the threads run out of work
+						Chunk c;
+						if (!exhausted && activeChunks < maximumChunks && fetch(c))
+						{
+							if (c.isVoid()) exhausted = true;
+							else
+							{
+								int slot = 0;
+								while (slots[slot].active) ++slot;
+								slots[slot].chunk = c;
+								slots[slot].active = true;
+								slots[slot].fetchTime = boost::posix_time::microsec_clock::local_time();
+								slots[slot].remaining = c.properties[HMP_CHUNK_PROPERTY_END] - c.properties[HMP_CHUNK_PROPERTY_BEGIN];
+								++activeChunks;
+								fetchOrder.push_back(slot);
+								_distributeChunk(c, slot, queues);
+							}
+						}
+
+						if (exhausted && activeChunks == 0)
+						{
+							done = true;
+							break;
+						}
+					}
+					else if (done) break;
+
+					//process a sub-range of the own queue, or steal one from another thread
+					ChunkRange r;
+					if (_claimRange(queues, thread, r))
+					{
+						const Chunk &c = slots[r.slot].chunk;
+						for (StackIndex i = r.begin; i < r.end; ++i) _stacks[c.properties[HMP_CHUNK_PROPERTY_STACK]]->applyCalculator(i);
+						if (slots[r.slot].remaining.fetch_sub(r.end - r.begin) == r.end - r.begin)
+						{
+							std::lock_guard<std::mutex> lock(completedLock);
+							completed.push_back(r.slot);
+						}
+					}
+					else std::this_thread::yield();
+				}
+			}
+		}
+
+		/**
+		 * @brief Split a workload chunk into sub-ranges and distribute them in contiguous blocks to the queues of all threads. 
+		 * 
+		 * @param chunk Workload chunk. 
+		 * @param slot Index of the chunk in the list of chunks in flight. 
+		 * @param queues Per-thread queues. 
+		 */
+		static void _distributeChunk(const Chunk &chunk, const int slot, std::vector<ChunkQueue> &queues)
+		{
+			StackIndex begin = chunk.properties[HMP_CHUNK_PROPERTY_BEGIN];
+			StackIndex size = chunk.properties[HMP_CHUNK_PROPERTY_END] - begin;
+			int threads = int(queues.size());
+
+			//aim at a few sub-ranges per thread, such that there is work left to steal
+			StackIndex grain = size / (4 * threads);
+			if (grain < 1) grain = 1;
+
+			for (int t = 0; t < threads; ++t)
+			{
+				StackIndex blockBegin = begin + size * t / threads;
+				StackIndex blockEnd = begin + size * (t + 1) / threads;
+				std::lock_guard<std::mutex> lock(queues[t].lock);
+				for (StackIndex b = blockBegin; b < blockEnd; b += grain) queues[t].ranges.push_back({ b, std::min(b + grain, blockEnd), slot });
+			}
+		}
+
+		/**
+		 * @brief Claim a sub-range for computation, either from the front of the own queue, or from the back of the queue of another thread. 
+		 * 
+		 * @param[in] queues Per-thread queues. 
+		 * @param[in] thread Index of the calling thread. 
+		 * @param[out] range Claimed sub-range. 
+		 * @return bool True if a sub-range has been claimed. 
+		 */
+		static bool _claimRange(std::vector<ChunkQueue> &queues, const int thread, ChunkRange &range)
+		{
+			{
+				std::lock_guard<std::mutex> lock(queues[thread].lock);
+				if (!queues[thread].ranges.empty())
+				{
+					range = queues[thread].ranges.front();
+					queues[thread].ranges.pop_front();
+					return true;
+				}
+			}
+
+			int threads = int(queues.size());
+			for (int i = 1; i < threads; ++i)
+			{
+				ChunkQueue &victim = queues[(thread + i) % threads];
+				std::lock_guard<std::mutex> lock(victim.lock);
+				if (!victim.ranges.empty())
+				{
+					range = victim.ranges.back();
+					victim.ranges.pop_back();
+					return true;
+				}
+			}
+			return false;
 		}
 
 		std::vector<DataStackBase *> _stacks; ///< List of all registered stacks. 
@@ -561,6 +968,10 @@ namespace HMP
 		int _rank; ///< MPI rank of the current LoadManager instance. 
 		int _commSize; ///< MPI communicator size. 
 		HMP_ENABLE_IF_MPI(MPI_Comm _communicator); ///< MPI communicator to operate on. 
+		HMP_ENABLE_IF_MPI(MPI_Comm _nodeCommunicator); ///< MPI communicator of all ranks on the same node. 
+		HMP_ENABLE_IF_MPI(MPI_Comm _leaderCommunicator); ///< MPI communicator of all node leaders. Set to MPI_COMM_NULL if the current rank is not a node leader. 
+		HMP_ENABLE_IF_MPI(int _leaderServerRank); ///< Rank of the server in the node leader communicator. Set to MPI_UNDEFINED if the server is not a node leader. 
+		HMP_ENABLE_IF_MPI(bool _isServerNodeLeader); ///< Specifies whether the server rank is a node leader, which is required for node-shared stacks. 
 	};
 
 	/**
@@ -596,36 +1007,19 @@ namespace HMP
 			//init chunk spawner
 			_initChunkSpawner(stackIds, size);
 
-			//spawn local worker
-			std::thread *t = new std::thread([&]() { this->_runLocalClient(); });
-
 			#ifdef HMP_MPI_ENABLED
-			//issue initial chunks
-			for (int i = 0; i < _commSize; ++i) if (i != _serverRank) _issueChunk(i);
-
-			//collect results and issue consecutive chunks
-			int receiveFlag;
-			MPI_Status receiveStatus;
-			for (;;)
+			if (_commSize > 1)
 			{
-				begin:
-				for (int rank = 0; rank < _commSize; ++rank)
-				{
-					if (rank == _serverRank || _pendingRequests[rank] == MPI_REQUEST_NULL) continue;
-					MPI_Test(_pendingRequests + rank, &receiveFlag, &receiveStatus);
-					if (receiveFlag == 1)
-					{
-						_despawnChunk(rank);
-						_issueChunk(receiveStatus.MPI_SOURCE);
-					}
-				}
-				for (int rank = 0; rank < _commSize; ++rank) if (_pendingRequests[rank] != MPI_REQUEST_NULL) goto begin;
-				break;
+				//spawn local worker, while the calling thread serves the remote ranks
+				std::thread t([&]() { this->_runLocalClient(); });
+				_serveRemoteClients();
+				t.join();
 			}
+			else _runLocalClient();
+			#else
+			_runLocalClient();
 			#endif
-
-			//join local worker
-			t->join();
+			_updateAffinity(stackIds, size);
 
 			//broadcast result
 			for (int s = 0; s < size; ++s)
@@ -664,6 +1058,23 @@ namespace HMP
 			}
 		}
 
+		/**
+		 * @brief Detach a stack from the LoadManager and destroy it, along with all slave stacks associated with it. Must be called on all MPI ranks. 
+		 * @details In addition to the stack itself, the scheduling state of the stack, i.e. its learned cost profile and its affinity shares, is released. 
+		 * 
+		 * @param stackId StackIdentifier of the stack. 
+		 */
+		virtual void releaseStack(const StackIdentifier stackId) override
+		{
+			LoadManager::releaseStack(stackId);
+
+			std::vector<double>().swap(_currentCalculationCost[stackId]);
+			_currentCalculationHomeBegin[stackId].clear();
+			_currentCalculationHomeEnd[stackId].clear();
+			std::vector<float>().swap(_learnedCost[stackId]);
+			_affinityShare[stackId].clear();
+		}
+
 	protected:
 		/**
 		 * @brief Construct a new LoadManagerMaster object
@@ -675,15 +1086,9 @@ namespace HMP
 		{
 			_totalCalculationTime = 0.0f;
 			_totalComputeTime = new std::vector<float>[_commSize];
-			_currentCalculationWorkDone = new std::vector<int>[_commSize];
+			_currentCalculationWorkDone = new std::vector<StackIndex>[_commSize];
+			_currentCalculationCostDone = new std::vector<double>[_commSize];
 			_currentCalculationTime = new std::vector<float>[_commSize];
-			_currentCalculationChunkSpawntime = new boost::posix_time::ptime[_commSize];
-			_currentCalculationChunkSpawned = new Chunk[_commSize];
-
-			#ifdef HMP_MPI_ENABLED
-			_pendingRequests = new MPI_Request[_commSize];
-			for (int i = 0; i < _commSize; ++i) _pendingRequests[i] = MPI_REQUEST_NULL;
-			#endif
 		}
 
 		/**
@@ -693,11 +1098,8 @@ namespace HMP
 		{
 			delete[] _totalComputeTime;
 			delete[] _currentCalculationWorkDone;
+			delete[] _currentCalculationCostDone;
 			delete[] _currentCalculationTime;
-			delete[] _currentCalculationChunkSpawntime;
-			delete[] _currentCalculationChunkSpawned;
-			
-			HMP_ENABLE_IF_MPI(delete[] _pendingRequests);
 		}
 
 		/**
@@ -714,35 +1116,149 @@ namespace HMP
 			{
 				_totalComputeTime[i].push_back(0.0f);
 				_currentCalculationWorkDone[i].push_back(0);
+				_currentCalculationCostDone[i].push_back(0.0);
 				_currentCalculationTime[i].push_back(0.0f);
 			}
 
 			_currentCalculationComputeTimeBuffer.resize(_commSize * _stacks.size());
 			_currentCalculationStackMask.resize(_stacks.size());
 			_currentCalculationStackProgress.resize(_stacks.size());
+			_currentCalculationCost.resize(_stacks.size());
+			_currentCalculationHomeBegin.resize(_stacks.size());
+			_currentCalculationHomeEnd.resize(_stacks.size());
+			_learnedCost.resize(_stacks.size());
+			_affinityShare.resize(_stacks.size());
 
 			return identifier;
 		}
 
+		#ifdef HMP_MPI_ENABLED
 		/**
-		 * @brief Worker loop to run calculators locally. 
+		 * @brief Workload chunk which has been issued to a remote rank, but whose result has not been received completely. 
 		 */
-		void _runLocalClient()
+		struct IssuedChunk
 		{
-			for (;;)
+			Chunk chunk; ///< Workload definition. 
+			boost::posix_time::ptime issueTime; ///< Time at which the chunk has been issued. 
+			int outstanding; ///< Number of receive requests for the result which have not completed yet. 
+		};
+
+		/**
+		 * @brief Issue chunks to the remote ranks and collect their results, until every remote rank has been issued a void chunk. 
+		 * @details Up to HMP_CHUNKS_IN_FLIGHT chunks are issued to each rank ahead of time, such that a rank can start on its next chunk without waiting for a round trip to the server. 
+		 * The receive requests of all remote ranks are tested at once via MPI_Testsome. Results of a rank are finalized in the order in which the chunks have been issued, and each finalized chunk is replaced by a new one. 
+		 * The time attributed to a chunk is measured from its issue or from the completion of the previous chunk of the same rank, whichever is later, such that the times of overlapping chunks add up to the busy time of the rank. 
+		 * If no request has completed, the calling thread sleeps for an interval which doubles up to HMP_MAX_POLL_INTERVAL microseconds, 
+		 * such that it does not compete with the local worker threads for compute resources while the remote ranks are busy. 
+		 */
+		void _serveRemoteClients()
+		{
+			std::vector<MPI_Request> requests;
+			std::vector<int> owners;
+			std::vector<int64_t> sequences;
+			std::vector<int> indices;
+			std::vector<std::deque<IssuedChunk>> issued(_commSize);
+			std::vector<int64_t> firstSequence(_commSize, 0);
+			std::vector<bool> finished(_commSize, false);
+			std::vector<boost::posix_time::ptime> lastCompletion(_commSize, boost::posix_time::microsec_clock::local_time());
+
+			//finalize received chunks of a rank and issue new ones, until the rank has the maximum number of chunks in flight
+			std::vector<MPI_Request> chunkRequests;
+			auto advance = [&](const int rank) -> void
 			{
-				//get chunk
-				Chunk c = _spawnChunk(_serverRank);
-				if (c.isVoid()) break;
+				for (;;)
+				{
+					if (!issued[rank].empty() && issued[rank].front().outstanding == 0)
+					{
+						boost::posix_time::ptime now = boost::posix_time::microsec_clock::local_time();
+						boost::posix_time::ptime begin = std::max(issued[rank].front().issueTime, lastCompletion[rank]);
+						_despawnChunk(rank, issued[rank].front().chunk, float((now - begin).total_microseconds()) / 1000.0f);
+						lastCompletion[rank] = now;
+						issued[rank].pop_front();
+						++firstSequence[rank];
+					}
+					else if (!finished[rank] && int(issued[rank].size()) < HMP_CHUNKS_IN_FLIGHT)
+					{
+						chunkRequests.clear();
+						Chunk c = _issueChunk(rank, chunkRequests);
+						if (c.isVoid())
+						{
+							finished[rank] = true;
+							continue;
+						}
+						for (MPI_Request r : chunkRequests)
+						{
+							requests.push_back(r);
+							owners.push_back(rank);
+							sequences.push_back(firstSequence[rank] + int64_t(issued[rank].size()));
+						}
+						issued[rank].push_back({ c, boost::posix_time::microsec_clock::local_time(), int(chunkRequests.size()) });
+					}
+					else break;
+				}
+			};
+			for (int rank = 0; rank < _commSize; ++rank) if (rank != _serverRank) advance(rank);
 
-				boost::posix_time::ptime tic = boost::posix_time::microsec_clock::local_time();
-				_calculateChunk(c);
-				boost::posix_time::ptime toc = boost::posix_time::microsec_clock::local_time();
-				_currentCalculationComputeTimeBuffer[c.properties[HMP_CHUNK_PROPERTY_STACK]] += (toc - tic).total_milliseconds();
+			int interval = 1;
+			while (!requests.empty())
+			{
+				int completedCount;
+				indices.resize(requests.size());
+				MPI_Testsome(int(requests.size()), requests.data(), &completedCount, indices.data(), MPI_STATUSES_IGNORE);
+				if (completedCount == 0)
+				{
+					std::this_thread::sleep_for(std::chrono::microseconds(interval));
+					interval = std::min(2 * interval, HMP_MAX_POLL_INTERVAL);
+					continue;
+				}
+				interval = 1;
 
-				_despawnChunk(_serverRank);
+				//account completed requests to their chunks, and drop them
+				std::vector<int> ready;
+				for (int i = 0; i < completedCount; ++i)
+				{
+					int rank = owners[indices[i]];
+					--issued[rank][size_t(sequences[indices[i]] - firstSequence[rank])].outstanding;
+					ready.push_back(rank);
+				}
+				size_t remaining = 0;
+				for (size_t i = 0; i < requests.size(); ++i)
+				{
+					if (requests[i] == MPI_REQUEST_NULL) continue;
+					requests[remaining] = requests[i];
+					owners[remaining] = owners[i];
+					sequences[remaining] = sequences[i];
+					++remaining;
+				}
+				requests.resize(remaining);
+				owners.resize(remaining);
+				sequences.resize(remaining);
+
+				//finalize results and issue consecutive chunks
+				std::sort(ready.begin(), ready.end());
+				ready.erase(std::unique(ready.begin(), ready.end()), ready.end());
+				for (int rank : ready) advance(rank);
 			}
 		}
+		#endif
+
+		/**
+		 * @brief Worker loop to run calculators locally. 
+		 * The worker team spans all OpenMP threads, as the thread which serves the remote ranks sleeps while it waits for results. 
+		 */
+		void _runLocalClient()
+		{
+			//the next chunk is spawned while the tail of the current chunk is still being computed
+			_calculateChunks([&](Chunk &c) -> bool
+			{
+				c = _spawnChunk(_serverRank);
+				return true;
+			}, [&](const Chunk &c, const float time)
+			{
+				_currentCalculationComputeTimeBuffer[c.properties[HMP_CHUNK_PROPERTY_STACK]] += time;
+				_despawnChunk(_serverRank, c, time);
+			}, HMP_CHUNKS_IN_FLIGHT);
+		}
 
 		/**
 		 * @brief Prepare the chunk spawner, i.e. the routine responsible for breaking down workload into smaller chunsk, for the execution of calculators on the specified list of stacks. 
@@ -758,6 +1274,7 @@ namespace HMP
 				for (StackIdentifier s = 0; s < StackIdentifier(_stacks.size()); ++s)
 				{
 					_currentCalculationWorkDone[i][s] = 0;
+					_currentCalculationCostDone[i][s] = 0.0;
 					_currentCalculationTime[i][s] = 0.0f;
 				}
 			}
@@ -767,8 +1284,200 @@ namespace HMP
 				_currentCalculationStackProgress[s] = 0;
 			}
 
-			//enable selected stacks
-			for (int i = 0; i < size; ++i) _currentCalculationStackMask[stackIds[i]] = true;
+			//enable selected stacks and prepare their cost profiles and home ranges
+			for (int i = 0; i < size; ++i)
+			{
+				_currentCalculationStackMask[stackIds[i]] = true;
+				_initCost(stackIds[i]);
+				_initAffinity(stackIds[i]);
+			}
+		}
+
+		/**
+		 * @brief Prepare the cumulative cost profile of a stack for the current calculate() call, either from its cost estimator or from the costs learned in the previous calculation. 
+		 * If neither is available, the profile is left empty, and chunks are formed from the number of elements. 
+		 * 
+		 * @param s StackIdentifier of the stack. 
+		 */
+		void _initCost(const StackIdentifier s)
+		{
+			std::vector<double> &cumulativeCost = _currentCalculationCost[s];
+			cumulativeCost.clear();
+
+			//collect element costs
+			std::vector<float> cost;
+			if (_stacks[s]->costEstimator)
+			{
+				cost.resize(_stacks[s]->size);
+				for (StackIndex i = 0; i < _stacks[s]->size; ++i) cost[i] = _stacks[s]->costEstimator(i);
+			}
+			else if (_stacks[s]->learnCost && StackIndex(_learnedCost[s].size()) == _stacks[s]->size) cost = _learnedCost[s];
+			if (cost.empty()) return;
+
+			double totalCost = 0.0;
+			for (float c : cost)
+			{
+				if (!std::isfinite(c) || c < 0.0f) return;
+				totalCost += c;
+			}
+			if (totalCost <= 0.0) return;
+
+			//bound element costs from below, such that chunks in regions of negligible cost remain finite
+			double minimumCost = 0.01 * totalCost / double(cost.size());
+			cumulativeCost.resize(cost.size() + 1);
+			cumulativeCost[0] = 0.0;
+			for (size_t i = 0; i < cost.size(); ++i) cumulativeCost[i + 1] = cumulativeCost[i] + std::max(double(cost[i]), minimumCost);
+		}
+
+		/**
+		 * @brief Prepare the home ranges of a stack which is scheduled with affinity for the current calculate() call. 
+		 * The home ranges are placed in the order of the ranks, and each holds the share of the rank in the previous calculation in units of the estimated cost, or of the number of elements if the stack has no cost profile. 
+		 * Hence, a rank keeps most of its previous elements, and the boundaries between home ranges only shift as far as necessary to rebalance. 
+		 * 
+		 * @param s StackIdentifier of the stack. 
+		 */
+		void _initAffinity(const StackIdentifier s)
+		{
+			std::vector<StackIndex> &homeBegin = _currentCalculationHomeBegin[s];
+			std::vector<StackIndex> &homeEnd = _currentCalculationHomeEnd[s];
+			homeBegin.clear();
+			homeEnd.clear();
+			if (!_stacks[s]->affinity) return;
+
+			//start from the shares of the previous calculation, or from equal shares
+			std::vector<double> share = _affinityShare[s];
+			if (int(share.size()) != _commSize) share.assign(_commSize, 1.0 / _commSize);
+
+			const std::vector<double> &cumulativeCost = _currentCalculationCost[s];
+			homeBegin.resize(_commSize);
+			homeEnd.resize(_commSize);
+			double cumulativeShare = 0.0;
+			StackIndex boundary = 0;
+			for (int i = 0; i < _commSize; ++i)
+			{
+				homeBegin[i] = boundary;
+				cumulativeShare += share[i];
+				if (i == _commSize - 1) boundary = _stacks[s]->size;
+				else if (!cumulativeCost.empty()) boundary = StackIndex(std::lower_bound(cumulativeCost.begin(), cumulativeCost.end(), cumulativeShare * cumulativeCost.back()) - cumulativeCost.begin());
+				else boundary = StackIndex(cumulativeShare * _stacks[s]->size + 0.5);
+				boundary = std::min(std::max(boundary, homeBegin[i]), _stacks[s]->size);
+				homeEnd[i] = boundary;
+			}
+		}
+
+		/**
+		 * @brief Record the share of each rank in the workload of the calculated stacks which are scheduled with affinity, which determines the home ranges in the next calculate() call. 
+		 * The share is measured in units of the estimated cost, or of the number of elements if the stack has no cost profile. 
+		 * 
+		 * @param stackIds Pointer to the first StackIdentifier which has been calculated. 
+		 * @param size Number of StackIdentifiers which have been calculated. 
+		 */
+		void _updateAffinity(const StackIdentifier *stackIds, const int size)
+		{
+			for (int i = 0; i < size; ++i)
+			{
+				StackIdentifier s = stackIds[i];
+				if (!_stacks[s]->affinity) continue;
+
+				std::vector<double> share(_commSize);
+				double totalShare = 0.0;
+				for (int j = 0; j < _commSize; ++j)
+				{
+					share[j] = (_currentCalculationCost[s].empty()) ? double(_currentCalculationWorkDone[j][s]) : _currentCalculationCostDone[j][s];
+					totalShare += share[j];
+				}
+				if (totalShare <= 0.0) continue;
+				for (int j = 0; j < _commSize; ++j) share[j] /= totalShare;
+				_affinityShare[s] = share;
+			}
+		}
+
+		/**
+		 * @brief Determine the end of the next chunk of a stack, such that the chunk has the desired share of the remaining workload. 
+		 * 
+		 * @param rank MPI rank for which the workload chunk is being requested. 
+		 * @param s StackIdentifier of the stack. 
+		 * @param begin Index of the first element of the chunk. 
+		 * @return StackIndex Index past the last element of the chunk. May exceed the stack size. 
+		 */
+		StackIndex _chunkEnd(const int rank, const StackIdentifier s, const StackIndex begin) const
+		{
+			//stacks with a cost profile are broken down into chunks of equal cost
+			if (!_currentCalculationCost[s].empty()) return _costChunkEnd(rank, s, begin);
+
+			//determine max chunk size
+			StackIndex maximumWorkShare = _stacks[s]->size / (_stacks[s]->recommendedChunksPerRank * _commSize);
+			maximumWorkShare = (maximumWorkShare / _stacks[s]->recommendedChunkSizeMultiple + 1) * _stacks[s]->recommendedChunkSizeMultiple;
+			if (maximumWorkShare < 1) maximumWorkShare = 1;
+
+			//determine dynamic chunk size according to compute power
+			float myComputePower = _currentCalculationWorkDone[rank][s] / _currentCalculationTime[rank][s];
+			float totalComputePower = 0;
+			for (int i = 0; i < _commSize; ++i) 
+				for (StackIdentifier j = 0; j < StackIdentifier(_stacks.size()); ++j) totalComputePower += _currentCalculationWorkDone[i][j] / _currentCalculationTime[i][j];
+		
+			if (std::isfinite(myComputePower) && std::isfinite(totalComputePower))
+			{
+				//factor in amount of remaining work
+				StackIndex remainingWork = _stacks[s]->size - _currentCalculationStackProgress[s];
+				StackIndex myWorkShare = StackIndex((double(myComputePower) / totalComputePower) * remainingWork);
+				myWorkShare = (myWorkShare / _stacks[s]->recommendedChunkSizeMultiple + 1) * _stacks[s]->recommendedChunkSizeMultiple;
+
+				//clip to min/max chunk size
+				int minumumWorkTime = 100;
+				StackIndex minimumWorkShare = StackIndex(double(myComputePower) * minumumWorkTime);
+				if (minimumWorkShare < 1) minimumWorkShare = 1;
+				if (myWorkShare < minimumWorkShare) myWorkShare = minimumWorkShare;
+				if (myWorkShare > maximumWorkShare) myWorkShare = maximumWorkShare;
+				return begin + myWorkShare;
+			}
+			else return begin + maximumWorkShare;
+		}
+
+		/**
+		 * @brief Determine the end of the next chunk of a stack with a cost profile, such that the chunk has the desired share of the remaining cost. 
+		 * The share is proportional to the relative compute power of the rank and to the remaining cost, which makes chunks shrink as the calculation proceeds, 
+		 * such that the largest chunks are issued first and the calculation ends on small chunks. 
+		 * 
+		 * @param rank MPI rank for which the workload chunk is being requested. 
+		 * @param s StackIdentifier of the stack. 
+		 * @param begin Index of the first element of the chunk. 
+		 * @return StackIndex Index past the last element of the chunk. 
+		 */
+		StackIndex _costChunkEnd(const int rank, const StackIdentifier s, const StackIndex begin) const
+		{
+			//determine the cost of all unissued elements
+			const std::vector<double> &cumulativeCost = _currentCalculationCost[s];
+			double remainingCost = 0.0;
+			if (_currentCalculationHomeBegin[s].empty()) remainingCost = cumulativeCost.back() - cumulativeCost[_currentCalculationStackProgress[s]];
+			else for (int i = 0; i < _commSize; ++i) remainingCost += cumulativeCost[_currentCalculationHomeEnd[s][i]] - cumulativeCost[_currentCalculationHomeBegin[s][i]];
+
+			//determine max chunk cost
+			double maximumCost = cumulativeCost.back() / (_stacks[s]->recommendedChunksPerRank * _commSize);
+
+			//determine dynamic chunk cost according to compute power, measured in cost per millisecond
+			double myComputePower = _currentCalculationCostDone[rank][s] / _currentCalculationTime[rank][s];
+			double totalComputePower = 0.0;
+			for (int i = 0; i < _commSize; ++i)
+			{
+				double computePower = _currentCalculationCostDone[i][s] / _currentCalculationTime[i][s];
+				if (std::isfinite(computePower)) totalComputePower += computePower;
+			}
+
+			double chunkCost = maximumCost;
+			if (std::isfinite(myComputePower) && totalComputePower > 0.0)
+			{
+				//factor in amount of remaining work and clip to min/max chunk cost
+				int minimumWorkTime = 100;
+				chunkCost = std::max(myComputePower / totalComputePower * remainingCost, myComputePower * minimumWorkTime);
+				chunkCost = std::min(chunkCost, maximumCost);
+			}
+
+			//find the smallest chunk which reaches the desired cost, and round it up to the recommended multiple
+			StackIndex end = StackIndex(std::lower_bound(cumulativeCost.begin() + begin + 1, cumulativeCost.end(), cumulativeCost[begin] + chunkCost) - cumulativeCost.begin());
+			StackIndex multiple = _stacks[s]->recommendedChunkSizeMultiple;
+			end = begin + (end - begin + multiple - 1) / multiple * multiple;
+			return std::min(end, _stacks[s]->size);
 		}
 
 		/**
@@ -789,6 +1498,8 @@ namespace HMP
 		 *  3. Round up that number to be a multiple of the recommended chunk size. 
 		 *  4. Determine chunk size according to relative computing power of the different ranks, based on performance on previous chunks. 
 		 *  5. Clip chunk size to minimum of 100ms expected return time and maximum as determined before. 
+		 *  If the stack has a cost profile, steps 2-5 are performed in units of the estimated cost instead of the number of elements, see LoadManagerMaster::_costChunkEnd. 
+		 *  If the stack is scheduled with affinity, the chunk is taken from the home range of the rank, see LoadManagerMaster::_affinityChunk. 
 		 * 
 		 * @param rank MPI rank for which the workload chunk is being requested. 
 		 * @return Chunk Definition of the workload. 
@@ -803,101 +1514,138 @@ namespace HMP
 				//skip inactive and completed stacks
 				if (!_currentCalculationStackMask[s] || _currentCalculationStackProgress[s] >= _stacks[s]->size) continue;
 
-				//determine max chunk size
-				int maximumWorkShare = int(_stacks[s]->size / (_stacks[s]->recommendedChunksPerRank * _commSize));
-				maximumWorkShare = (int(maximumWorkShare / _stacks[s]->recommendedChunkSizeMultiple) + 1) * _stacks[s]->recommendedChunkSizeMultiple;
-				if (maximumWorkShare < 1) maximumWorkShare = 1;
-
-				//determine dynamic chunk size according to compute power
-				float myComputePower = _currentCalculationWorkDone[rank][s] / _currentCalculationTime[rank][s];
-				float totalComputePower = 0;
-				for (int i = 0; i < _commSize; ++i) 
-					for (StackIdentifier j = 0; j < StackIdentifier(_stacks.size()); ++j) totalComputePower += _currentCalculationWorkDone[i][j] / _currentCalculationTime[i][j];
-				
-				int newCurrentCalculationProgress;
-				if (std::isfinite(myComputePower) && std::isfinite(totalComputePower))
+				//take the chunk from the home ranges if the stack is scheduled with affinity, or from the front of the unissued elements otherwise
+				StackIndex begin, end;
+				if (!_currentCalculationHomeBegin[s].empty()) _affinityChunk(rank, s, begin, end);
+				else
 				{
-					//factor in amount of remaining work
-					int remainingWork = int(_stacks[s]->size - _currentCalculationStackProgress[s]);
-					int myWorkShare = int((myComputePower / totalComputePower) * remainingWork);
-					myWorkShare = (int(myWorkShare / _stacks[s]->recommendedChunkSizeMultiple) + 1) * _stacks[s]->recommendedChunkSizeMultiple;
-
-					//clip to min/max chunk size
-					int minumumWorkTime = 100;
-					int minimumWorkShare = int(myComputePower * minumumWorkTime);
-					if (minimumWorkShare < 1) minimumWorkShare = 1;
-					if (myWorkShare < minimumWorkShare) myWorkShare = minimumWorkShare;
-					if (myWorkShare > maximumWorkShare) myWorkShare = maximumWorkShare;
-					newCurrentCalculationProgress = _currentCalculationStackProgress[s] + myWorkShare;
+					begin = _currentCalculationStackProgress[s];
+					end = std::min(_chunkEnd(rank, s, begin), _stacks[s]->size);
 				}
-				else newCurrentCalculationProgress = _currentCalculationStackProgress[s] + maximumWorkShare;
-
-				//clip chunk to stack size
-				if (newCurrentCalculationProgress >= _stacks[s]->size) newCurrentCalculationProgress = _stacks[s]->size;
 
 				//write chunk parameters
-				_currentCalculationWorkDone[rank][s] += newCurrentCalculationProgress - _currentCalculationStackProgress[s];
 				c.properties[HMP_CHUNK_PROPERTY_STACK] = s;
-				c.properties[HMP_CHUNK_PROPERTY_BEGIN] = decltype(c.properties[HMP_CHUNK_PROPERTY_BEGIN])(_currentCalculationStackProgress[s]);
-				c.properties[HMP_CHUNK_PROPERTY_END] = decltype(c.properties[HMP_CHUNK_PROPERTY_END])(newCurrentCalculationProgress);
-				Log::log << Log::LogLevel::Debug << "LoadManager spawned chunk (stack " << s << ", from " << _currentCalculationStackProgress[s] << ", to " << newCurrentCalculationProgress << ", rank  " << rank << ")" << Log::endl;
+				c.properties[HMP_CHUNK_PROPERTY_BEGIN] = decltype(c.properties[HMP_CHUNK_PROPERTY_BEGIN])(begin);
+				c.properties[HMP_CHUNK_PROPERTY_END] = decltype(c.properties[HMP_CHUNK_PROPERTY_END])(end);
+				Log::log << Log::LogLevel::Debug << "LoadManager spawned chunk (stack " << s << ", from " << begin << ", to " << end << ", rank  " << rank << ")" << Log::endl;
 
 				//return chunk
-				_currentCalculationStackProgress[s] = newCurrentCalculationProgress;
+				_currentCalculationStackProgress[s] += end - begin;
 				break;
 			}
-			_currentCalculationChunkSpawntime[rank] = boost::posix_time::microsec_clock::local_time();
-			_currentCalculationChunkSpawned[rank] = c;
 			return c;
 		}
 
 		/**
-		 * @brief Send a workload chunk to a specified MPI rank. 
+		 * @brief Determine the next chunk of a stack which is scheduled with affinity. 
+		 * The chunk is taken from the front of the home range of the rank. Once the home range is exhausted, a chunk of the same size is stolen from the back of the home range with the largest remaining workload, 
+		 * such that the owner of that range keeps the elements at its front. 
 		 * 
-		 * @param rank Receiver's MPI rank. 
+		 * @param rank MPI rank for which the workload chunk is being requested. 
+		 * @param s StackIdentifier of the stack. 
+		 * @param begin Index of the first element of the chunk. 
+		 * @param end Index past the last element of the chunk. 
 		 */
-		void _issueChunk(const int rank)
+		void _affinityChunk(const int rank, const StackIdentifier s, StackIndex &begin, StackIndex &end)
+		{
+			std::vector<StackIndex> &homeBegin = _currentCalculationHomeBegin[s];
+			std::vector<StackIndex> &homeEnd = _currentCalculationHomeEnd[s];
+			if (homeBegin[rank] < homeEnd[rank])
+			{
+				begin = homeBegin[rank];
+				end = std::min(_chunkEnd(rank, s, begin), homeEnd[rank]);
+				homeBegin[rank] = end;
+				return;
+			}
+
+			//find the home range with the largest remaining workload
+			const std::vector<double> &cumulativeCost = _currentCalculationCost[s];
+			int victim = -1;
+			double victimWork = 0.0;
+			for (int i = 0; i < _commSize; ++i)
+			{
+				if (homeBegin[i] >= homeEnd[i]) continue;
+				double work = (cumulativeCost.empty()) ? double(homeEnd[i] - homeBegin[i]) : cumulativeCost[homeEnd[i]] - cumulativeCost[homeBegin[i]];
+				if (victim == -1 || work > victimWork)
+				{
+					victim = i;
+					victimWork = work;
+				}
+			}
+
+			//steal from its back
+			StackIndex chunkSize = _chunkEnd(rank, s, homeBegin[victim]) - homeBegin[victim];
+			end = homeEnd[victim];
+			begin = std::max(homeBegin[victim], end - chunkSize);
+			homeEnd[victim] = begin;
+		}
+
+		#ifdef HMP_MPI_ENABLED
+		/**
+		 * @brief Send a workload chunk to a specified MPI rank, and post the receive requests for its result. 
+		 * 
+		 * @param[in] rank Receiver's MPI rank. 
+		 * @param[out] requests MPI request objects for the result are appended to this list; The result has been received once all requests have completed. 
+		 * @return Chunk Definition of the workload. 
+		 */
+		Chunk _issueChunk(const int rank, std::vector<MPI_Request> &requests)
 		{
-			#ifdef HMP_MPI_ENABLED
 			Chunk c = _spawnChunk(rank);
-			MPI_Send(&c.properties, 3, MPI_INT, rank, static_cast<int>(DataStackBase::MessageTag::Chunk), _communicator);
+			MPI_Send(&c.properties, 3, MPI_INT64_T, rank, static_cast<int>(DataStackBase::MessageTag::Chunk), _communicator);
 
 			if (!c.isVoid())
 			{
 				for (StackIdentifier i = 0; i < StackIdentifier(_stacks.size()); ++i)
 				{
-					//we may expect to receive data from additional slave stacks; due to MPI's non-overtaking policy, it is sufficient to only store the most recent request per rank
-					if (i == c.properties[HMP_CHUNK_PROPERTY_STACK] || _stacks[i]->master == c.properties[HMP_CHUNK_PROPERTY_STACK]) _stacks[i]->receive(c.properties[HMP_CHUNK_PROPERTY_BEGIN], c.properties[HMP_CHUNK_PROPERTY_END] - c.properties[HMP_CHUNK_PROPERTY_BEGIN], rank, _communicator, _pendingRequests[rank]);
+					//we may expect to receive data from additional slave stacks, possibly split into multiple messages each; the chunk is complete once all requests have completed
+					if (_stacks[i] != nullptr && (i == c.properties[HMP_CHUNK_PROPERTY_STACK] || _stacks[i]->master == c.properties[HMP_CHUNK_PROPERTY_STACK])) _stacks[i]->receive(c.properties[HMP_CHUNK_PROPERTY_BEGIN], c.properties[HMP_CHUNK_PROPERTY_END] - c.properties[HMP_CHUNK_PROPERTY_BEGIN], rank, _communicator, requests);
 				}
 			}
-			else _pendingRequests[rank] = MPI_REQUEST_NULL;
-			#endif
+			return c;
 		}
+		#endif
 
 		/**
-		 * @brief Mark a workload chunk as completed. Relevant only for runtime statistics information. 
+		 * @brief Mark a specific workload chunk as completed, and account its workload and time to the rank. 
 		 * 
 		 * @param rank MPI rank which had completed the workload. 
+		 * @param chunk Workload definition. 
+		 * @param chunktime Time in milliseconds which is attributed to the chunk. 
 		 */
-		void _despawnChunk(const int rank)
+		void _despawnChunk(const int rank, const Chunk &chunk, const float chunktime)
 		{
-			float chunktime = float((boost::posix_time::microsec_clock::local_time() - _currentCalculationChunkSpawntime[rank]).total_milliseconds());
 			std::lock_guard<std::mutex> lock(_currentCalculationChunkSpawnerLock);
-			_currentCalculationTime[rank][_currentCalculationChunkSpawned[rank].properties[HMP_CHUNK_PROPERTY_STACK]] += chunktime;
+			StackIdentifier s = StackIdentifier(chunk.properties[HMP_CHUNK_PROPERTY_STACK]);
+			StackIndex begin = chunk.properties[HMP_CHUNK_PROPERTY_BEGIN];
+			StackIndex end = chunk.properties[HMP_CHUNK_PROPERTY_END];
+			_currentCalculationWorkDone[rank][s] += end - begin;
+			if (!_currentCalculationCost[s].empty()) _currentCalculationCostDone[rank][s] += _currentCalculationCost[s][end] - _currentCalculationCost[s][begin];
+			_currentCalculationTime[rank][s] += chunktime;
+
+			//distribute the chunk time evenly among its elements to learn the cost profile for the next calculation
+			if (_stacks[s]->learnCost)
+			{
+				if (StackIndex(_learnedCost[s].size()) != _stacks[s]->size) _learnedCost[s].assign(_stacks[s]->size, NAN);
+				float cost = chunktime / float(chunk.properties[HMP_CHUNK_PROPERTY_END] - chunk.properties[HMP_CHUNK_PROPERTY_BEGIN]);
+				for (StackIndex i = chunk.properties[HMP_CHUNK_PROPERTY_BEGIN]; i < chunk.properties[HMP_CHUNK_PROPERTY_END]; ++i) _learnedCost[s][i] = cost;
+			}
 		}
 
 		float _totalCalculationTime; ///< Accumulated time in milliseconds which has been spent on calculate() calls over the lifetime of the LoadManager instance. 
 		std::vector<float> *_totalComputeTime; ///< _totalComputeTime[rank][stack] is the accumulated time in milliseconds which MPI rank `rank` spent computing on `stack`. 
-		std::vector<int> *_currentCalculationWorkDone; ///< _currentCalculationWorkDone[rank][stack] is the number of calculations which have been performed by MPI rank `rank` on `stack` in the current calculate() call. 
+		std::vector<StackIndex> *_currentCalculationWorkDone; ///< _currentCalculationWorkDone[rank][stack] is the number of calculations which have been performed by MPI rank `rank` on `stack` in the current calculate() call. 
+		std::vector<double> *_currentCalculationCostDone; ///< _currentCalculationCostDone[rank][stack] is the estimated cost of the calculations which have been performed by MPI rank `rank` on `stack` in the current calculate() call. Only relevant for stacks with a cost profile. 
 		std::vector<float> *_currentCalculationTime; ///< _currentCalculationTime[rank][stack] is the time in milliseconds spent by MPI rank `rank` until returning chunk result for `stack` in the current calculate() call. 
-		boost::posix_time::ptime *_currentCalculationChunkSpawntime; ///< _currentCalculationChunkSpawntime[rank] specifies time at which the most recent chunk has been issued to MPI rank `rank` in the current calculate() call. 
-		Chunk *_currentCalculationChunkSpawned; ///< _currentCalculationChunkSpawned[rank] stores the most recent chunk generated for MPI rank `rank` in the current calculate() call. 
 		std::vector<float> _currentCalculationComputeTimeBuffer; ///< _currentCalculationComputeTimeBuffer[rank*_stacks.size()+stack] is a buffer for the time in milliseconds spent on computing `stack` in the current calculate() call. 
 		std::vector<bool> _currentCalculationStackMask; ///< _currentCalculationStackMask[stack] specifies whether `stack` should be computed in the current calculate() call. 
-		std::vector<int> _currentCalculationStackProgress; ///< _currentCalculationStackProgress[stack] specifies the current progress (pointer to the next unissued value) which has already been issued for computation in the current calculate() call. 
+		std::vector<StackIndex> _currentCalculationStackProgress; ///< _currentCalculationStackProgress[stack] specifies the current progress (number of values) which has already been issued for computation in the current calculate() call. Unless `stack` is scheduled with affinity, this is the pointer to the next unissued value. 
+		std::vector<std::vector<double>> _currentCalculationCost; ///< _currentCalculationCost[stack][i] is the cumulative estimated cost of the first i elements of `stack` in the current calculate() call, or empty if `stack` has no cost profile. 
+		std::vector<std::vector<StackIndex>> _currentCalculationHomeBegin; ///< _currentCalculationHomeBegin[stack][rank] is the first unissued element in the home range of MPI rank `rank` in the current calculate() call, or empty if `stack` is not scheduled with affinity. 
+		std::vector<std::vector<StackIndex>> _currentCalculationHomeEnd; ///< _currentCalculationHomeEnd[stack][rank] is the end of the unissued elements in the home range of MPI rank `rank` in the current calculate() call, or empty if `stack` is not scheduled with affinity. 
+		std::vector<std::vector<float>> _learnedCost; ///< _learnedCost[stack][i] is the cost of element i of `stack` learned from the chunk timings of previous calculations. Only relevant for stacks with cost learning enabled. 
+		std::vector<std::vector<double>> _affinityShare; ///< _affinityShare[stack][rank] is the share of MPI rank `rank` in the workload of `stack` in the previous calculation, or empty if there is none. Only relevant for stacks which are scheduled with affinity. 
 		std::mutex _currentCalculationChunkSpawnerLock; ///< Lock to synchronize chunk spawning for remote calculations and for local worker threads. 
 
-		HMP_ENABLE_IF_MPI(MPI_Request *_pendingRequests); ///< MPI request objects associated with the return values for workload chunks that have been issued. 
 	};
 
 	/**
@@ -920,22 +1668,24 @@ namespace HMP
 			#ifdef HMP_MPI_ENABLED
 			memset(_currentCalculationComputeTimeBuffer.data(), 0, _currentCalculationComputeTimeBuffer.size() * sizeof(float));
 
-			Chunk c;
-			for (;;)
+			//receive chunks, compute them, and return the results; the master keeps up to HMP_CHUNKS_IN_FLIGHT chunks issued, such that the next chunk is received while the current one is computed
+			Chunk next;
+			MPI_Request chunkRequest = MPI_REQUEST_NULL;
+			std::vector<MPI_Request> returnRequests;
+			_calculateChunks([&](Chunk &c) -> bool
 			{
-				//receive chunk
-				_waitChunk(c);
-				if (c.isVoid()) break;
-
-				//compute chunk
-				boost::posix_time::ptime tic = boost::posix_time::microsec_clock::local_time();
-				_calculateChunk(c);
-				boost::posix_time::ptime toc = boost::posix_time::microsec_clock::local_time();
-				_currentCalculationComputeTimeBuffer[c.properties[HMP_CHUNK_PROPERTY_STACK]] += (toc - tic).total_milliseconds();
-
-				//return chunk
-				_returnChunk(c);
-			}
+				if (chunkRequest == MPI_REQUEST_NULL) _receiveChunk(next, chunkRequest);
+				int receiveFlag;
+				MPI_Test(&chunkRequest, &receiveFlag, MPI_STATUS_IGNORE);
+				if (receiveFlag == 0) return false;
+				c = next;
+				return true;
+			}, [&](const Chunk &c, const float time)
+			{
+				_currentCalculationComputeTimeBuffer[c.properties[HMP_CHUNK_PROPERTY_STACK]] += time;
+				_returnChunk(c, returnRequests);
+			}, HMP_CHUNKS_IN_FLIGHT);
+			MPI_Waitall(int(returnRequests.size()), returnRequests.data(), MPI_STATUSES_IGNORE);
 
 			//broadcast result
 			for (int s = 0; s < size; ++s)
@@ -972,33 +1722,32 @@ namespace HMP
 			return identifier;
 		}
 
+		#ifdef HMP_MPI_ENABLED
 		/**
-		 * @brief Wait until a workload chunk has been received from a LoadManagerMaster instance. 
+		 * @brief Post a non-blocking receive for the next workload chunk from a LoadManagerMaster instance. 
 		 * 
-		 * @param[out] chunk The workload definition which has been received. 
+		 * @param[out] chunk The workload definition to be received. Must remain valid until the request has completed. 
+		 * @param[out] request MPI request object for the communication. 
 		 */
-		void _waitChunk(Chunk &chunk) const
+		void _receiveChunk(Chunk &chunk, MPI_Request &request) const
 		{
-			#ifdef HMP_MPI_ENABLED
-			MPI_Status status;
-			MPI_Recv(&chunk.properties, 3, MPI_INT, _serverRank, static_cast<int>(DataStackBase::MessageTag::Chunk), _communicator, &status);
-			#endif
+			MPI_Irecv(&chunk.properties, 3, MPI_INT64_T, _serverRank, static_cast<int>(DataStackBase::MessageTag::Chunk), _communicator, &request);
 		}
 
 		/**
-		 * @brief Return the result of the workload defined by a specific chunk. 
+		 * @brief Asynchronously return the result of the workload defined by a specific chunk. 
 		 * 
-		 * @param chunk The workload definition whose results are to be returned. 
+		 * @param[in] chunk The workload definition whose results are to be returned. 
+		 * @param[out] requests MPI request objects for the communication are appended to this list. 
 		 */
-		void _returnChunk(const Chunk &chunk) const
+		void _returnChunk(const Chunk &chunk, std::vector<MPI_Request> &requests) const
 		{
-			#ifdef HMP_MPI_ENABLED
 			for (int i = 0; i < int(_stacks.size()); ++i)
 			{
-				if (i == chunk.properties[HMP_CHUNK_PROPERTY_STACK] || _stacks[i]->master == chunk.properties[HMP_CHUNK_PROPERTY_STACK]) _stacks[i]->send(chunk.properties[HMP_CHUNK_PROPERTY_BEGIN], chunk.properties[HMP_CHUNK_PROPERTY_END] - chunk.properties[HMP_CHUNK_PROPERTY_BEGIN], _serverRank, _communicator);
+				if (_stacks[i] != nullptr && (i == chunk.properties[HMP_CHUNK_PROPERTY_STACK] || _stacks[i]->master == chunk.properties[HMP_CHUNK_PROPERTY_STACK])) _stacks[i]->send(chunk.properties[HMP_CHUNK_PROPERTY_BEGIN], chunk.properties[HMP_CHUNK_PROPERTY_END] - chunk.properties[HMP_CHUNK_PROPERTY_BEGIN], _serverRank, _communicator, requests);
 			}
-			#endif
 		}
+		#endif
 
 		std::vector<float> _currentCalculationComputeTimeBuffer; ///< _currentCalculationComputeTimeBuffer[stack] is a buffer for the time in milliseconds spent on computing `stack` in the current calculate() call. 
 	};
@@ -1026,6 +1775,8 @@ namespace HMP
 #undef HMP_CHUNK_PROPERTY_STACK
 #undef HMP_CHUNK_PROPERTY_BEGIN
 #undef HMP_CHUNK_PROPERTY_END
+#undef HMP_MAX_MESSAGE_SIZE
+#undef HMP_TRANSFER_BUFFER_SIZE
 
 #undef HMP_MPI_ENABLED
 #undef HMP_ENABLE_IF_MPI
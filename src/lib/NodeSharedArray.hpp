@@ -0,0 +1,126 @@
+/**
+ * @file NodeSharedArray.hpp
+ * @author Finn Lasse Buessen
+ * @brief Single precision array which is shared by all MPI ranks on the same node.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include "lib/Exception.hpp"
+
+#ifndef DISABLE_MPI
+#include "mpi.h"
+#endif
+
+/**
+ * @brief Single precision array which is shared by all MPI ranks on the same node.
+ * @details The array is allocated once per node in an MPI shared memory window, which is owned by the node leader, i.e. the lowest MPI rank on the node.
+ * All ranks on the node access the same memory in place, such that the memory footprint per node does not grow with the number of ranks per node.
+ *
+ * Only the node leader may modify the array. Since other ranks on the node may read the array at any time, modifications must be enclosed by calls to
+ * NodeSharedArray::synchronize() on all ranks: The first call guarantees that no reads are in progress, the second call makes the modifications visible to all ranks on the node.
+ * If MPI is disabled, the only rank is the node leader.
+ */
+class NodeSharedArray
+{
+public:
+	/**
+	 * @brief Construct a new NodeSharedArray object and initialize all values to zero. Must be called collectively on all MPI ranks.
+	 *
+	 * @param size Number of values.
+	 */
+	NodeSharedArray(const int64_t size) : _size(size)
+	{
+		if (size < 0) throw Exception(Exception::Type::ArgumentError, "Invalid size of node-shared array");
+
+		#ifndef DISABLE_MPI
+		int rank;
+		MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+		MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &_communicator);
+		MPI_Comm_rank(_communicator, &_nodeRank);
+
+		//the node leader allocates the memory, all other ranks map it into their address space
+		float *localData;
+		MPI_Win_allocate_shared(MPI_Aint((isLeader()) ? size * sizeof(float) : 0), int(sizeof(float)), MPI_INFO_NULL, _communicator, &localData, &_window);
+		MPI_Aint leaderSize;
+		int leaderDisplacement;
+		MPI_Win_shared_query(_window, 0, &leaderSize, &leaderDisplacement, &_data);
+		MPI_Win_lock_all(MPI_MODE_NOCHECK, _window);
+		#else
+		_nodeRank = 0;
+		_data = new float[size];
+		#endif
+		if (isLeader() && size > 0) memset(_data, 0, size * sizeof(float));
+
+		synchronize();
+	}
+
+	/**
+	 * @brief Destroy the NodeSharedArray object. Must be called collectively on all MPI ranks.
+	 */
+	~NodeSharedArray()
+	{
+		#ifndef DISABLE_MPI
+		MPI_Win_unlock_all(_window);
+		MPI_Win_free(&_window);
+		MPI_Comm_free(&_communicator);
+		#else
+		delete[] _data;
+		#endif
+	}
+
+	/**
+	 * @brief Retrieve the number of values.
+	 *
+	 * @return int64_t Number of values.
+	 */
+	int64_t size() const
+	{
+		return _size;
+	}
+
+	/**
+	 * @brief Retrieve the shared data.
+	 *
+	 * @return float* Pointer to the first value.
+	 */
+	float *data() const
+	{
+		return _data;
+	}
+
+	/**
+	 * @brief Check whether the current MPI rank is the node leader, which owns the shared memory and may modify it.
+	 *
+	 * @return bool Returns true if the current rank is the node leader.
+	 */
+	bool isLeader() const
+	{
+		return _nodeRank == 0;
+	}
+
+	/**
+	 * @brief Synchronize all MPI ranks on the node. Must be called collectively on all MPI ranks before and after the array is modified.
+	 */
+	void synchronize()
+	{
+		#ifndef DISABLE_MPI
+		MPI_Win_sync(_window);
+		MPI_Barrier(_communicator);
+		MPI_Win_sync(_window);
+		#endif
+	}
+
+private:
+	int64_t _size; ///< Number of values.
+	float *_data; ///< Shared data.
+	int _nodeRank; ///< Rank of the current process within its node.
+
+	#ifndef DISABLE_MPI
+	MPI_Comm _communicator; ///< MPI communicator of all ranks on the node.
+	MPI_Win _window; ///< MPI shared memory window.
+	#endif
+};
@@ -0,0 +1,161 @@
+/**
+ * @file ScratchArena.hpp
+ * @author Finn Lasse Buessen
+ * @brief Thread-local bump allocator for short-lived scratch buffers.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "lib/SimdKernels.hpp"
+
+/**
+ * @brief Bump allocator for scratch buffers which are only needed during a single computation, e.g. during the calculation of a single vertex value.
+ * @details Memory is handed out consecutively from large blocks, which are aligned to SimdKernels::alignment bytes, and it is reclaimed all at once
+ * when the enclosing ScratchArena::Scope is destroyed. Blocks are retained for subsequent scopes, such that repeated computations of the same size
+ * neither call the system allocator nor touch fresh pages after the first one. If a scope requires more memory than the current blocks provide, an
+ * additional block is allocated, and all blocks are merged into a single one as soon as the arena is empty again.
+ *
+ * Arenas are not thread safe. Each thread obtains its own arena via ScratchArena::local().
+ */
+class ScratchArena
+{
+public:
+	/**
+	 * @brief Marks the current fill level of an arena upon construction, and releases all memory which has been allocated since then upon destruction. Scopes may be nested.
+	 */
+	class Scope
+	{
+	public:
+		/**
+		 * @brief Construct a new Scope object.
+		 *
+		 * @param arena Arena to which the scope applies.
+		 */
+		Scope(ScratchArena &arena) : _arena(arena), _block(arena._block), _offset(arena._offset) {}
+
+		/**
+		 * @brief Destroy the Scope object and release all memory which has been allocated in the scope.
+		 */
+		~Scope()
+		{
+			_arena._release(_block, _offset);
+		}
+
+	private:
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+
+		ScratchArena &_arena; ///< Arena to which the scope applies.
+		size_t _block; ///< Block index at the construction of the scope.
+		size_t _offset; ///< Offset in the block at the construction of the scope.
+	};
+
+	/**
+	 * @brief Construct an empty ScratchArena object. Memory is allocated upon the first request.
+	 */
+	ScratchArena() : _block(0), _offset(0) {}
+
+	/**
+	 * @brief Destroy the ScratchArena object and release all blocks.
+	 */
+	~ScratchArena()
+	{
+		for (Block &b : _blocks) SimdKernels::deallocate(b.data);
+	}
+
+	/**
+	 * @brief Retrieve the arena of the calling thread.
+	 *
+	 * @return ScratchArena& Thread-local arena.
+	 */
+	static ScratchArena &local()
+	{
+		static thread_local ScratchArena arena;
+		return arena;
+	}
+
+	/**
+	 * @brief Allocate memory from the arena. The memory remains valid until the innermost enclosing scope is destroyed.
+	 *
+	 * @param size Number of bytes.
+	 * @return void* Pointer to the memory, aligned to SimdKernels::alignment bytes.
+	 */
+	void *allocate(const size_t size)
+	{
+		size_t alignedSize = (size + SimdKernels::alignment - 1) / SimdKernels::alignment * SimdKernels::alignment;
+
+		//advance to the first block with sufficient free space, or append a new block
+		while (_block < _blocks.size() && _offset + alignedSize > _blocks[_block].size)
+		{
+			++_block;
+			_offset = 0;
+		}
+		if (_block == _blocks.size())
+		{
+			size_t blockSize = minimalBlockSize;
+			if (alignedSize > blockSize) blockSize = alignedSize;
+			_blocks.push_back({ static_cast<char *>(SimdKernels::allocate(blockSize)), blockSize });
+		}
+
+		void *memory = _blocks[_block].data + _offset;
+		_offset += alignedSize;
+		return memory;
+	}
+
+	/**
+	 * @brief Retrieve the total number of bytes which are held by the arena.
+	 *
+	 * @return size_t Capacity in bytes.
+	 */
+	size_t capacity() const
+	{
+		size_t c = 0;
+		for (const Block &b : _blocks) c += b.size;
+		return c;
+	}
+
+	/**
+	 * @brief Minimal size of a block in bytes.
+	 */
+	static const size_t minimalBlockSize = 1 << 16;
+
+private:
+	ScratchArena(const ScratchArena &) = delete;
+	ScratchArena &operator=(const ScratchArena &) = delete;
+
+	/**
+	 * @brief Contiguous block of memory.
+	 */
+	struct Block
+	{
+		char *data; ///< Pointer to the memory.
+		size_t size; ///< Size of the block in bytes.
+	};
+
+	/**
+	 * @brief Reset the fill level to a previous state. If the arena is empty afterwards and consists of several blocks, they are merged into a single block.
+	 *
+	 * @param block Block index.
+	 * @param offset Offset in the block.
+	 */
+	void _release(const size_t block, const size_t offset)
+	{
+		_block = block;
+		_offset = offset;
+
+		if (_block == 0 && _offset == 0 && _blocks.size() > 1)
+		{
+			size_t blockSize = capacity();
+			for (Block &b : _blocks) SimdKernels::deallocate(b.data);
+			_blocks.clear();
+			_blocks.push_back({ static_cast<char *>(SimdKernels::allocate(blockSize)), blockSize });
+		}
+	}
+
+	std::vector<Block> _blocks; ///< Blocks of memory.
+	size_t _block; ///< Index of the block from which memory is currently allocated.
+	size_t _offset; ///< Offset of the next free byte in the current block.
+};
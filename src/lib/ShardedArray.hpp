@@ -0,0 +1,326 @@
+/**
+ * @file ShardedArray.hpp
+ * @author Finn Lasse Buessen
+ * @brief Single precision array which is distributed across MPI ranks and accessed via one-sided communication.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+#include <vector>
+#include <mutex>
+#include "lib/Exception.hpp"
+
+#ifndef DISABLE_MPI
+#include "mpi.h"
+#endif
+
+#ifndef SHARDED_ARRAY_CACHE_LOCKS
+#define SHARDED_ARRAY_CACHE_LOCKS 64 ///< Number of locks which guard the cache of a ShardedArray. Cache slots are assigned to the locks in a round-robin fashion.
+#endif
+
+/**
+ * @brief Single precision array which is distributed across all MPI ranks.
+ * @details The array is organized in lines of fixed length. Each MPI rank owns a contiguous block of lines, which is exposed in an MPI window.
+ * Lines owned by other ranks are retrieved via one-sided communication (MPI_Get) and kept in a direct-mapped cache,
+ * such that repeated accesses to the same remote line do not require further communication.
+ * The cache slots are guarded by a set of locks, which are only held while a slot is read or filled, but not while a line is retrieved from its owner.
+ *
+ * Each rank may only modify the lines it owns. Since other ranks may read local lines at any time, modifications must be enclosed by calls to
+ * ShardedArray::synchronize() on all ranks: The first call guarantees that no remote reads are in progress, the second call
+ * makes the modifications visible to all ranks and invalidates the cache.
+ * Remote lines may be accessed concurrently from multiple threads, which requires MPI to be initialized with MPI_THREAD_MULTIPLE support.
+ * If MPI is disabled, all lines are owned by the only rank.
+ */
+class ShardedArray
+{
+public:
+	/**
+	 * @brief Construct a new ShardedArray object and initialize all values to zero. Must be called collectively on all MPI ranks.
+	 *
+	 * @param lineCount Total number of lines.
+	 * @param lineSize Number of values per line.
+	 * @param cacheSize Number of remote lines which are cached.
+	 */
+	ShardedArray(const int64_t lineCount, const int lineSize, const int cacheSize) : _lineCount(lineCount), _lineSize(lineSize), _cacheSize(cacheSize)
+	{
+		if (lineCount < 0 || lineSize < 1 || cacheSize < 0) throw Exception(Exception::Type::ArgumentError, "Invalid dimensions of sharded array");
+
+		#ifndef DISABLE_MPI
+		MPI_Comm_dup(MPI_COMM_WORLD, &_communicator);
+		MPI_Comm_size(_communicator, &_commSize);
+		MPI_Comm_rank(_communicator, &_rank);
+		#else
+		_commSize = 1;
+		_rank = 0;
+		#endif
+
+		_begin = lineBegin(_rank);
+		_end = lineBegin(_rank + 1);
+
+		#ifndef DISABLE_MPI
+		MPI_Win_allocate(MPI_Aint(localSize() * sizeof(float)), int(sizeof(float)), MPI_INFO_NULL, _communicator, &_data, &_window);
+		MPI_Win_lock_all(MPI_MODE_NOCHECK, _window);
+		#else
+		_data = new float[localSize()];
+		#endif
+		memset(_data, 0, localSize() * sizeof(float));
+
+		_cacheTags.assign(cacheSize, -1);
+		_cacheData.resize(int64_t(cacheSize) * lineSize);
+
+		synchronize();
+	}
+
+	/**
+	 * @brief Destroy the ShardedArray object. Must be called collectively on all MPI ranks.
+	 */
+	~ShardedArray()
+	{
+		#ifndef DISABLE_MPI
+		MPI_Win_unlock_all(_window);
+		MPI_Win_free(&_window);
+		MPI_Comm_free(&_communicator);
+		#else
+		delete[] _data;
+		#endif
+	}
+
+	/**
+	 * @brief Retrieve the total number of lines.
+	 *
+	 * @return int64_t Number of lines.
+	 */
+	int64_t lineCount() const
+	{
+		return _lineCount;
+	}
+
+	/**
+	 * @brief Retrieve the number of values per line.
+	 *
+	 * @return int Number of values per line.
+	 */
+	int lineSize() const
+	{
+		return _lineSize;
+	}
+
+	/**
+	 * @brief Retrieve the first line owned by the current MPI rank.
+	 *
+	 * @return int64_t Index of the first local line.
+	 */
+	int64_t begin() const
+	{
+		return _begin;
+	}
+
+	/**
+	 * @brief Retrieve the end of the range of lines owned by the current MPI rank.
+	 *
+	 * @return int64_t Index one past the last local line.
+	 */
+	int64_t end() const
+	{
+		return _end;
+	}
+
+	/**
+	 * @brief Retrieve the number of values owned by the current MPI rank.
+	 *
+	 * @return int64_t Number of local values.
+	 */
+	int64_t localSize() const
+	{
+		return (_end - _begin) * _lineSize;
+	}
+
+	/**
+	 * @brief Retrieve the local data, which consists of the lines [begin(),end()).
+	 *
+	 * @return float* Pointer to the first local value.
+	 */
+	float *data() const
+	{
+		return _data;
+	}
+
+	/**
+	 * @brief Retrieve the first line owned by the specified MPI rank.
+	 *
+	 * @param rank MPI rank.
+	 * @return int64_t Index of the first line.
+	 */
+	int64_t lineBegin(const int rank) const
+	{
+		return rank * _lineCount / _commSize;
+	}
+
+	/**
+	 * @brief Determine the MPI rank which owns the specified line.
+	 *
+	 * @param line Line index.
+	 * @return int Owner's MPI rank.
+	 */
+	int owner(const int64_t line) const
+	{
+		return int(((line + 1) * _commSize + _lineCount - 1) / _lineCount) - 1;
+	}
+
+	/**
+	 * @brief Access a line. Local lines are accessed directly, remote lines are served from the cache or retrieved from their owner.
+	 *
+	 * @param line Line index.
+	 * @param buffer Buffer of at least lineSize() values, into which remote lines are copied.
+	 * @return const float* Pointer to the line values, which either points to local data or to the buffer.
+	 */
+	const float *line(const int64_t line, float *buffer) const
+	{
+		if (line >= _begin && line < _end) return _data + (line - _begin) * _lineSize;
+		if (_cacheSize == 0)
+		{
+			_get(line * _lineSize, _lineSize, buffer);
+			return buffer;
+		}
+
+		int slot = int(line % _cacheSize);
+		const float *cachedLine = _cacheData.data() + int64_t(slot) * _lineSize;
+		{
+			std::lock_guard<std::mutex> lock(_cacheLocks[slot % SHARDED_ARRAY_CACHE_LOCKS]);
+			if (_cacheTags[slot] == line)
+			{
+				memcpy(buffer, cachedLine, _lineSize * sizeof(float));
+				return buffer;
+			}
+		}
+
+		_get(line * _lineSize, _lineSize, buffer);
+		_cacheLine(slot, line, buffer);
+		return buffer;
+	}
+
+	/**
+	 * @brief Access a single value.
+	 *
+	 * @param index Index of the value, measured in number of values from the beginning of the array.
+	 * @return float Value.
+	 */
+	float value(const int64_t index) const
+	{
+		int64_t line = index / _lineSize;
+		if (line >= _begin && line < _end) return _data[index - _begin * _lineSize];
+		if (_cacheSize == 0)
+		{
+			float v;
+			_get(index, 1, &v);
+			return v;
+		}
+
+		int slot = int(line % _cacheSize);
+		{
+			std::lock_guard<std::mutex> lock(_cacheLocks[slot % SHARDED_ARRAY_CACHE_LOCKS]);
+			if (_cacheTags[slot] == line) return _cacheData[int64_t(slot) * _lineSize + index - line * _lineSize];
+		}
+
+		thread_local std::vector<float> buffer;
+		buffer.resize(_lineSize);
+		_get(line * _lineSize, _lineSize, buffer.data());
+		_cacheLine(slot, line, buffer.data());
+		return buffer[index - line * _lineSize];
+	}
+
+	/**
+	 * @brief Read an arbitrary block of consecutive values, bypassing the cache.
+	 *
+	 * @param[in] index Index of the first value.
+	 * @param[in] count Number of values.
+	 * @param[out] buffer Buffer of at least count values.
+	 */
+	void read(const int64_t index, const int64_t count, float *buffer) const
+	{
+		_get(index, count, buffer);
+	}
+
+	/**
+	 * @brief Synchronize all MPI ranks and invalidate the cache. Must be called collectively on all MPI ranks before and after local lines are modified.
+	 */
+	void synchronize()
+	{
+		#ifndef DISABLE_MPI
+		MPI_Win_sync(_window);
+		MPI_Barrier(_communicator);
+		#endif
+		std::fill(_cacheTags.begin(), _cacheTags.end(), -1);
+	}
+
+private:
+	/**
+	 * @brief Store a remote line in its cache slot, replacing the line which previously occupied the slot.
+	 *
+	 * @param slot Cache slot of the line.
+	 * @param line Line index.
+	 * @param values Line values.
+	 */
+	void _cacheLine(const int slot, const int64_t line, const float *values) const
+	{
+		std::lock_guard<std::mutex> lock(_cacheLocks[slot % SHARDED_ARRAY_CACHE_LOCKS]);
+		memcpy(_cacheData.data() + int64_t(slot) * _lineSize, values, _lineSize * sizeof(float));
+		_cacheTags[slot] = line;
+	}
+
+	/**
+	 * @brief Retrieve a block of consecutive values from their owners.
+	 *
+	 * @param[in] index Index of the first value.
+	 * @param[in] count Number of values.
+	 * @param[out] buffer Buffer of at least count values.
+	 */
+	void _get(int64_t index, int64_t count, float *buffer) const
+	{
+		#ifndef DISABLE_MPI
+		while (count > 0)
+		{
+			int target = owner(index / _lineSize);
+			int64_t targetBegin = lineBegin(target) * _lineSize;
+			int64_t n = std::min(count, lineBegin(target + 1) * _lineSize - index);
+
+			//split transfers whose element count exceeds the MPI count type
+			for (int64_t offset = 0; offset < n; offset += INT_MAX)
+			{
+				int m = int(std::min<int64_t>(INT_MAX, n - offset));
+				MPI_Get(buffer + offset, m, MPI_FLOAT, target, MPI_Aint(index - targetBegin + offset), m, MPI_FLOAT, _window);
+			}
+			MPI_Win_flush(target, _window);
+
+			index += n;
+			count -= n;
+			buffer += n;
+		}
+		#else
+		memcpy(buffer, _data + index, count * sizeof(float));
+		#endif
+	}
+
+	int64_t _lineCount; ///< Total number of lines.
+	int _lineSize; ///< Number of values per line.
+	int _cacheSize; ///< Number of cached remote lines.
+	int64_t _begin; ///< First line owned by the current MPI rank.
+	int64_t _end; ///< End of the range of lines owned by the current MPI rank.
+	float *_data; ///< Local lines.
+	int _rank; ///< MPI rank of the current process.
+	int _commSize; ///< MPI communicator size.
+
+	mutable std::vector<int64_t> _cacheTags; ///< _cacheTags[slot] is the index of the line stored in the cache slot, or -1 if the slot is empty.
+	mutable std::vector<float> _cacheData; ///< Cached line values.
+	mutable std::mutex _cacheLocks[SHARDED_ARRAY_CACHE_LOCKS]; ///< _cacheLocks[slot % SHARDED_ARRAY_CACHE_LOCKS] guards the cache slot `slot`.
+
+	#ifndef DISABLE_MPI
+	MPI_Comm _communicator; ///< MPI communicator.
+	MPI_Win _window; ///< MPI window which exposes the local lines.
+	#endif
+};
@@ -0,0 +1,218 @@
+/**
+ * @file SimdKernels.cpp
+ * @author Finn Lasse Buessen
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "SimdKernels.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_KERNELS_X86
+#endif
+
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace SimdKernels
+{
+	namespace
+	{
+		#ifdef SIMD_KERNELS_X86
+		typedef float Vector4 __attribute__((vector_size(16)));
+		typedef float Vector8 __attribute__((vector_size(32)));
+		typedef float Vector16 __attribute__((vector_size(64)));
+
+		/**
+		 * @brief Vectorized loop over an operation with vector type V and a scalar remainder. Inlined into the instruction set specific kernels, which determine the generated instructions.
+		 */
+		template <Operation operation, class V> inline __attribute__((always_inline)) void applyVector(float *y, const float *x1, const float *x2, const float a, const int64_t size)
+		{
+			const int64_t width = sizeof(V) / sizeof(float);
+
+			int64_t i = 0;
+			for (; i + width <= size; i += width)
+			{
+				V vy, v1 = V(), v2 = V();
+				memcpy(&vy, y + i, sizeof(V));
+				if (Operator<operation>::operands > 0) memcpy(&v1, x1 + i, sizeof(V));
+				if (Operator<operation>::operands > 1) memcpy(&v2, x2 + i, sizeof(V));
+				Operator<operation>::apply(vy, v1, v2, a);
+				memcpy(y + i, &vy, sizeof(V));
+			}
+			for (; i < size; ++i)
+			{
+				Operator<operation>::apply(y[i], (Operator<operation>::operands > 0) ? x1[i] : 0.0f, (Operator<operation>::operands > 1) ? x2[i] : 0.0f, a);
+			}
+		}
+
+		/**
+		 * @brief SSE implementation of all operations.
+		 */
+		struct ImplementationSSE
+		{
+			template <Operation operation> static void kernel(float *y, const float *x1, const float *x2, const float a, const int64_t size)
+			{
+				applyVector<operation, Vector4>(y, x1, x2, a, size);
+			}
+		};
+
+		/**
+		 * @brief AVX2 implementation of all operations.
+		 */
+		struct ImplementationAVX2
+		{
+			template <Operation operation> __attribute__((target("avx2"))) static void kernel(float *y, const float *x1, const float *x2, const float a, const int64_t size)
+			{
+				applyVector<operation, Vector8>(y, x1, x2, a, size);
+			}
+		};
+
+		/**
+		 * @brief AVX-512 implementation of all operations.
+		 */
+		struct ImplementationAVX512
+		{
+			template <Operation operation> __attribute__((target("avx512f"))) static void kernel(float *y, const float *x1, const float *x2, const float a, const int64_t size)
+			{
+				applyVector<operation, Vector16>(y, x1, x2, a, size);
+			}
+		};
+		#endif
+
+		/**
+		 * @brief Portable scalar implementation of all operations.
+		 */
+		struct ImplementationScalar
+		{
+			template <Operation operation> static void kernel(float *y, const float *x1, const float *x2, const float a, const int64_t size)
+			{
+				applyScalar<operation, float>(y, x1, x2, a, size);
+			}
+		};
+
+		/**
+		 * @brief Kernels of all operations for all instruction sets.
+		 */
+		struct KernelTable
+		{
+			KernelTable()
+			{
+				_fill<ImplementationScalar>(InstructionSet::Scalar);
+				#ifdef SIMD_KERNELS_X86
+				_fill<ImplementationSSE>(InstructionSet::SSE);
+				_fill<ImplementationAVX2>(InstructionSet::AVX2);
+				_fill<ImplementationAVX512>(InstructionSet::AVX512);
+				#else
+				for (int i = 1; i < numberOfInstructionSets; ++i) _fill<ImplementationScalar>(static_cast<InstructionSet>(i));
+				#endif
+			}
+
+			Kernel kernels[numberOfInstructionSets][numberOfOperations]; ///< Kernels, indexed by instruction set and operation.
+
+		private:
+			template <class Implementation> void _fill(const InstructionSet instructionSet)
+			{
+				Kernel *k = kernels[static_cast<int>(instructionSet)];
+				k[static_cast<int>(Operation::MultAddScalar)] = &Implementation::template kernel<Operation::MultAddScalar>;
+				k[static_cast<int>(Operation::MultAdd)] = &Implementation::template kernel<Operation::MultAdd>;
+				k[static_cast<int>(Operation::MultAddScalarProduct)] = &Implementation::template kernel<Operation::MultAddScalarProduct>;
+				k[static_cast<int>(Operation::MultSubScalar)] = &Implementation::template kernel<Operation::MultSubScalar>;
+				k[static_cast<int>(Operation::MultSub)] = &Implementation::template kernel<Operation::MultSub>;
+				k[static_cast<int>(Operation::MultSubScalarProduct)] = &Implementation::template kernel<Operation::MultSubScalarProduct>;
+				k[static_cast<int>(Operation::Add)] = &Implementation::template kernel<Operation::Add>;
+				k[static_cast<int>(Operation::Sub)] = &Implementation::template kernel<Operation::Sub>;
+				k[static_cast<int>(Operation::Mult)] = &Implementation::template kernel<Operation::Mult>;
+				k[static_cast<int>(Operation::Div)] = &Implementation::template kernel<Operation::Div>;
+			}
+		};
+
+		const KernelTable &kernelTable()
+		{
+			static const KernelTable table;
+			return table;
+		}
+	}
+
+	bool isSupported(const InstructionSet instructionSet)
+	{
+		switch (instructionSet)
+		{
+		case InstructionSet::Scalar:
+			return true;
+		#ifdef SIMD_KERNELS_X86
+		case InstructionSet::SSE:
+			return __builtin_cpu_supports("sse2");
+		case InstructionSet::AVX2:
+			return __builtin_cpu_supports("avx2");
+		case InstructionSet::AVX512:
+			return __builtin_cpu_supports("avx512f");
+		#endif
+		default:
+			return false;
+		}
+	}
+
+	InstructionSet instructionSet()
+	{
+		static const InstructionSet best = []() -> InstructionSet
+		{
+			for (int i = numberOfInstructionSets - 1; i > 0; --i)
+			{
+				if (isSupported(static_cast<InstructionSet>(i))) return static_cast<InstructionSet>(i);
+			}
+			return InstructionSet::Scalar;
+		}();
+		return best;
+	}
+
+	const char *name(const InstructionSet instructionSet)
+	{
+		switch (instructionSet)
+		{
+		case InstructionSet::SSE:
+			return "SSE";
+		case InstructionSet::AVX2:
+			return "AVX2";
+		case InstructionSet::AVX512:
+			return "AVX-512";
+		default:
+			return "Scalar";
+		}
+	}
+
+	Kernel kernel(const Operation operation, const InstructionSet instructionSet)
+	{
+		return kernelTable().kernels[static_cast<int>(instructionSet)][static_cast<int>(operation)];
+	}
+
+	const Kernel *kernels()
+	{
+		return kernelTable().kernels[static_cast<int>(instructionSet())];
+	}
+
+	void *allocate(const size_t size)
+	{
+		void *memory = nullptr;
+		#ifdef _MSC_VER
+		memory = _aligned_malloc((size > 0) ? size : 1, alignment);
+		#else
+		if (posix_memalign(&memory, alignment, (size > 0) ? size : 1) != 0) memory = nullptr;
+		#endif
+		if (memory == nullptr) throw std::bad_alloc();
+		return memory;
+	}
+
+	void deallocate(void *memory)
+	{
+		#ifdef _MSC_VER
+		_aligned_free(memory);
+		#else
+		free(memory);
+		#endif
+	}
+}
@@ -0,0 +1,242 @@
+/**
+ * @file SimdKernels.hpp
+ * @author Finn Lasse Buessen
+ * @brief Explicitly vectorized arithmetic kernels for value arrays with runtime instruction set dispatch.
+ *
+ * @copyright Copyright (c) 2020
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Explicitly vectorized arithmetic kernels for value arrays.
+ * @details Single precision kernels are implemented for several x86 instruction sets. The widest instruction set which is supported by the CPU is detected once at runtime,
+ * and all subsequent calls of SimdKernels::apply() are dispatched to the corresponding implementation. Non-x86 platforms and other data types use portable scalar loops.
+ *
+ * All implementations perform the same sequence of floating point operations on each element, such that results are bitwise identical on all instruction sets.
+ */
+namespace SimdKernels
+{
+	/**
+	 * @brief Alignment in bytes of memory which is allocated via SimdKernels::allocate().
+	 */
+	const size_t alignment = 64;
+
+	/**
+	 * @brief Instruction sets with dedicated kernel implementations.
+	 */
+	enum struct InstructionSet
+	{
+		Scalar = 0, ///< Portable scalar loops.
+		SSE = 1, ///< 128 bit SSE vectors.
+		AVX2 = 2, ///< 256 bit AVX2 vectors.
+		AVX512 = 3 ///< 512 bit AVX-512 vectors.
+	};
+
+	/**
+	 * @brief Number of instruction sets.
+	 */
+	const int numberOfInstructionSets = 4;
+
+	/**
+	 * @brief Elementwise operations y[i] = f(y[i], x1[i], x2[i], a) on an array y with array operands x1, x2 and a scalar operand a.
+	 */
+	enum struct Operation
+	{
+		MultAddScalar = 0, ///< y += a * x1.
+		MultAdd = 1, ///< y += x1 * x2.
+		MultAddScalarProduct = 2, ///< y += a * x1 * x2.
+		MultSubScalar = 3, ///< y -= a * x1.
+		MultSub = 4, ///< y -= x1 * x2.
+		MultSubScalarProduct = 5, ///< y -= a * x1 * x2.
+		Add = 6, ///< y += x1.
+		Sub = 7, ///< y -= x1.
+		Mult = 8, ///< y *= a.
+		Div = 9 ///< y /= a.
+	};
+
+	/**
+	 * @brief Number of operations.
+	 */
+	const int numberOfOperations = 10;
+
+	/**
+	 * @brief Single precision kernel, which applies an operation to size elements of y. Array operands which are not used by the operation may be nullptr.
+	 */
+	typedef void (*Kernel)(float *y, const float *x1, const float *x2, const float a, const int64_t size);
+
+	/**
+	 * @brief Elementwise definition of the operations. U is either a scalar or a vector type, T is the scalar type.
+	 *
+	 * @tparam operation Operation.
+	 */
+	template <Operation operation> struct Operator;
+
+	template <> struct Operator<Operation::MultAddScalar>
+	{
+		static const int operands = 1;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &, const T a) { y = y + a * x1; }
+	};
+
+	template <> struct Operator<Operation::MultAdd>
+	{
+		static const int operands = 2;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &x2, const T) { y = y + x1 * x2; }
+	};
+
+	template <> struct Operator<Operation::MultAddScalarProduct>
+	{
+		static const int operands = 2;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &x2, const T a) { y = y + a * x1 * x2; }
+	};
+
+	template <> struct Operator<Operation::MultSubScalar>
+	{
+		static const int operands = 1;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &, const T a) { y = y - a * x1; }
+	};
+
+	template <> struct Operator<Operation::MultSub>
+	{
+		static const int operands = 2;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &x2, const T) { y = y - x1 * x2; }
+	};
+
+	template <> struct Operator<Operation::MultSubScalarProduct>
+	{
+		static const int operands = 2;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &x2, const T a) { y = y - a * x1 * x2; }
+	};
+
+	template <> struct Operator<Operation::Add>
+	{
+		static const int operands = 1;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &, const T) { y = y + x1; }
+	};
+
+	template <> struct Operator<Operation::Sub>
+	{
+		static const int operands = 1;
+		template <class U, class T> static void apply(U &y, const U &x1, const U &, const T) { y = y - x1; }
+	};
+
+	template <> struct Operator<Operation::Mult>
+	{
+		static const int operands = 0;
+		template <class U, class T> static void apply(U &y, const U &, const U &, const T a) { y = y * a; }
+	};
+
+	template <> struct Operator<Operation::Div>
+	{
+		static const int operands = 0;
+		template <class U, class T> static void apply(U &y, const U &, const U &, const T a) { y = y / a; }
+	};
+
+	/**
+	 * @brief Portable scalar implementation of an operation.
+	 *
+	 * @tparam operation Operation.
+	 * @tparam T Fundamental data type.
+	 * @param y Array which is modified.
+	 * @param x1 First array operand.
+	 * @param x2 Second array operand.
+	 * @param a Scalar operand.
+	 * @param size Number of elements.
+	 */
+	template <Operation operation, class T> void applyScalar(T *y, const T *x1, const T *x2, const T a, const int64_t size)
+	{
+		const T zero = T();
+		for (int64_t i = 0; i < size; ++i)
+		{
+			Operator<operation>::apply(y[i], (Operator<operation>::operands > 0) ? x1[i] : zero, (Operator<operation>::operands > 1) ? x2[i] : zero, a);
+		}
+	}
+
+	/**
+	 * @brief Check whether the CPU supports an instruction set.
+	 *
+	 * @param instructionSet Instruction set.
+	 * @return bool Returns true if kernels for the instruction set can be executed.
+	 */
+	bool isSupported(const InstructionSet instructionSet);
+
+	/**
+	 * @brief Retrieve the widest supported instruction set, which is used by SimdKernels::apply().
+	 *
+	 * @return InstructionSet Instruction set.
+	 */
+	InstructionSet instructionSet();
+
+	/**
+	 * @brief Retrieve the name of an instruction set.
+	 *
+	 * @param instructionSet Instruction set.
+	 * @return const char* Name of the instruction set.
+	 */
+	const char *name(const InstructionSet instructionSet);
+
+	/**
+	 * @brief Retrieve the single precision kernel of an operation for a specific instruction set. The instruction set must be supported.
+	 *
+	 * @param operation Operation.
+	 * @param instructionSet Instruction set.
+	 * @return Kernel Kernel.
+	 */
+	Kernel kernel(const Operation operation, const InstructionSet instructionSet);
+
+	/**
+	 * @brief Retrieve the single precision kernels of all operations for the widest supported instruction set.
+	 *
+	 * @return const Kernel* List of kernels, indexed by operation.
+	 */
+	const Kernel *kernels();
+
+	/**
+	 * @brief Apply an operation using the portable scalar implementation.
+	 *
+	 * @tparam operation Operation.
+	 * @tparam T Fundamental data type.
+	 * @param y Array which is modified.
+	 * @param x1 First array operand.
+	 * @param x2 Second array operand.
+	 * @param a Scalar operand.
+	 * @param size Number of elements.
+	 */
+	template <Operation operation, class T> inline void apply(T *y, const T *x1, const T *x2, const T a, const int64_t size)
+	{
+		applyScalar<operation, T>(y, x1, x2, a, size);
+	}
+
+	/**
+	 * @brief Apply an operation to single precision arrays using the widest supported instruction set.
+	 *
+	 * @tparam operation Operation.
+	 * @param y Array which is modified.
+	 * @param x1 First array operand.
+	 * @param x2 Second array operand.
+	 * @param a Scalar operand.
+	 * @param size Number of elements.
+	 */
+	template <Operation operation> inline void apply(float *y, const float *x1, const float *x2, const float a, const int64_t size)
+	{
+		static const Kernel *activeKernels = kernels();
+		activeKernels[static_cast<int>(operation)](y, x1, x2, a, size);
+	}
+
+	/**
+	 * @brief Allocate memory which is aligned to SimdKernels::alignment bytes.
+	 *
+	 * @param size Number of bytes.
+	 * @return void* Pointer to the allocated memory. Must be released via SimdKernels::deallocate().
+	 */
+	void *allocate(const size_t size);
+
+	/**
+	 * @brief Release memory which has been allocated via SimdKernels::allocate().
+	 *
+	 * @param memory Pointer to the memory.
+	 */
+	void deallocate(void *memory);
+}
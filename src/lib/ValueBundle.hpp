@@ -8,6 +8,151 @@
 
 #pragma once
 #include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include "lib/SimdKernels.hpp"
+#include "lib/ScratchArena.hpp"
+
+template <class T> struct ValueBundle;
+
+/**
+ * @brief Expression templates for ValueBundle arithmetic. 
+ * @details Arithmetic expressions of ValueBundles and scalars, such as a * b + 0.5f * c * d - e, are not evaluated immediately but captured as lightweight expression objects. 
+ * They are evaluated elementwise in a single loop upon compound assignment to a ValueBundle via ValueBundle::operator+=() or ValueBundle::operator-=(), 
+ * such that a chain of terms requires a single pass over memory instead of one pass per term. 
+ * 
+ * Chains of sums and differences are accumulated term by term from left to right, i.e. r += a * b - 0.5f * c * d is evaluated exactly like r.multAdd(a, b); r.multSub(0.5f, c, d); 
+ */
+namespace ValueBundleExpression
+{
+	/**
+	 * @brief Base class of all expression objects. 
+	 */
+	struct Expression {};
+
+	/**
+	 * @brief Scalar operand. 
+	 * 
+	 * @tparam T Fundamental data type. 
+	 */
+	template <class T> struct Scalar : public Expression
+	{
+		typedef T ValueType;
+		Scalar(const T value) : value(value) {}
+		T operator[](const int64_t) const { return value; }
+		T value; ///< Scalar value. 
+	};
+
+	/**
+	 * @brief ValueBundle operand. 
+	 * 
+	 * @tparam T Fundamental data type. 
+	 */
+	template <class T> struct Bundle : public Expression
+	{
+		typedef T ValueType;
+		Bundle(const ValueBundle<T> &bundle) : data(bundle.data()) {}
+		T operator[](const int64_t i) const { return data[i]; }
+		const T *data; ///< Data of the ValueBundle. 
+	};
+
+	/**
+	 * @brief Elementwise product of two expressions. 
+	 */
+	template <class L, class R> struct Product : public Expression
+	{
+		typedef typename L::ValueType ValueType;
+		Product(const L &lhs, const R &rhs) : lhs(lhs), rhs(rhs) {}
+		ValueType operator[](const int64_t i) const { return lhs[i] * rhs[i]; }
+		L lhs; ///< Left operand. 
+		R rhs; ///< Right operand. 
+	};
+
+	/**
+	 * @brief Elementwise sum of two expressions. 
+	 */
+	template <class L, class R> struct Sum : public Expression
+	{
+		typedef typename L::ValueType ValueType;
+		Sum(const L &lhs, const R &rhs) : lhs(lhs), rhs(rhs) {}
+		ValueType operator[](const int64_t i) const { return lhs[i] + rhs[i]; }
+		L lhs; ///< Left operand. 
+		R rhs; ///< Right operand. 
+	};
+
+	/**
+	 * @brief Elementwise difference of two expressions. 
+	 */
+	template <class L, class R> struct Difference : public Expression
+	{
+		typedef typename L::ValueType ValueType;
+		Difference(const L &lhs, const R &rhs) : lhs(lhs), rhs(rhs) {}
+		ValueType operator[](const int64_t i) const { return lhs[i] - rhs[i]; }
+		L lhs; ///< Left operand. 
+		R rhs; ///< Right operand. 
+	};
+
+	/**
+	 * @brief Elementwise negation of an expression. 
+	 */
+	template <class E> struct Negation : public Expression
+	{
+		typedef typename E::ValueType ValueType;
+		Negation(const E &operand) : operand(operand) {}
+		ValueType operator[](const int64_t i) const { return -operand[i]; }
+		E operand; ///< Operand. 
+	};
+
+	/**
+	 * @brief Map an operand, i.e. a ValueBundle or an expression, to its expression type. 
+	 */
+	template <class X, class Enable = void> struct Term {};
+
+	template <class X> struct Term<X, typename std::enable_if<std::is_base_of<Expression, X>::value>::type>
+	{
+		typedef X Type;
+		typedef typename X::ValueType ValueType;
+		static const X &get(const X &x) { return x; }
+	};
+
+	template <class T> struct Term<ValueBundle<T>, void>
+	{
+		typedef Bundle<T> Type;
+		typedef T ValueType;
+		static Bundle<T> get(const ValueBundle<T> &x) { return Bundle<T>(x); }
+	};
+
+	/**
+	 * @brief Check whether a type is a valid operand, i.e. a ValueBundle or an expression. 
+	 */
+	template <class X> struct IsOperand : public std::is_base_of<Expression, X> {};
+
+	template <class T> struct IsOperand<ValueBundle<T>> : public std::true_type {};
+
+	/**
+	 * @brief Accumulate the value of an expression at element i onto a value. Sums and differences are accumulated term by term from left to right. 
+	 * 
+	 * @tparam sign Accumulate with positive (1) or negative (-1) sign. 
+	 * @param value Value to accumulate onto. 
+	 * @param expression Expression. 
+	 * @param i Element number. 
+	 * @return ValueType Accumulated value. 
+	 */
+	template <int sign, class E> typename E::ValueType accumulate(const typename E::ValueType value, const E &expression, const int64_t i)
+	{
+		return (sign > 0) ? value + expression[i] : value - expression[i];
+	}
+
+	template <int sign, class L, class R> typename L::ValueType accumulate(const typename L::ValueType value, const Sum<L, R> &expression, const int64_t i)
+	{
+		return accumulate<sign>(accumulate<sign>(value, expression.lhs, i), expression.rhs, i);
+	}
+
+	template <int sign, class L, class R> typename L::ValueType accumulate(const typename L::ValueType value, const Difference<L, R> &expression, const int64_t i)
+	{
+		return accumulate<-sign>(accumulate<sign>(value, expression.lhs, i), expression.rhs, i);
+	}
+}
 
 /**
  * @brief Value array implementation. The object does not hold ownership of its memory. 
@@ -28,7 +173,7 @@ public:
 	 * @param data Storage memory, size should at least be size * sizeof(T). Memory is not deleted on destruction of the ValueBundle.
 	 * @param size Number of elemenets in the ValueBundle. 
 	 */
-	ValueBundle(T *data, const int size) : _data(data), _size(size) {}
+	ValueBundle(T *data, const int64_t size) : _data(data), _size(size) {}
 	
 	/**
 	 * @brief Assignment operator. 
@@ -49,7 +194,7 @@ public:
 	 * @param n Element number. 
 	 * @return T& Reference to nth element.
 	 */
-	T &operator[](const int n)
+	T &operator[](const int64_t n)
 	{
 		return _data[n];
 	}
@@ -57,9 +202,9 @@ public:
 	/**
 	 * @brief Retrieve the number of elements in the value bundle. 
 	 * 
-	 * @return int Number of elements in the value bundle.
+	 * @return int64_t Number of elements in the value bundle.
 	 */
-	int size() const
+	int64_t size() const
 	{
 		return _size;
 	}
@@ -83,7 +228,7 @@ public:
 	 */
 	ValueBundle &multAdd(const T &rhs1, const ValueBundle<T> &rhs2)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] += rhs1 * rhs2._data[i];
+		SimdKernels::apply<SimdKernels::Operation::MultAddScalar>(_data, rhs2._data, static_cast<const T *>(nullptr), rhs1, _size);
 		return *this;
 	}
 
@@ -108,7 +253,7 @@ public:
 	 */
 	ValueBundle &multAdd(const ValueBundle<T> &rhs1, const ValueBundle<T> &rhs2)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] += rhs1._data[i] * rhs2._data[i];
+		SimdKernels::apply<SimdKernels::Operation::MultAdd>(_data, rhs1._data, rhs2._data, T(), _size);
 		return *this;
 	}
 
@@ -122,7 +267,7 @@ public:
 	 */
 	ValueBundle &multAdd(const T &rhs1, const ValueBundle<T> &rhs2, const ValueBundle<T> &rhs3)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] += rhs1 * rhs2._data[i] * rhs3._data[i];
+		SimdKernels::apply<SimdKernels::Operation::MultAddScalarProduct>(_data, rhs2._data, rhs3._data, rhs1, _size);
 		return *this;
 	}
 
@@ -135,7 +280,7 @@ public:
 	 */
 	ValueBundle &multSub(const T &rhs1, const ValueBundle<T> &rhs2)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] -= rhs1 * rhs2._data[i];
+		SimdKernels::apply<SimdKernels::Operation::MultSubScalar>(_data, rhs2._data, static_cast<const T *>(nullptr), rhs1, _size);
 		return *this;
 	}
 
@@ -160,7 +305,7 @@ public:
 	 */
 	ValueBundle &multSub(const ValueBundle<T> &rhs1, const ValueBundle<T> &rhs2)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] -= rhs1._data[i] * rhs2._data[i];
+		SimdKernels::apply<SimdKernels::Operation::MultSub>(_data, rhs1._data, rhs2._data, T(), _size);
 		return *this;
 	}
 
@@ -174,7 +319,7 @@ public:
 	 */
 	ValueBundle &multSub(const T &rhs1, const ValueBundle<T> &rhs2, const ValueBundle<T> &rhs3)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] -= rhs1 * rhs2._data[i] * rhs3._data[i];
+		SimdKernels::apply<SimdKernels::Operation::MultSubScalarProduct>(_data, rhs2._data, rhs3._data, rhs1, _size);
 		return *this;
 	}
 
@@ -186,7 +331,7 @@ public:
 	 */
 	ValueBundle &operator+=(const ValueBundle &rhs)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] += rhs._data[i];
+		SimdKernels::apply<SimdKernels::Operation::Add>(_data, rhs._data, static_cast<const T *>(nullptr), T(), _size);
 		return *this;
 	}
 
@@ -198,7 +343,7 @@ public:
 	 */
 	ValueBundle &operator-=(const ValueBundle &rhs)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] -= rhs._data[i];
+		SimdKernels::apply<SimdKernels::Operation::Sub>(_data, rhs._data, static_cast<const T *>(nullptr), T(), _size);
 		return *this;
 	}
 
@@ -210,7 +355,7 @@ public:
 	 */
 	ValueBundle &operator*=(const T &rhs)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] *= rhs;
+		SimdKernels::apply<SimdKernels::Operation::Mult>(_data, static_cast<const T *>(nullptr), static_cast<const T *>(nullptr), rhs, _size);
 		return *this;
 	}
 
@@ -222,15 +367,111 @@ public:
 	 */
 	ValueBundle &operator/=(const T &rhs)
 	{
-		for (int i = 0; i < _size; ++i) _data[i] /= rhs;
+		SimdKernels::apply<SimdKernels::Operation::Div>(_data, static_cast<const T *>(nullptr), static_cast<const T *>(nullptr), rhs, _size);
+		return *this;
+	}
+
+	/**
+	 * @brief Addition assignment of an expression, which is evaluated elementwise in a single pass. 
+	 * Sums and differences in the expression are accumulated term by term from left to right, i.e. operator+=(a * b - c * d) is equivalent to multAdd(a, b) followed by multSub(c, d). 
+	 * 
+	 * @tparam E Expression type. 
+	 * @param rhs Right hand side expression. 
+	 * @return ValueBundle& Reference to self. 
+	 */
+	template <class E> typename std::enable_if<std::is_base_of<ValueBundleExpression::Expression, E>::value, ValueBundle &>::type operator+=(const E &rhs)
+	{
+		_evaluate<1>(rhs);
+		return *this;
+	}
+
+	/**
+	 * @brief Subtraction assignment of an expression, which is evaluated elementwise in a single pass. 
+	 * Sums and differences in the expression are accumulated term by term from left to right, i.e. operator-=(a * b - c * d) is equivalent to multSub(a, b) followed by multAdd(c, d). 
+	 * 
+	 * @tparam E Expression type. 
+	 * @param rhs Right hand side expression. 
+	 * @return ValueBundle& Reference to self. 
+	 */
+	template <class E> typename std::enable_if<std::is_base_of<ValueBundleExpression::Expression, E>::value, ValueBundle &>::type operator-=(const E &rhs)
+	{
+		_evaluate<-1>(rhs);
 		return *this;
 	}
 
 private:
+	/**
+	 * @brief Accumulate an expression elementwise. 
+	 * 
+	 * @tparam sign Accumulate with positive (1) or negative (-1) sign. 
+	 * @tparam E Expression type. 
+	 * @param expression Expression. 
+	 */
+	template <int sign, class E> void _evaluate(const E &expression)
+	{
+		//elements are only accessed at the same index, such that the loop carries no dependencies even if operands alias
+		#if defined(__clang__)
+		#pragma clang loop vectorize(assume_safety)
+		#elif defined(__GNUC__)
+		#pragma GCC ivdep
+		#endif
+		for (int64_t i = 0; i < _size; ++i) _data[i] = ValueBundleExpression::accumulate<sign>(_data[i], expression, i);
+	}
+
 	T *_data; ///< Internal data storage. Memory is not owned by the ValueBundle. 
-	int _size; ///< Number of elements in the ValueBundle. 
+	int64_t _size; ///< Number of elements in the ValueBundle. 
 };
 
+/**
+ * @brief Elementwise product of two ValueBundles or expressions. 
+ */
+template <class L, class R> typename std::enable_if<ValueBundleExpression::IsOperand<L>::value && ValueBundleExpression::IsOperand<R>::value, ValueBundleExpression::Product<typename ValueBundleExpression::Term<L>::Type, typename ValueBundleExpression::Term<R>::Type>>::type operator*(const L &lhs, const R &rhs)
+{
+	return ValueBundleExpression::Product<typename ValueBundleExpression::Term<L>::Type, typename ValueBundleExpression::Term<R>::Type>(ValueBundleExpression::Term<L>::get(lhs), ValueBundleExpression::Term<R>::get(rhs));
+}
+
+/**
+ * @brief Product of a scalar and a ValueBundle or expression. 
+ */
+template <class R> typename std::enable_if<ValueBundleExpression::IsOperand<R>::value, ValueBundleExpression::Product<ValueBundleExpression::Scalar<typename ValueBundleExpression::Term<R>::ValueType>, typename ValueBundleExpression::Term<R>::Type>>::type operator*(const typename ValueBundleExpression::Term<R>::ValueType lhs, const R &rhs)
+{
+	typedef ValueBundleExpression::Scalar<typename ValueBundleExpression::Term<R>::ValueType> ScalarType;
+	return ValueBundleExpression::Product<ScalarType, typename ValueBundleExpression::Term<R>::Type>(ScalarType(lhs), ValueBundleExpression::Term<R>::get(rhs));
+}
+
+/**
+ * @brief Product of a ValueBundle or expression and a scalar. 
+ */
+template <class L> typename std::enable_if<ValueBundleExpression::IsOperand<L>::value, ValueBundleExpression::Product<typename ValueBundleExpression::Term<L>::Type, ValueBundleExpression::Scalar<typename ValueBundleExpression::Term<L>::ValueType>>>::type operator*(const L &lhs, const typename ValueBundleExpression::Term<L>::ValueType rhs)
+{
+	typedef ValueBundleExpression::Scalar<typename ValueBundleExpression::Term<L>::ValueType> ScalarType;
+	return ValueBundleExpression::Product<typename ValueBundleExpression::Term<L>::Type, ScalarType>(ValueBundleExpression::Term<L>::get(lhs), ScalarType(rhs));
+}
+
+/**
+ * @brief Elementwise sum of two ValueBundles or expressions. 
+ */
+template <class L, class R> typename std::enable_if<ValueBundleExpression::IsOperand<L>::value && ValueBundleExpression::IsOperand<R>::value, ValueBundleExpression::Sum<typename ValueBundleExpression::Term<L>::Type, typename ValueBundleExpression::Term<R>::Type>>::type operator+(const L &lhs, const R &rhs)
+{
+	return ValueBundleExpression::Sum<typename ValueBundleExpression::Term<L>::Type, typename ValueBundleExpression::Term<R>::Type>(ValueBundleExpression::Term<L>::get(lhs), ValueBundleExpression::Term<R>::get(rhs));
+}
+
+/**
+ * @brief Elementwise difference of two ValueBundles or expressions. 
+ */
+template <class L, class R> typename std::enable_if<ValueBundleExpression::IsOperand<L>::value && ValueBundleExpression::IsOperand<R>::value, ValueBundleExpression::Difference<typename ValueBundleExpression::Term<L>::Type, typename ValueBundleExpression::Term<R>::Type>>::type operator-(const L &lhs, const R &rhs)
+{
+	return ValueBundleExpression::Difference<typename ValueBundleExpression::Term<L>::Type, typename ValueBundleExpression::Term<R>::Type>(ValueBundleExpression::Term<L>::get(lhs), ValueBundleExpression::Term<R>::get(rhs));
+}
+
+/**
+ * @brief Elementwise negation of a ValueBundle or expression. 
+ */
+template <class E> typename std::enable_if<ValueBundleExpression::IsOperand<E>::value, ValueBundleExpression::Negation<typename ValueBundleExpression::Term<E>::Type>>::type operator-(const E &operand)
+{
+	return ValueBundleExpression::Negation<typename ValueBundleExpression::Term<E>::Type>(ValueBundleExpression::Term<E>::get(operand));
+}
+
 /**
  * @brief Collection of ValueBundles. 
  * 
@@ -242,12 +483,26 @@ template <class T, int n> struct ValueSuperbundle
 public:
 	/**
 	 * @brief Construct a new ValueSuperbundle object and allocate ValueBundles. 
+	 * The memory of each ValueBundle is aligned to SimdKernels::alignment bytes. 
+	 * 
+	 * @param bundleSize Number of elements in each ValueBundle. 
+	 */
+	ValueSuperbundle(const int64_t bundleSize) : hasOwnership(true)
+	{
+		for (int i = 0; i < n; ++i) bundles[i] = ValueBundle<T>(static_cast<T *>(SimdKernels::allocate(bundleSize * sizeof(T))), bundleSize);
+		reset();
+	}
+
+	/**
+	 * @brief Construct a new ValueSuperbundle object and allocate ValueBundles from a scratch arena. 
+	 * The ValueSuperbundle does not have ownership of the memory, which remains valid until the enclosing ScratchArena::Scope is destroyed. 
 	 * 
 	 * @param bundleSize Number of elements in each ValueBundle. 
+	 * @param arena Scratch arena. 
 	 */
-	ValueSuperbundle(const int bundleSize) : hasOwnership(true)
+	ValueSuperbundle(const int64_t bundleSize, ScratchArena &arena) : hasOwnership(false)
 	{
-		for (int i = 0; i < n; ++i) bundles[i] = ValueBundle<T>(new T[bundleSize], bundleSize);
+		for (int i = 0; i < n; ++i) bundles[i] = ValueBundle<T>(static_cast<T *>(arena.allocate(bundleSize * sizeof(T))), bundleSize);
 		reset();
 	}
 
@@ -268,7 +523,7 @@ public:
 	{
 		if (hasOwnership)
 		{
-			for (int i = 0; i < n; ++i) delete[] bundles[i].data();
+			for (int i = 0; i < n; ++i) SimdKernels::deallocate(bundles[i].data());
 		}
 	}
 
@@ -7,7 +7,9 @@ int main(int argc, char **argv)
 {
 	//init MPI Ѿ"#define DISABLE_MPI"
 	#ifndef DISABLE_MPI
-	int status = MPI_Init(&argc, &argv);
+	//֧߳,ԱֲʽԴӶ̶߳ȡԶ;ʵṩּ֧ MPI_Query_thread() ѯ
+	int threadSupport;
+	int status = MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &threadSupport);
 	if (status != MPI_SUCCESS) throw Exception(Exception::Type::MpiError, status);//MPIʼʧ׳쳣
 	int rank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
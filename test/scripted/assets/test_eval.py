@@ -2,13 +2,18 @@ import sys
 import h5py
 import numpy as np
 
-len(sys.argv) < 2 and sys.exit("Usage: test_eval.py FILE|OBJECT file1 [object1] file2 [object2]")
+len(sys.argv) < 2 and sys.exit("Usage: test_eval.py FILE|OBJECT file1 [object1] file2 [object2] [tolerance]")
 if sys.argv[1] == "FILE":
-    len(sys.argv) == 4 or sys.exit("Usage: test_eval.py FILE file1 file2")
+    len(sys.argv) in (4, 5) or sys.exit("Usage: test_eval.py FILE file1 file2 [tolerance]")
 elif sys.argv[1] == "OBJECT":
-    len(sys.argv) == 6 or sys.exit("Usage: test_eval.py OBJECT file1 object1 file2 object2")
+    len(sys.argv) in (6, 7) or sys.exit("Usage: test_eval.py OBJECT file1 object1 file2 object2 [tolerance]")
 else:
-    sys.exit("Usage: test_eval.py FILE|OBJECT file1 [object1] file2 [object2]")
+    sys.exit("Usage: test_eval.py FILE|OBJECT file1 [object1] file2 [object2] [tolerance]")
+
+#optional absolute tolerance of the comparison
+tolerance = 1e-5
+if len(sys.argv) in (5, 7):
+    tolerance = float(sys.argv[-1])
 
 #define recursive comparison of HDF5 elements
 def compare(obj1, obj2, tolerance = 1e-5):
@@ -22,7 +27,7 @@ def compare(obj1, obj2, tolerance = 1e-5):
         #compare members
         len(obj1) == len(obj2) or sys.exit("Number of datasets differs in object %s" % obj1.name)
         for k in obj1.keys():
-            compare(obj1[k], obj2[k])
+            compare(obj1[k], obj2[k], tolerance)
     elif isinstance(obj1, h5py.Dataset):
         #compare dataset
         eps = np.max(np.abs(obj1[:]-obj2[:]))
@@ -31,12 +36,12 @@ def compare(obj1, obj2, tolerance = 1e-5):
 #run comparisons
 if sys.argv[1] == "FILE":
     with h5py.File(sys.argv[2],"r") as f1, h5py.File(sys.argv[3],"r") as f2:
-        compare(f1, f2)
+        compare(f1, f2, tolerance)
 elif sys.argv[1] == "OBJECT":
     with h5py.File(sys.argv[2],"r") as f1, h5py.File(sys.argv[4],"r") as f2:
         d1 = f1[sys.argv[3]]
         d2 = f2[sys.argv[5]]
-        compare(d1,d2)
+        compare(d1,d2,tolerance)
 
 #success
 sys.exit(0)
\ No newline at end of file
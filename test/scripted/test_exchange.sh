@@ -0,0 +1,71 @@
+#!/usr/bin/env bash
+TEST_NAME=test_exchange
+
+#before running this script, set the following environment variables:
+# TEST_WORK_DIR [working directory to generate temporary output files]
+[ -z "${TEST_WORK_DIR}" ] && { echo "environment variable TEST_WORK_DIR not defined"; exit 1; }
+# TEST_SCRIPT_DIR [directory where test scripts are stored]
+[ -z "${TEST_SCRIPT_DIR}" ] && { echo "environment variable TEST_SCRIPT_DIR not defined"; exit 1; }
+# TEST_EXECUTABLE [path to the executable to generate output]
+[ -z "${TEST_EXECUTABLE}" ] && { echo "environment variable TEST_EXECUTABLE not defined"; exit 1; }
+
+#init variables
+TEST_EVAL="python ${TEST_SCRIPT_DIR}/assets/test_eval.py"
+
+#write task file; arguments are core, site exchange evaluation, lattice, model and model parameters
+function writeTask {
+    cat > ${TEST_WORK_DIR}/${TEST_NAME}.$1.$2.xml <<- EOM
+<?xml version="1.0" encoding="utf-8"?>
+<task>
+    <parameters>
+        <frequency discretization="exponential">
+            <min>0.005</min>
+            <max>50</max>
+            <count>10</count>
+        </frequency>
+        <cutoff discretization="exponential">
+            <max>50</max>
+            <min>0.3</min>
+            <step>0.9</step>
+        </cutoff>
+        <lattice name="$3" range="3"/>
+        <model name="$4" symmetry="$1">
+            $5
+            <exchange>$2</exchange>
+        </model>
+    </parameters>
+    <measurements>
+        <measurement name="correlation" />
+    </measurements>
+</task>
+EOM
+}
+
+function cleanup {
+    for CORE in SU2 XYZ TRI ; do
+        for MODE in gather copy ; do 
+            for EXT in xml obs ldf checkpoint data ; do
+                rm -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.${EXT}
+            done
+        done
+    done
+}
+
+#the contiguous site-exchanged vertex copy reproduces the gathered vertex access, including spin permutations of the Kitaev models
+for MODE in gather copy ; do
+    writeTask SU2 ${MODE} square square-heisenberg "<j>1.0</j>"
+    writeTask XYZ ${MODE} honeycomb honeycomb-kitaev "<j>0.2</j><k>1.0</k>"
+    writeTask TRI ${MODE} honeycomb honeycomb-kitaev-gamma "<j>0.2</j><k>1.0</k><g>-0.1</g>"
+    for CORE in SU2 XYZ TRI ; do
+        ${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.xml
+    done
+done
+
+#evaluate test
+trap 'cleanup ; exit 1' ERR
+for CORE in SU2 XYZ TRI ; do 
+    ${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.gather.obs ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.copy.obs
+done
+
+#cleanup
+cleanup
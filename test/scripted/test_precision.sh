@@ -0,0 +1,92 @@
+#!/usr/bin/env bash
+TEST_NAME=test_precision
+
+#before running this script, set the following environment variables:
+# TEST_WORK_DIR [working directory to generate temporary output files]
+[ -z "${TEST_WORK_DIR}" ] && { echo "environment variable TEST_WORK_DIR not defined"; exit 1; }
+# TEST_SCRIPT_DIR [directory where test scripts are stored]
+[ -z "${TEST_SCRIPT_DIR}" ] && { echo "environment variable TEST_SCRIPT_DIR not defined"; exit 1; }
+# TEST_EXECUTABLE [path to the executable to generate output]
+[ -z "${TEST_EXECUTABLE}" ] && { echo "environment variable TEST_EXECUTABLE not defined"; exit 1; }
+
+#init variables
+TEST_EVAL="python ${TEST_SCRIPT_DIR}/assets/test_eval.py"
+
+#write task file; arguments are core, mode, storage precision, minimal cutoff, calculation status and optionally the tolerance of an adaptive cutoff discretization
+function writeTask {
+    if [ -z "$6" ] ; then CUTOFF_DISCRETIZATION="exponential" ; CUTOFF_TOLERANCE="" ; else CUTOFF_DISCRETIZATION="adaptive" ; CUTOFF_TOLERANCE="<tolerance>$6</tolerance>" ; fi
+    cat > ${TEST_WORK_DIR}/${TEST_NAME}.$1.$2.xml <<- EOM
+<?xml version="1.0" encoding="utf-8"?>
+<task>
+    <parameters>
+        <frequency discretization="exponential">
+            <min>0.005</min>
+            <max>50</max>
+            <count>10</count>
+        </frequency>
+        <cutoff discretization="${CUTOFF_DISCRETIZATION}">
+            <max>50</max>
+            <min>$4</min>
+            <step>0.9</step>
+            ${CUTOFF_TOLERANCE}
+        </cutoff>
+        <lattice name="square" range="2"/>
+        <model name="square-heisenberg" symmetry="$1">
+            <j>1.0</j>
+            <precision>$3</precision>
+        </model>
+    </parameters>
+    <measurements>
+        <measurement name="correlation" />
+    </measurements>
+    $5
+</task>
+EOM
+}
+
+function cleanup {
+    for CORE in SU2 XYZ TRI ; do
+        for MODE in CHKPNT NOCHKPNT FP16 FP32 ADAPTIVEFP16 ADAPTIVEBF16 ADAPTIVEFP32 ; do 
+            for EXT in xml obs ldf checkpoint data ; do
+                rm -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.${EXT}
+            done
+        done
+    done
+}
+
+#reduced precision vertices are stored losslessly in the checkpoint, such that resumed calculations are reproduced exactly
+for CORE in SU2 XYZ TRI ; do 
+    writeTask ${CORE} CHKPNT bf16 0.5 ""
+    writeTask ${CORE} NOCHKPNT bf16 0.3 ""
+    for MODE in CHKPNT NOCHKPNT ; do 
+        ${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.xml
+    done
+    writeTask ${CORE} CHKPNT bf16 0.3 '<calculation status="running" startTime="1970-Jan-01 00:00:00" checkpointTime="1970-Jan-01 00:00:00" />'
+    ${TEST_EXECUTABLE} ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.CHKPNT.xml
+done
+
+#half precision vertices deviate from single precision vertices by the accumulated rounding error
+writeTask SU2 FP16 fp16 0.3 ""
+writeTask SU2 FP32 fp32 0.3 ""
+for MODE in FP16 FP32 ; do 
+    ${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.SU2.${MODE}.xml
+done
+
+#the adaptive integrator reads compactly stored vertices in its error estimate
+writeTask SU2 ADAPTIVEFP16 fp16 0.3 "" 1e-2
+writeTask SU2 ADAPTIVEBF16 bf16 0.3 "" 1e-2
+writeTask SU2 ADAPTIVEFP32 fp32 0.3 "" 1e-2
+for MODE in ADAPTIVEFP16 ADAPTIVEBF16 ADAPTIVEFP32 ; do 
+    ${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.SU2.${MODE}.xml || { cleanup ; exit 1 ; }
+done
+
+#evaluate test
+trap 'cleanup ; exit 1' ERR
+for CORE in SU2 XYZ TRI ; do 
+    ${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.CHKPNT.obs ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.NOCHKPNT.obs
+done
+${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.SU2.FP16.obs ${TEST_WORK_DIR}/${TEST_NAME}.SU2.FP32.obs 0.01
+${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.SU2.ADAPTIVEFP16.obs ${TEST_WORK_DIR}/${TEST_NAME}.SU2.ADAPTIVEFP32.obs 0.01
+
+#cleanup
+cleanup
@@ -0,0 +1,79 @@
+#!/usr/bin/env bash
+TEST_NAME=test_refinement
+
+#before running this script, set the following environment variables:
+# TEST_WORK_DIR [working directory to generate temporary output files]
+[ -z "${TEST_WORK_DIR}" ] && { echo "environment variable TEST_WORK_DIR not defined"; exit 1; }
+# TEST_SCRIPT_DIR [directory where test scripts are stored]
+[ -z "${TEST_SCRIPT_DIR}" ] && { echo "environment variable TEST_SCRIPT_DIR not defined"; exit 1; }
+# TEST_EXECUTABLE [path to the executable to generate output]
+[ -z "${TEST_EXECUTABLE}" ] && { echo "environment variable TEST_EXECUTABLE not defined"; exit 1; }
+
+#init variables
+TEST_EVAL="python ${TEST_SCRIPT_DIR}/assets/test_eval.py"
+
+#write task files; the coarse pass of mode SAME uses the full grids, such that regridding is exact
+#the coarse pass of mode COARSE uses reduced grids, and the fine calculation starts well before the breakdown, such that it approximates the full calculation
+for CORE in SU2 XYZ TRI ; do 
+    for MODE in NOREFINE SAME COARSE ; do 
+        if [ ${MODE} == SAME ] ; then
+            REFINEMENT='<refinement frequency="10" cutoff="1" window="1.2"/>'
+        elif [ ${MODE} == COARSE ] ; then
+            REFINEMENT='<refinement frequency="8" cutoff="2" window="2.0"/>'
+        else
+            REFINEMENT=''
+        fi
+        cat > ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.xml <<- EOM
+<?xml version="1.0" encoding="utf-8"?>
+<task>
+    <parameters>
+        <frequency discretization="exponential">
+            <min>0.005</min>
+            <max>50</max>
+            <count>10</count>
+        </frequency>
+        <cutoff discretization="exponential">
+            <max>50</max>
+            <min>0.2</min>
+            <step>0.9</step>
+        </cutoff>
+        <lattice name="square" range="2"/>
+        <model name="square-heisenberg" symmetry="${CORE}">
+            <j>1.0</j>
+        </model>
+        ${REFINEMENT}
+    </parameters>
+    <measurements>
+        <measurement name="correlation" maxCutoff="0.4" />
+    </measurements>
+</task>
+EOM
+    done
+done
+
+function cleanup {
+    for CORE in SU2 XYZ TRI ; do
+        for MODE in NOREFINE SAME COARSE ; do 
+            for EXT in xml obs ldf checkpoint data ; do
+                rm -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.${EXT}
+            done
+        done
+    done
+}
+
+#run executable
+for CORE in SU2 XYZ TRI ; do 
+    for MODE in NOREFINE SAME COARSE ; do 
+        ${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.xml
+    done
+done
+
+#evaluate test
+trap 'cleanup ; exit 1' ERR
+for CORE in SU2 XYZ TRI ; do 
+    ${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.SAME.obs ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.NOREFINE.obs
+    ${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.COARSE.obs ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.NOREFINE.obs 0.15
+done
+
+#cleanup
+cleanup
@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+TEST_NAME=test_regrid
+
+#before running this script, set the following environment variables:
+# TEST_WORK_DIR [working directory to generate temporary output files]
+[ -z "${TEST_WORK_DIR}" ] && { echo "environment variable TEST_WORK_DIR not defined"; exit 1; }
+# TEST_SCRIPT_DIR [directory where test scripts are stored]
+[ -z "${TEST_SCRIPT_DIR}" ] && { echo "environment variable TEST_SCRIPT_DIR not defined"; exit 1; }
+# TEST_EXECUTABLE [path to the executable to generate output]
+[ -z "${TEST_EXECUTABLE}" ] && { echo "environment variable TEST_EXECUTABLE not defined"; exit 1; }
+
+#init variables
+TEST_EVAL="python ${TEST_SCRIPT_DIR}/assets/test_eval.py"
+MESH_FINE="0.31812 0.36329 0.41812 0.46329 0.51334 0.56880 0.63024 0.69833 0.77378 0.85737 0.95 1.0 3.0 10.0"
+MESH_COARSE="0.31812 0.41812 0.51334 0.63024 0.77378 0.95 3.0 10.0"
+
+#write task file; arguments are core, mode, frequency mesh, minimal cutoff and calculation status
+function writeTask {
+    VALUES=""
+    for VALUE in $3 ; do
+        VALUES="${VALUES}<value>${VALUE}</value>"
+    done
+    cat > ${TEST_WORK_DIR}/${TEST_NAME}.$1.$2.xml <<- EOM
+<?xml version="1.0" encoding="utf-8"?>
+<task>
+    <parameters>
+        <frequency discretization="manual">${VALUES}</frequency>
+        <cutoff discretization="exponential">
+            <max>10</max>
+            <min>$4</min>
+            <step>0.9</step>
+        </cutoff>
+        <lattice name="triangular" range="3"/>
+        <model name="triangular-heisenberg" symmetry="$1">
+            <j>1.0</j>
+        </model>
+    </parameters>
+    <measurements>
+        <measurement name="correlation" />
+    </measurements>
+    $5
+</task>
+EOM
+}
+
+function cleanup {
+    for CORE in SU2 XYZ TRI ; do
+        for MODE in REGRID NOREGRID ; do 
+            for EXT in xml obs ldf checkpoint data ; do
+                rm -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.${EXT}
+            done
+        done
+    done
+}
+
+#run the early flow on the coarse mesh and the reference on the fine mesh
+for CORE in SU2 XYZ TRI ; do 
+    writeTask ${CORE} REGRID "${MESH_COARSE}" 0.5 ""
+    writeTask ${CORE} NOREGRID "${MESH_FINE}" 0.3 ""
+    for MODE in REGRID NOREGRID ; do 
+        ${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.${MODE}.xml
+    done
+done
+
+#resume the coarse checkpoint on the fine mesh
+for CORE in SU2 XYZ TRI ; do 
+    writeTask ${CORE} REGRID "${MESH_FINE}" 0.3 '<calculation status="running" startTime="1970-Jan-01 00:00:00" checkpointTime="1970-Jan-01 00:00:00" />'
+    ${TEST_EXECUTABLE} ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.REGRID.xml
+done
+
+#evaluate test; the interpolated flow deviates from the reference by the discretization error of the coarse mesh
+trap 'cleanup ; exit 1' ERR
+for CORE in SU2 XYZ TRI ; do 
+    ${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.REGRID.obs ${TEST_WORK_DIR}/${TEST_NAME}.${CORE}.NOREGRID.obs 0.05
+done
+
+#cleanup
+cleanup
@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+TEST_NAME=test_sharded
+
+#before running this script, set the following environment variables:
+# TEST_WORK_DIR [working directory to generate temporary output files]
+[ -z "${TEST_WORK_DIR}" ] && { echo "environment variable TEST_WORK_DIR not defined"; exit 1; }
+# TEST_SCRIPT_DIR [directory where test scripts are stored]
+[ -z "${TEST_SCRIPT_DIR}" ] && { echo "environment variable TEST_SCRIPT_DIR not defined"; exit 1; }
+# TEST_EXECUTABLE [path to the executable to generate output]
+[ -z "${TEST_EXECUTABLE}" ] && { echo "environment variable TEST_EXECUTABLE not defined"; exit 1; }
+
+# TEST_MPIEXEC_EXECUTABLE [path to the mpi wrapper]
+[ -z "${TEST_MPIEXEC_EXECUTABLE}" ] && { echo "environment variable TEST_MPIEXEC_EXECUTABLE not defined"; exit 1; }
+# TEST_MPIEXEC_NUMPROC_FLAG [path to the mpi wrapper flag to specify number of ranks]
+[ -z "${TEST_MPIEXEC_NUMPROC_FLAG}" ] && { echo "environment variable TEST_MPIEXEC_NUMPROC_FLAG not defined"; exit 1; }
+
+#init variables
+TEST_EVAL="python ${TEST_SCRIPT_DIR}/assets/test_eval.py"
+TEST_MPI_EXECUTABLE="${TEST_MPIEXEC_EXECUTABLE} ${TEST_MPIEXEC_NUMPROC_FLAG} 2 ${TEST_EXECUTABLE}"
+
+#write task file; arguments are mode, vertex distribution, minimal cutoff and calculation status
+function writeTask {
+    cat > ${TEST_WORK_DIR}/${TEST_NAME}.$1.xml <<- EOM
+<?xml version="1.0" encoding="utf-8"?>
+<task>
+    <parameters>
+        <frequency discretization="exponential">
+            <min>0.005</min>
+            <max>50</max>
+            <count>10</count>
+        </frequency>
+        <cutoff discretization="exponential">
+            <max>50</max>
+            <min>$3</min>
+            <step>0.9</step>
+        </cutoff>
+        <lattice name="square" range="2"/>
+        <model name="square-heisenberg" symmetry="SU2">
+            <j>1.0</j>
+            <distribution>$2</distribution>
+            <cache>16</cache>
+        </model>
+    </parameters>
+    <measurements>
+        <measurement name="correlation" />
+    </measurements>
+    $4
+</task>
+EOM
+}
+
+function cleanup {
+    for MODE in REPLICATED SHARDED CHKPNT ; do 
+        for EXT in xml obs ldf checkpoint data ; do
+            rm -f ${TEST_WORK_DIR}/${TEST_NAME}.${MODE}.${EXT}
+        done
+    done
+}
+
+#sharded vertices reproduce the replicated calculation
+writeTask REPLICATED replicated 0.3 ""
+writeTask SHARDED sharded 0.3 ""
+${TEST_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.REPLICATED.xml
+${TEST_MPI_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.SHARDED.xml
+
+#sharded checkpoints are written and read across all ranks
+writeTask CHKPNT sharded 0.5 ""
+${TEST_MPI_EXECUTABLE} -f ${TEST_WORK_DIR}/${TEST_NAME}.CHKPNT.xml
+writeTask CHKPNT sharded 0.3 '<calculation status="running" startTime="1970-Jan-01 00:00:00" checkpointTime="1970-Jan-01 00:00:00" />'
+${TEST_MPI_EXECUTABLE} ${TEST_WORK_DIR}/${TEST_NAME}.CHKPNT.xml
+
+#evaluate test
+trap 'cleanup ; exit 1' ERR
+${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.REPLICATED.obs ${TEST_WORK_DIR}/${TEST_NAME}.SHARDED.obs
+${TEST_EVAL} FILE ${TEST_WORK_DIR}/${TEST_NAME}.REPLICATED.obs ${TEST_WORK_DIR}/${TEST_NAME}.CHKPNT.obs
+
+#cleanup
+cleanup
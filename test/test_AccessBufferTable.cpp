@@ -0,0 +1,160 @@
+#define BOOST_TEST_MODULE "AccessBufferTableTest"
+#include <boost/test/included/unit_test.hpp>
+#include "AccessBufferTable.hpp"
+
+class SpinParser
+{
+public:
+	SpinParser(FrequencyDiscretization *f)
+	{
+		FrgCommon::_frequency = f;
+	}
+
+	~SpinParser()
+	{
+		delete FrgCommon::_frequency;
+	}
+};
+
+struct TestAccessBuffer
+{
+	float frequency;
+	int index;
+};
+
+struct AccessBufferTableFixture
+{
+	AccessBufferTableFixture() : calls(0)
+	{
+		Log::log << Log::setDisplayLogLevel(Log::LogLevel::None);
+		std::vector<float> values({ 0.1f, 0.3f, 1.0f, 2.0f, 5.0f });
+		spinParser = new SpinParser(new FrequencyDiscretization(values));
+
+		generator = [this](const float wp, TestAccessBuffer *ab) -> void
+		{
+			++calls;
+			for (int i = 0; i < 3; ++i)
+			{
+				ab[i].frequency = wp;
+				ab[i].index = i;
+			}
+		};
+	}
+
+	~AccessBufferTableFixture()
+	{
+		delete spinParser;
+	}
+
+	void check(const TestAccessBuffer *ab, const float wp)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			BOOST_TEST(ab[i].frequency == wp);
+			BOOST_TEST(ab[i].index == i);
+		}
+	}
+
+	SpinParser *spinParser;
+	std::function<void(float, TestAccessBuffer *)> generator;
+	int calls;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AccessBufferTableTest, AccessBufferTableFixture)
+
+BOOST_AUTO_TEST_CASE(untabulated)
+{
+	AccessBufferTable<TestAccessBuffer, 3> table;
+	TestAccessBuffer fallback[3];
+
+	const TestAccessBuffer *ab = table.get(1.0f, generator, fallback);
+	BOOST_TEST(ab == fallback);
+	check(ab, 1.0f);
+	BOOST_TEST(calls == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ascendingLookup)
+{
+	AccessBufferTable<TestAccessBuffer, 3> table;
+	TestAccessBuffer fallback[3];
+	table.generate(generator, 0.0f, 0.0f);
+	BOOST_TEST(calls == 2 * FrgCommon::frequency().size);
+
+	calls = 0;
+	for (auto w = FrgCommon::frequency().beginNegative(); w != FrgCommon::frequency().end(); ++w)
+	{
+		const TestAccessBuffer *ab = table.get(*w, generator, fallback);
+		BOOST_TEST(ab != fallback);
+		check(ab, *w);
+	}
+	BOOST_TEST(calls == 0);
+}
+
+BOOST_AUTO_TEST_CASE(arbitraryLookup)
+{
+	AccessBufferTable<TestAccessBuffer, 3> table;
+	TestAccessBuffer fallback[3];
+	table.generate(generator, 0.0f, 0.0f);
+
+	calls = 0;
+	std::vector<float> meshPoints({ 2.0f, -0.3f, 5.0f, -5.0f, 0.1f, -0.1f, 1.0f });
+	for (float w : meshPoints)
+	{
+		const TestAccessBuffer *ab = table.get(w, generator, fallback);
+		BOOST_TEST(ab != fallback);
+		check(ab, w);
+	}
+	BOOST_TEST(calls == 0);
+
+	std::vector<float> offMeshPoints({ 0.0f, 0.2f, -0.45f, 6.0f, -0.05f });
+	for (float w : offMeshPoints)
+	{
+		const TestAccessBuffer *ab = table.get(w, generator, fallback);
+		BOOST_TEST(ab == fallback);
+		check(ab, w);
+	}
+	BOOST_TEST(calls == int(offMeshPoints.size()));
+}
+
+BOOST_AUTO_TEST_CASE(integrationRange)
+{
+	AccessBufferTable<TestAccessBuffer, 3> table;
+	TestAccessBuffer fallback[3];
+
+	//only mesh points with |wp| >= 0.3 and |wp + 1.3| >= 0.3 are tabulated, i.e. all mesh points except -0.1, 0.1 and -1.0
+	table.generate(generator, 1.3f, 0.3f);
+	BOOST_TEST(calls == 2 * FrgCommon::frequency().size - 3);
+
+	calls = 0;
+	for (auto w = FrgCommon::frequency().beginNegative(); w != FrgCommon::frequency().end(); ++w)
+	{
+		const TestAccessBuffer *ab = table.get(*w, generator, fallback);
+		BOOST_TEST((ab == fallback) == (*w == -0.1f || *w == 0.1f || *w == -1.0f));
+		check(ab, *w);
+	}
+	BOOST_TEST(calls == 3);
+}
+
+BOOST_AUTO_TEST_CASE(reset)
+{
+	AccessBufferTable<TestAccessBuffer, 3> table;
+	TestAccessBuffer fallback[3];
+	table.generate(generator, 0.0f, 0.0f);
+	table.reset();
+
+	calls = 0;
+	const TestAccessBuffer *ab = table.get(1.0f, generator, fallback);
+	BOOST_TEST(ab == fallback);
+	check(ab, 1.0f);
+	BOOST_TEST(calls == 1);
+
+	//the table is reusable after a reset
+	table.generate(generator, 0.0f, 0.0f);
+	calls = 0;
+	ab = table.get(1.0f, generator, fallback);
+	BOOST_TEST(ab != fallback);
+	check(ab, 1.0f);
+	BOOST_TEST(calls == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+#define BOOST_TEST_MODULE "BreakdownMonitorTest"
+#include <boost/test/included/unit_test.hpp>
+#include <cmath>
+#include "BreakdownMonitor.hpp"
+
+BOOST_AUTO_TEST_SUITE(BreakdownMonitorTest);
+
+BOOST_AUTO_TEST_CASE(paramagnet)
+{
+	//saturating vertex norm
+	BreakdownMonitor m(10.0f, 3.0f, false);
+	for (float cutoff = 10.0f; cutoff > 0.01f; cutoff *= 0.9f) BOOST_CHECK(!m.update(cutoff, 2.0f - 1.0f / (1.0f + cutoff)));
+}
+
+BOOST_AUTO_TEST_CASE(powerLaw)
+{
+	//power-law divergence at cutoff 0.5
+	BreakdownMonitor m(10.0f, 0.0f, true);
+	BOOST_CHECK(m.terminate());
+
+	float breakdownCutoff = NAN;
+	for (float cutoff = 10.0f; cutoff > 0.5f; cutoff *= 0.98f)
+	{
+		if (m.update(cutoff, std::pow(cutoff - 0.5f, -1.5f)))
+		{
+			breakdownCutoff = cutoff;
+			break;
+		}
+	}
+	BOOST_CHECK(breakdownCutoff > 0.5f && breakdownCutoff < 1.0f);
+	BOOST_CHECK_EQUAL(m.breakdownCutoff(), breakdownCutoff);
+}
+
+BOOST_AUTO_TEST_CASE(regularizedKink)
+{
+	//vertex norm with increasing growth rate, which saturates below cutoff 1
+	BreakdownMonitor m(100.0f, 2.0f, false);
+
+	float breakdownCutoff = NAN;
+	for (float cutoff = 10.0f; cutoff > 0.1f; cutoff *= 0.95f)
+	{
+		float norm = (cutoff > 1.0f) ? std::exp(2.0f / cutoff) : std::exp(2.0f) + 0.1f * (1.0f - cutoff);
+		if (m.update(cutoff, norm))
+		{
+			breakdownCutoff = cutoff;
+			break;
+		}
+	}
+	BOOST_CHECK(breakdownCutoff < 1.0f);
+	BOOST_CHECK(m.breakdownCutoff() > 1.0f && m.breakdownCutoff() < 1.1f);
+}
+
+BOOST_AUTO_TEST_CASE(invalidSamples)
+{
+	BreakdownMonitor m(10.0f, 0.0f, false);
+	BOOST_CHECK(!m.update(1.0f, NAN));
+	BOOST_CHECK(!m.update(1.0f, 1.0f));
+	BOOST_CHECK(!m.update(0.9f, INFINITY));
+	BOOST_CHECK(std::isnan(m.growthRate()));
+	BOOST_CHECK(std::isnan(m.breakdownCutoff()));
+
+	BOOST_CHECK_THROW(BreakdownMonitor(0.0f, 0.0f, false), Exception);
+	BOOST_CHECK_THROW(BreakdownMonitor(10.0f, 0.5f, false), Exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -47,4 +47,32 @@ BOOST_AUTO_TEST_CASE(find)
 	BOOST_CHECK_EQUAL(i, c->end());
 }
 
+BOOST_AUTO_TEST_CASE(adaptive)
+{
+	BOOST_CHECK(!c->isAdaptive());
+
+	CutoffDiscretization a(10.0f, 0.5f, 0.9f, 1e-3f);
+	BOOST_CHECK(a.isAdaptive());
+	BOOST_CHECK_EQUAL(*a.begin(), 10.0f);
+	BOOST_CHECK_EQUAL(*a.last(), 0.5f);
+	BOOST_CHECK_EQUAL(a.initialStep(), 0.9f);
+	BOOST_CHECK_EQUAL(a.tolerance(), 1e-3f);
+
+	BOOST_CHECK_THROW(CutoffDiscretization(0.5f, 10.0f, 0.9f, 1e-3f), Exception);
+	BOOST_CHECK_THROW(CutoffDiscretization(10.0f, 0.5f, 1.5f, 1e-3f), Exception);
+	BOOST_CHECK_THROW(CutoffDiscretization(10.0f, 0.5f, 0.9f, 0.0f), Exception);
+}
+
+BOOST_AUTO_TEST_CASE(multistepOrder)
+{
+	BOOST_CHECK_EQUAL(c->multistepOrder(), 1);
+
+	std::vector<float> values({ 5.0, 4.0, 3.0 });
+	CutoffDiscretization m(values, 3);
+	BOOST_CHECK_EQUAL(m.multistepOrder(), 3);
+
+	BOOST_CHECK_THROW(CutoffDiscretization(values, 0), Exception);
+	BOOST_CHECK_THROW(CutoffDiscretization(values, CutoffDiscretization::maxMultistepOrder + 1), Exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
@@ -0,0 +1,126 @@
+#define BOOST_TEST_MODULE "FloatFormatTest"
+#include <cmath>
+#include <limits>
+#include <boost/test/included/unit_test.hpp>
+#include "lib/FloatFormat.hpp"
+#include "lib/FloatArray.hpp"
+
+
+BOOST_AUTO_TEST_SUITE(FloatFormatTest);
+
+BOOST_AUTO_TEST_CASE(Float16Encoding)
+{
+	BOOST_CHECK_EQUAL(FloatCodec::encode(0.0f, FloatFormat::Float16), 0x0000);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(-0.0f, FloatFormat::Float16), 0x8000);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f, FloatFormat::Float16), 0x3c00);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(-2.0f, FloatFormat::Float16), 0xc000);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(65504.0f, FloatFormat::Float16), 0x7bff);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(std::ldexp(1.0f, -14), FloatFormat::Float16), 0x0400);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(std::ldexp(1.0f, -24), FloatFormat::Float16), 0x0001);
+
+	//rounding to nearest, ties to even
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f + std::ldexp(1.0f, -11), FloatFormat::Float16), 0x3c00);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f + 3.0f * std::ldexp(1.0f, -11), FloatFormat::Float16), 0x3c02);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20), FloatFormat::Float16), 0x3c01);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(std::ldexp(1.0f, -25), FloatFormat::Float16), 0x0000);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(3.0f * std::ldexp(1.0f, -25), FloatFormat::Float16), 0x0002);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(std::ldexp(1.0f, -14) - std::ldexp(1.0f, -25), FloatFormat::Float16), 0x0400);
+
+	//overflow and special values
+	BOOST_CHECK_EQUAL(FloatCodec::encode(65519.0f, FloatFormat::Float16), 0x7bff);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(65520.0f, FloatFormat::Float16), 0x7c00);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(-1e10f, FloatFormat::Float16), 0xfc00);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(INFINITY, FloatFormat::Float16), 0x7c00);
+	BOOST_CHECK(std::isnan(FloatCodec::round(NAN, FloatFormat::Float16)));
+}
+
+BOOST_AUTO_TEST_CASE(BFloat16Encoding)
+{
+	BOOST_CHECK_EQUAL(FloatCodec::encode(0.0f, FloatFormat::BFloat16), 0x0000);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f, FloatFormat::BFloat16), 0x3f80);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(-2.0f, FloatFormat::BFloat16), 0xc000);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1e30f, FloatFormat::BFloat16) & 0x7f80, 0x7100);
+
+	//rounding to nearest, ties to even
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f + std::ldexp(1.0f, -8), FloatFormat::BFloat16), 0x3f80);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f + 3.0f * std::ldexp(1.0f, -8), FloatFormat::BFloat16), 0x3f82);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(1.0f + std::ldexp(1.0f, -8) + std::ldexp(1.0f, -20), FloatFormat::BFloat16), 0x3f81);
+
+	//special values
+	BOOST_CHECK_EQUAL(FloatCodec::encode(std::numeric_limits<float>::max(), FloatFormat::BFloat16), 0x7f80);
+	BOOST_CHECK_EQUAL(FloatCodec::encode(-INFINITY, FloatFormat::BFloat16), 0xff80);
+	BOOST_CHECK(std::isnan(FloatCodec::round(NAN, FloatFormat::BFloat16)));
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+	//every finite 16 bit value is reproduced exactly
+	for (int i = 0; i < 65536; ++i)
+	{
+		uint16_t h = uint16_t(i);
+		float f16 = FloatCodec::decode(h, FloatFormat::Float16);
+		if (!std::isnan(f16)) BOOST_CHECK_EQUAL(FloatCodec::encode(f16, FloatFormat::Float16), h);
+		float bf16 = FloatCodec::decode(h, FloatFormat::BFloat16);
+		if (!std::isnan(bf16)) BOOST_CHECK_EQUAL(FloatCodec::encode(bf16, FloatFormat::BFloat16), h);
+	}
+
+	//rounded values are within half a unit in the last place
+	for (int i = -1000; i <= 1000; ++i)
+	{
+		float value = 0.0137f * float(i) * std::abs(float(i));
+		BOOST_CHECK_SMALL(FloatCodec::round(value, FloatFormat::Float16) - value, std::abs(value) * std::ldexp(1.0f, -11) + std::ldexp(1.0f, -25));
+		BOOST_CHECK_SMALL(FloatCodec::round(value, FloatFormat::BFloat16) - value, std::abs(value) * std::ldexp(1.0f, -8));
+		BOOST_CHECK_EQUAL(FloatCodec::round(value, FloatFormat::Float32), value);
+	}
+
+	//array conversion
+	const int dataSize = 16;
+	float data[dataSize];
+	uint16_t buffer[dataSize];
+	for (int i = 0; i < dataSize; ++i) data[i] = 0.1f * float(i);
+	FloatCodec::encode(data, buffer, dataSize, FloatFormat::Float16);
+	FloatCodec::decode(buffer, data, dataSize, FloatFormat::Float16);
+	for (int i = 0; i < dataSize; ++i) BOOST_CHECK_EQUAL(data[i], FloatCodec::round(0.1f * float(i), FloatFormat::Float16));
+}
+
+BOOST_AUTO_TEST_CASE(CompactArray)
+{
+	const int dataSize = 16;
+	FloatArray a = FloatArray::allocate(dataSize, FloatFormat::Float16);
+	BOOST_TEST(a.isCompact());
+	BOOST_CHECK_EQUAL(a.bytes(), dataSize * sizeof(uint16_t));
+	for (int i = 0; i < dataSize; ++i) BOOST_CHECK_EQUAL(a.get(i), 0.0f);
+
+	//values are rounded to the storage format on every write
+	for (int i = 0; i < dataSize; ++i) a[i] = 0.1f * float(i);
+	a[1] += 0.1f;
+	for (int i = 0; i < dataSize; ++i) BOOST_CHECK_EQUAL(a.get(i), (i == 1) ? FloatCodec::round(FloatCodec::round(0.1f, FloatFormat::Float16) + 0.1f, FloatFormat::Float16) : FloatCodec::round(0.1f * float(i), FloatFormat::Float16));
+
+	//block access decodes into the buffer
+	float buffer[dataSize];
+	const float *line = a.subarray(4, 8).line(2, 4, buffer);
+	BOOST_CHECK_EQUAL(line, buffer);
+	for (int i = 0; i < 4; ++i) BOOST_CHECK_EQUAL(line[i], a.get(6 + i));
+	a.release();
+	BOOST_CHECK_EQUAL(a.size(), 0);
+
+	//single precision arrays are accessed in place
+	float data[dataSize];
+	for (int i = 0; i < dataSize; ++i) data[i] = 0.1f * float(i);
+	FloatArray b(data, dataSize);
+	BOOST_TEST(!b.isCompact());
+	BOOST_CHECK_EQUAL(b.line(3, 4, buffer), data + 3);
+	b.write(0, 2, data + 14);
+	BOOST_CHECK_EQUAL(data[1], 0.1f * 15.0f);
+}
+
+BOOST_AUTO_TEST_CASE(FormatNames)
+{
+	BOOST_CHECK(FloatCodec::parse("fp32") == FloatFormat::Float32);
+	BOOST_CHECK(FloatCodec::parse("fp16") == FloatFormat::Float16);
+	BOOST_CHECK(FloatCodec::parse("bf16") == FloatFormat::BFloat16);
+	BOOST_CHECK_EQUAL(FloatCodec::name(FloatFormat::BFloat16), "bf16");
+	BOOST_CHECK_THROW(FloatCodec::parse("fp8"), Exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,43 @@
+#define BOOST_TEST_MODULE "FlowIntegratorTest"
+#include <boost/test/included/unit_test.hpp>
+#include <cmath>
+#include "FlowIntegrator.hpp"
+
+BOOST_AUTO_TEST_SUITE(FlowIntegratorTest);
+
+BOOST_AUTO_TEST_CASE(adamsBashforthUniform)
+{
+	//first order is an Euler step
+	std::vector<double> w1 = FlowIntegrator::adamsBashforthWeights({ 1.0f }, 0.5f);
+	BOOST_CHECK_EQUAL(w1.size(), 1);
+	BOOST_CHECK_CLOSE(w1[0], -0.5, 1e-4);
+
+	//uniform steps reproduce the textbook coefficients
+	float h = -0.25f;
+	std::vector<double> w2 = FlowIntegrator::adamsBashforthWeights({ 1.0f, 1.0f - h }, 1.0f + h);
+	BOOST_CHECK_CLOSE(w2[0], 3.0 / 2.0 * h, 1e-3);
+	BOOST_CHECK_CLOSE(w2[1], -1.0 / 2.0 * h, 1e-3);
+
+	std::vector<double> w3 = FlowIntegrator::adamsBashforthWeights({ 1.0f, 1.0f - h, 1.0f - 2.0f * h }, 1.0f + h);
+	BOOST_CHECK_CLOSE(w3[0], 23.0 / 12.0 * h, 1e-3);
+	BOOST_CHECK_CLOSE(w3[1], -16.0 / 12.0 * h, 1e-3);
+	BOOST_CHECK_CLOSE(w3[2], 5.0 / 12.0 * h, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(adamsBashforthExactness)
+{
+	//a k-step method integrates polynomials of degree k - 1 exactly, also for non-uniform steps
+	std::vector<float> cutoffs({ 2.0f, 2.5f, 3.5f, 4.0f });
+	float newCutoff = 1.6f;
+	std::vector<double> w = FlowIntegrator::adamsBashforthWeights(cutoffs, newCutoff);
+
+	for (int degree = 0; degree < int(cutoffs.size()); ++degree)
+	{
+		double integral = 0.0;
+		for (unsigned int j = 0; j < cutoffs.size(); ++j) integral += w[j] * std::pow(double(cutoffs[j]), degree);
+		double reference = (std::pow(double(newCutoff), degree + 1) - std::pow(double(cutoffs[0]), degree + 1)) / (degree + 1);
+		BOOST_CHECK_CLOSE(integral, reference, 1e-3);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,95 @@
+#define BOOST_TEST_MODULE "FourierTransformTest"
+#include <boost/test/included/unit_test.hpp>
+#include "lib/FourierTransform.hpp"
+
+BOOST_AUTO_TEST_SUITE(FourierTransformTest);
+
+BOOST_AUTO_TEST_CASE(paddedSize)
+{
+	BOOST_TEST(FourierTransform::paddedSize(1) == 1);
+	BOOST_TEST(FourierTransform::paddedSize(2) == 2);
+	BOOST_TEST(FourierTransform::paddedSize(3) == 4);
+	BOOST_TEST(FourierTransform::paddedSize(10) == 16);
+	BOOST_TEST(FourierTransform::paddedSize(16) == 16);
+}
+
+BOOST_AUTO_TEST_CASE(forward)
+{
+	const std::array<int, 3> dimensions = { { 4, 1, 8 } };
+	FourierTransform transform(dimensions);
+	BOOST_TEST(transform.size() == 32);
+
+	std::vector<std::complex<double>> data(transform.size());
+	for (int i = 0; i < transform.size(); ++i) data[i] = std::complex<double>(0.5 - 0.1 * i, 0.01 * i * i);
+	std::vector<std::complex<double>> x = data;
+	transform.forward(data.data());
+
+	//compare to the direct evaluation of the discrete Fourier transform
+	const double pi = 3.14159265358979323846;
+	for (int k0 = 0; k0 < dimensions[0]; ++k0)
+	{
+		for (int k2 = 0; k2 < dimensions[2]; ++k2)
+		{
+			std::complex<double> reference = 0.0;
+			for (int x0 = 0; x0 < dimensions[0]; ++x0)
+			{
+				for (int x2 = 0; x2 < dimensions[2]; ++x2) reference += x[x0 * dimensions[2] + x2] * std::polar(1.0, -2.0 * pi * (double(k0 * x0) / dimensions[0] + double(k2 * x2) / dimensions[2]));
+			}
+			BOOST_TEST(std::abs(data[k0 * dimensions[2] + k2] - reference) < 1e-10);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(backward)
+{
+	const std::array<int, 3> dimensions = { { 2, 4, 8 } };
+	FourierTransform transform(dimensions);
+
+	std::vector<std::complex<double>> data(transform.size());
+	for (int i = 0; i < transform.size(); ++i) data[i] = std::complex<double>(1.0 / (1 + i), (i % 3) - 1.0);
+	std::vector<std::complex<double>> x = data;
+	transform.forward(data.data());
+	transform.backward(data.data());
+
+	for (int i = 0; i < transform.size(); ++i) BOOST_TEST(std::abs(data[i] - x[i]) < 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(pruned)
+{
+	const std::array<int, 3> dimensions = { { 8, 16, 8 } };
+	const std::array<int, 3> extent = { { 2, 3, 1 } };
+	FourierTransform transform(dimensions);
+	BOOST_TEST(transform.butterflies(extent) < transform.butterflies(dimensions));
+
+	//data which vanishes outside of the box |x_d| <= extent_d
+	auto isInside = [&](const int i) -> bool
+	{
+		const int x[3] = { i / (dimensions[1] * dimensions[2]), (i / dimensions[2]) % dimensions[1], i % dimensions[2] };
+		for (int d = 0; d < 3; ++d)
+		{
+			if (x[d] > extent[d] && x[d] < dimensions[d] - extent[d]) return false;
+		}
+		return true;
+	};
+	std::vector<std::complex<double>> data(transform.size(), 0.0);
+	for (int i = 0; i < transform.size(); ++i)
+	{
+		if (isInside(i)) data[i] = std::complex<double>(0.5 - 0.01 * i, 1.0 / (1 + i));
+	}
+	std::vector<std::complex<double>> reference = data;
+
+	transform.forward(data.data(), extent);
+	transform.forward(reference.data());
+	for (int i = 0; i < transform.size(); ++i) BOOST_TEST(std::abs(data[i] - reference[i]) < 1e-10);
+
+	//results of the pruned backward transform are only required within the box
+	for (int i = 0; i < transform.size(); ++i) data[i] = reference[i] = std::complex<double>(std::cos(0.1 * i), 0.2 * (i % 7));
+	transform.backward(data.data(), extent);
+	transform.backward(reference.data());
+	for (int i = 0; i < transform.size(); ++i)
+	{
+		if (isInside(i)) BOOST_TEST(std::abs(data[i] - reference[i]) < 1e-10);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END();
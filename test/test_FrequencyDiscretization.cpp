@@ -119,5 +119,78 @@ BOOST_AUTO_TEST_CASE(interpolateOffset)
 	BOOST_CHECK_LE(bias, 1.0f);
 }
 
+void checkLookup(const std::vector<float> &values)
+{
+	FrequencyDiscretization frequency(values);
+	int size = int(values.size());
+
+	std::vector<float> probes({ 0.0f, 0.5f * values[0], values.back(), 2.0f * values.back() });
+	for (int i = 0; i < size; ++i)
+	{
+		probes.push_back(values[i]);
+		probes.push_back(std::nextafter(values[i], 0.0f));
+		probes.push_back(std::nextafter(values[i], 2.0f * values[i]));
+		if (i < size - 1) for (int j = 1; j < 8; ++j) probes.push_back(values[i] + (values[i + 1] - values[i]) * float(j) / 8.0f);
+	}
+
+	for (float w : probes)
+	{
+		//reference implementation by linear search
+		int offset = size - 1;
+		if (w <= values[0]) offset = 0;
+		else for (int i = 1; i < size; ++i) if (values[i] >= w) { offset = i; break; }
+
+		int lowerOffset = size - 1, upperOffset = size - 1;
+		if (w <= values[0]) lowerOffset = upperOffset = 0;
+		else for (int i = 1; i < size; ++i) if (values[i] > w) { lowerOffset = i - 1; upperOffset = i; break; }
+
+		BOOST_CHECK_EQUAL(frequency.offset(w), offset);
+
+		int lower, upper;
+		float bias;
+		frequency.interpolateOffset(w, lower, upper, bias);
+		BOOST_CHECK_EQUAL(lower, lowerOffset);
+		BOOST_CHECK_EQUAL(upper, upperOffset);
+		BOOST_CHECK_GE(bias, 0.0f);
+		BOOST_CHECK_LE(bias, 1.0f);
+
+		BOOST_CHECK_EQUAL(*frequency.lesser(w), values[lowerOffset]);
+		BOOST_CHECK_EQUAL(*frequency.greater(w), values[upperOffset]);
+		if (w > 0.0f)
+		{
+			BOOST_CHECK_EQUAL(*frequency.lesser(-w), -values[upperOffset]);
+			BOOST_CHECK_EQUAL(*frequency.greater(-w), -values[lowerOffset]);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(lookupExponential)
+{
+	std::vector<float> values;
+	float step = powf(50.0f / 0.005f, 1.0f / 63.0f);
+	for (int i = 0; i < 64; ++i) values.push_back(0.005f * powf(step, float(i)));
+	checkLookup(values);
+}
+
+BOOST_AUTO_TEST_CASE(lookupManual)
+{
+	checkLookup({ 0.01f, 0.1f, 0.15f, 0.2f, 1.0f, 7.5f, 8.0f, 100.0f });
+}
+
+BOOST_AUTO_TEST_CASE(expandTriangularIndex)
+{
+	int64_t su = 0;
+	for (int so = 0; so < 2000; ++so)
+	{
+		for (int uo = 0; uo <= so; ++uo)
+		{
+			int soExpanded, uoExpanded;
+			FrequencyDiscretization::expandTriangularIndex(su, soExpanded, uoExpanded);
+			BOOST_CHECK_EQUAL(soExpanded, so);
+			BOOST_CHECK_EQUAL(uoExpanded, uo);
+			++su;
+		}
+	}
+}
 
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
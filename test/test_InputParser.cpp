@@ -36,4 +36,14 @@ BOOST_AUTO_TEST_CASE(stringToFloat)
 	BOOST_CHECK_CLOSE(InputParser::stringToFloat("-1.5*sqrt(3.9)/2.1"), -1.5 * sqrt(3.9) / 2.1, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(stringToInt)
+{
+	BOOST_CHECK_EQUAL(InputParser::stringToInt("64"), 64);
+	BOOST_CHECK_EQUAL(InputParser::stringToInt("-3"), -3);
+	BOOST_CHECK_THROW(InputParser::stringToInt(""), Exception);
+	BOOST_CHECK_THROW(InputParser::stringToInt("abc"), Exception);
+	BOOST_CHECK_THROW(InputParser::stringToInt("64abc"), Exception);
+	BOOST_CHECK_THROW(InputParser::stringToInt("99999999999"), Exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
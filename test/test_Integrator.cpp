@@ -119,4 +119,43 @@ BOOST_AUTO_TEST_CASE(ImplicitIntegratorIntegrateWithObscureBoundaries, *boost::u
 	BOOST_CHECK_EQUAL(result.bundle(0)[1], 285.875f);
 }
 
+BOOST_AUTO_TEST_CASE(ImplicitIntegratorIntegrateOutsideCutoff)
+{
+	auto integrand = [](float x, ValueSuperbundle<float, 1> &out)->void { out.bundle(0)[0] = x; out.bundle(0)[1] = x * x; };
+	std::function<void(float, ValueSuperbundle<float, 1> &)> typeErasedIntegrand = integrand;
+
+	ValueSuperbundle<float, 1> buffer(2);
+	ValueSuperbundle<float, 1> rangeBuffer(2);
+	ValueSuperbundle<float, 1> result(2);
+	ValueSuperbundle<float, 1> reference(2);
+	ValueSuperbundle<float, 1> typeErasedResult(2);
+
+	//shift beyond twice the cutoff, such that all three ranges contribute
+	for (float shift : { 0.0f, 1.0f, 5.0f })
+	{
+		const float cutoff = 1.5f;
+		result.reset();
+		typeErasedResult.reset();
+		reference.reset();
+		ImplicitIntegrator::integrateOutsideCutoff(shift, cutoff, integrand, buffer, rangeBuffer, result);
+		ImplicitIntegrator::integrateOutsideCutoff(shift, cutoff, typeErasedIntegrand, buffer, rangeBuffer, typeErasedResult);
+
+		ImplicitIntegrator::integrateWithObscureRightBoundary(FrgCommon::frequency().beginNegative(), -(shift + cutoff), integrand, buffer, rangeBuffer);
+		reference += rangeBuffer;
+		if (shift > 2.0f * cutoff)
+		{
+			ImplicitIntegrator::integrateWithObscureBoundaries(cutoff - shift, -cutoff, integrand, buffer, rangeBuffer);
+			reference += rangeBuffer;
+		}
+		ImplicitIntegrator::integrateWithObscureLeftBoundary(cutoff, FrgCommon::frequency().last(), integrand, buffer, rangeBuffer);
+		reference += rangeBuffer;
+
+		for (int i = 0; i < 2; ++i)
+		{
+			BOOST_CHECK_EQUAL(result.bundle(0)[i], reference.bundle(0)[i]);
+			BOOST_CHECK_EQUAL(typeErasedResult.bundle(0)[i], reference.bundle(0)[i]);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
@@ -0,0 +1,240 @@
+#define BOOST_TEST_MODULE "LatticeBubbleTest"
+#include <boost/test/included/unit_test.hpp>
+#include "lib/Log.hpp"
+#include "LatticeModelFactory.hpp"
+#include "LatticeBubble.hpp"
+
+namespace tt = boost::test_tools;
+
+struct LatticeBubbleFixture
+{
+	LatticeBubbleFixture() : a(sites), b(sites), result(sites)
+	{
+		//rows of varying length, including an empty row
+		const int rowLength[sites] = { 3, 0, 5, 1, 4 };
+		int entries = 0;
+		for (int rid = 0; rid < sites; ++rid) entries += rowLength[rid];
+
+		overlap.allocate(sites, entries);
+		overlap.offsets[0] = 0;
+		int k = 0;
+		for (int rid = 0; rid < sites; ++rid)
+		{
+			for (int n = 0; n < rowLength[rid]; ++n, ++k)
+			{
+				overlap.rid1[k] = (3 * k + rid) % sites;
+				overlap.rid2[k] = (k + 2 * rid) % sites;
+
+				//cyclic permutations of the spin components
+				const SpinComponent permutations[3][3] = { { SpinComponent::X, SpinComponent::Y, SpinComponent::Z }, { SpinComponent::Y, SpinComponent::Z, SpinComponent::X }, { SpinComponent::Z, SpinComponent::X, SpinComponent::Y } };
+				overlap.transformedX1[k] = permutations[k % 3][0];
+				overlap.transformedY1[k] = permutations[k % 3][1];
+				overlap.transformedZ1[k] = permutations[k % 3][2];
+				overlap.transformedX2[k] = permutations[(k + rid) % 3][0];
+				overlap.transformedY2[k] = permutations[(k + rid) % 3][1];
+				overlap.transformedZ2[k] = permutations[(k + rid) % 3][2];
+			}
+			overlap.offsets[rid + 1] = k;
+		}
+
+		for (int c = 0; c < 4; ++c)
+		{
+			for (int rid = 0; rid < sites; ++rid)
+			{
+				a.bundle(c)[rid] = 0.5f + 0.25f * float(c) - 0.125f * float(rid);
+				b.bundle(c)[rid] = 1.0f / float(1 + rid + 2 * c);
+			}
+		}
+	}
+
+	static const int sites = 5;
+	LatticeOverlapTable overlap;
+	ValueSuperbundle<float, 4> a;
+	ValueSuperbundle<float, 4> b;
+	ValueSuperbundle<float, 4> result;
+};
+
+struct BravaisLatticeFixture
+{
+	BravaisLatticeFixture()
+	{
+		//square lattice with a single-site basis
+		LatticeModelFactory::LatticeUnitCell square;
+		square.basisSites.push_back(geometry::Vec3<double>(0.0, 0.0, 0.0));
+		square.latticeVectors.push_back(geometry::Vec3<double>(1.0, 0.0, 0.0));
+		square.latticeVectors.push_back(geometry::Vec3<double>(0.0, 1.0, 0.0));
+		square.latticeVectors.push_back(geometry::Vec3<double>(0.0, 0.0, 1.0));
+		square.latticeBonds.push_back(LatticeModelFactory::LatticeBond(0, 0, 1, 0, 0));
+		square.latticeBonds.push_back(LatticeModelFactory::LatticeBond(0, 0, 0, 1, 0));
+
+		//honeycomb lattice with a two-site basis
+		LatticeModelFactory::LatticeUnitCell honeycomb;
+		honeycomb.basisSites.push_back(geometry::Vec3<double>(0.0, 0.0, 0.0));
+		honeycomb.basisSites.push_back(geometry::Vec3<double>(1.0, 0.0, 0.0));
+		honeycomb.latticeVectors.push_back(geometry::Vec3<double>(1.5, 0.5 * sqrt(3), 0.0));
+		honeycomb.latticeVectors.push_back(geometry::Vec3<double>(1.5, -0.5 * sqrt(3), 0.0));
+		honeycomb.latticeVectors.push_back(geometry::Vec3<double>(0.0, 0.0, 1.0));
+		honeycomb.latticeBonds.push_back(LatticeModelFactory::LatticeBond(0, 1, 0, 0, 0));
+		honeycomb.latticeBonds.push_back(LatticeModelFactory::LatticeBond(1, 0, 1, 0, 0));
+		honeycomb.latticeBonds.push_back(LatticeModelFactory::LatticeBond(1, 0, 0, 1, 0));
+
+		//Heisenberg interactions
+		LatticeModelFactory::SpinModelUnitCell squareModel;
+		LatticeModelFactory::SpinInteraction i1(LatticeModelFactory::LatticeSite(0, 0, 0, 0), LatticeModelFactory::LatticeSite(1, 0, 0, 0));
+		LatticeModelFactory::SpinInteraction i2(LatticeModelFactory::LatticeSite(0, 0, 0, 0), LatticeModelFactory::LatticeSite(0, 1, 0, 0));
+		for (int mu = 0; mu < 3; ++mu) i1.interactionStrength[mu][mu] = i2.interactionStrength[mu][mu] = 1.0f;
+		squareModel.interactions.push_back(i1);
+		squareModel.interactions.push_back(i2);
+
+		LatticeModelFactory::SpinModelUnitCell honeycombModel;
+		LatticeModelFactory::SpinInteraction i3(LatticeModelFactory::LatticeSite(0, 0, 0, 0), LatticeModelFactory::LatticeSite(0, 0, 0, 1));
+		for (int mu = 0; mu < 3; ++mu) i3.interactionStrength[mu][mu] = 1.0f;
+		honeycombModel.interactions.push_back(i3);
+
+		Log::log << Log::setDisplayLogLevel(Log::LogLevel::None);
+		std::pair<Lattice *, SpinModel *> product = LatticeModelFactory::newLatticeModel(square, squareModel, 4);
+		squareLattice = product.first;
+		delete product.second;
+		product = LatticeModelFactory::newLatticeModel(honeycomb, honeycombModel, 3);
+		honeycombLattice = product.first;
+		delete product.second;
+	}
+
+	~BravaisLatticeFixture()
+	{
+		delete squareLattice;
+		delete honeycombLattice;
+	}
+
+	Lattice *squareLattice;
+	Lattice *honeycombLattice;
+};
+
+BOOST_FIXTURE_TEST_SUITE(LatticeBubbleTest, LatticeBubbleFixture)
+
+BOOST_AUTO_TEST_CASE(overlapRows)
+{
+	for (int rid = 0; rid < sites; ++rid)
+	{
+		LatticeOverlap row = overlap.row(rid);
+		BOOST_TEST(row.size == overlap.offsets[rid + 1] - overlap.offsets[rid]);
+		BOOST_TEST(row.rid1 == overlap.rid1 + overlap.offsets[rid]);
+		BOOST_TEST(row.transformedZ2 == overlap.transformedZ2 + overlap.offsets[rid]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(transpose)
+{
+	float siteMajor[4 * sites];
+	LatticeBubble::transpose(a, siteMajor);
+	for (int rid = 0; rid < sites; ++rid)
+	{
+		for (int c = 0; c < 4; ++c) BOOST_TEST(siteMajor[4 * rid + c] == a.bundle(c)[rid]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(product)
+{
+	float siteMajorA[4 * sites];
+	float siteMajorB[4 * sites];
+	LatticeBubble::transpose(a, siteMajorA);
+	LatticeBubble::transpose(b, siteMajorB);
+	LatticeBubble::product(overlap, siteMajorA, siteMajorB, result);
+
+	//compare to the sum over the overlap rows, which is accumulated in the same order
+	for (int rid = 0; rid < sites; ++rid)
+	{
+		LatticeOverlap row = overlap.row(rid);
+		for (int c = 0; c < 4; ++c)
+		{
+			float reference = 0.0f;
+			for (int i = 0; i < row.size; ++i) reference += a.bundle(c)[row.rid1[i]] * b.bundle(c)[row.rid2[i]];
+			BOOST_TEST(result.bundle(c)[rid] == reference);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(productSpinPermuted)
+{
+	float siteMajorA[4 * sites];
+	float siteMajorB[4 * sites];
+	LatticeBubble::transpose(a, siteMajorA);
+	LatticeBubble::transpose(b, siteMajorB);
+	LatticeBubble::productSpinPermuted(overlap, siteMajorA, siteMajorB, result);
+
+	for (int rid = 0; rid < sites; ++rid)
+	{
+		LatticeOverlap row = overlap.row(rid);
+		float reference[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (int i = 0; i < row.size; ++i)
+		{
+			reference[0] += a.bundle(static_cast<int>(row.transformedX1[i]))[row.rid1[i]] * b.bundle(static_cast<int>(row.transformedX2[i]))[row.rid2[i]];
+			reference[1] += a.bundle(static_cast<int>(row.transformedY1[i]))[row.rid1[i]] * b.bundle(static_cast<int>(row.transformedY2[i]))[row.rid2[i]];
+			reference[2] += a.bundle(static_cast<int>(row.transformedZ1[i]))[row.rid1[i]] * b.bundle(static_cast<int>(row.transformedZ2[i]))[row.rid2[i]];
+			reference[3] += a.bundle(3)[row.rid1[i]] * b.bundle(3)[row.rid2[i]];
+		}
+		for (int c = 0; c < 4; ++c) BOOST_TEST(result.bundle(c)[rid] == reference[c]);
+	}
+}
+
+BOOST_FIXTURE_TEST_CASE(fourierPlanApplicability, BravaisLatticeFixture)
+{
+	LatticeBubble::FourierPlan squarePlan(*squareLattice);
+	BOOST_TEST(squarePlan.isApplicable());
+	BOOST_TEST(squarePlan.hasTrivialSpinPermutations());
+	BOOST_TEST(squarePlan.dimensions()[0] == 16);
+	BOOST_TEST(squarePlan.dimensions()[1] == 16);
+	BOOST_TEST(squarePlan.dimensions()[2] == 1);
+
+	LatticeBubble::FourierPlan honeycombPlan(*honeycombLattice);
+	BOOST_TEST(!honeycombPlan.isApplicable());
+	BOOST_TEST(!honeycombPlan.isFavorable(2));
+
+	LatticeBubble::FourierPlan emptyPlan;
+	BOOST_TEST(!emptyPlan.isApplicable());
+}
+
+BOOST_FIXTURE_TEST_CASE(fourierPlanCost, BravaisLatticeFixture)
+{
+	//the direct evaluation is faster for small lattice ranges
+	LatticeBubble::FourierPlan squarePlan(*squareLattice);
+	BOOST_TEST(squarePlan.directCost(2) == double(squareLattice->getOverlapTable().entries));
+	BOOST_TEST(squarePlan.fourierCost(2) > squarePlan.directCost(2));
+	BOOST_TEST(squarePlan.fourierCost(4) > squarePlan.fourierCost(2));
+	BOOST_TEST(!squarePlan.isFavorable(2));
+}
+
+BOOST_FIXTURE_TEST_CASE(fourierPlanProduct, BravaisLatticeFixture)
+{
+	//odd number of components, such that the last backward transform carries a single component
+	const int size = squareLattice->size;
+	ValueSuperbundle<float, 3> a(size);
+	ValueSuperbundle<float, 3> b(size);
+	ValueSuperbundle<float, 3> direct(size);
+	ValueSuperbundle<float, 3> momentumSpace(size);
+	for (int c = 0; c < 3; ++c)
+	{
+		for (int rid = 0; rid < size; ++rid)
+		{
+			a.bundle(c)[rid] = 1.0f / float(1 + rid + c);
+			b.bundle(c)[rid] = 0.25f * float(c) - 0.125f * float(rid % 5);
+		}
+	}
+
+	std::vector<float> siteMajorA(3 * size);
+	std::vector<float> siteMajorB(3 * size);
+	LatticeBubble::transpose(a, siteMajorA.data());
+	LatticeBubble::transpose(b, siteMajorB.data());
+	LatticeBubble::product(squareLattice->getOverlapTable(), siteMajorA.data(), siteMajorB.data(), direct);
+
+	LatticeBubble::FourierPlan plan(*squareLattice);
+	ScratchArena arena;
+	plan.product(a, b, momentumSpace, arena);
+
+	for (int c = 0; c < 3; ++c)
+	{
+		for (int rid = 0; rid < size; ++rid) BOOST_TEST(momentumSpace.bundle(c)[rid] == direct.bundle(c)[rid], tt::tolerance(1e-5f));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -2,7 +2,11 @@
 #include <chrono>
 #include <thread>
 #include <boost/test/included/unit_test.hpp>
+
+//split all transfers into small messages in order to test message splitting
+#define HMP_MAX_MESSAGE_SIZE 12
 #include "lib/LoadManager.hpp"
+#include "lib/NodeSharedArray.hpp"
 
 #ifndef DISABLE_MPI
 #include "mpi.h"
@@ -64,8 +68,8 @@ BOOST_AUTO_TEST_CASE(MasterStackExplicit)
 		}
 	};
 
-	std::function<float(int)> calculator1 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n); };
-	std::function<float(int)> calculator2 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n * n); };
+	std::function<float(HMP::StackIndex)> calculator1 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n); };
+	std::function<float(HMP::StackIndex)> calculator2 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n * n); };
 
 	HMP::StackIdentifier stack1 = m->addMasterStackExplicit(&data1[0], dataLength, calculator1);
 	HMP::StackIdentifier stack2 = m->addMasterStackExplicit(&data2[0], dataLength, calculator2);
@@ -99,8 +103,8 @@ BOOST_AUTO_TEST_CASE(MasterStackExplicitAutobroadcast)
 		}
 	};
 
-	std::function<float(int)> calculator1 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n); };
-	std::function<float(int)> calculator2 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n * n); };
+	std::function<float(HMP::StackIndex)> calculator1 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n); };
+	std::function<float(HMP::StackIndex)> calculator2 = [](int n)->float { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return float(n * n * n); };
 
 	m->addMasterStackExplicit(&data1[0], dataLength, calculator1, 1, 8, true);
 	m->addMasterStackExplicit(&data2[0], dataLength, calculator2, 1, 8, true);
@@ -123,7 +127,7 @@ BOOST_AUTO_TEST_CASE(MasterStackImplicit)
 		}
 	};
 
-	std::function<void(int)> calculator1 = [&data1](int n)->void { std::this_thread::sleep_for(std::chrono::milliseconds(50)); data1[n] = float(n * n); };
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1](int n)->void { std::this_thread::sleep_for(std::chrono::milliseconds(50)); data1[n] = float(n * n); };
 
 	HMP::StackIdentifier stack1 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, 1, 1, 8, true);
 
@@ -145,7 +149,7 @@ BOOST_AUTO_TEST_CASE(MasterStackImplicitTyplemult)
 		}
 	};
 
-	std::function<void(int)> calculator1 = [&data1](int n)->void { std::this_thread::sleep_for(std::chrono::milliseconds(50)); data1[2*n] = float(4 * n * n); data1[2*n+1] = float((2 * n + 1) * (2 * n + 1)); };
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1](int n)->void { std::this_thread::sleep_for(std::chrono::milliseconds(50)); data1[2*n] = float(4 * n * n); data1[2*n+1] = float((2 * n + 1) * (2 * n + 1)); };
 
 	HMP::StackIdentifier stack1 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, dataMultiplicity, 1, 4, true);
 
@@ -154,6 +158,95 @@ BOOST_AUTO_TEST_CASE(MasterStackImplicitTyplemult)
 	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], float(i * i));
 }
 
+BOOST_AUTO_TEST_CASE(MasterStackImplicitImbalanced)
+{
+	const int dataLength = 512;
+	float data1[dataLength];
+
+	auto resetdata = [&]()->void {
+		for (int i = 0; i < dataLength; ++i)
+		{
+			data1[i] = 0.0f;
+		}
+	};
+
+	//few expensive calculators among many cheap ones; every calculator must be applied exactly once
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1](int n)->void { if (n % 64 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(50)); data1[n] += float(n + 1); };
+
+	HMP::StackIdentifier stack1 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, 1, 1, 4, true);
+
+	resetdata();
+	m->calculate(stack1);
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], float(i + 1));
+}
+
+BOOST_AUTO_TEST_CASE(MasterStackImplicitCost)
+{
+	const int dataLength = 256;
+	float data1[dataLength];
+	float data2[dataLength];
+
+	auto resetdata = [&]()->void {
+		for (int i = 0; i < dataLength; ++i)
+		{
+			data1[i] = 0.0f;
+			data2[i] = 0.0f;
+		}
+	};
+
+	//the cost of the calculators grows with the element index
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1](int n)->void { std::this_thread::sleep_for(std::chrono::microseconds(20 * n)); data1[n] += float(n + 1); };
+	std::function<void(HMP::StackIndex)> calculator2 = [&data2](int n)->void { std::this_thread::sleep_for(std::chrono::microseconds(20 * n)); data2[n] += float(n + 1); };
+
+	HMP::StackIdentifier stack1 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, 1, 2, 4, true);
+	HMP::StackIdentifier stack2 = m->addMasterStackImplicit(&data2[0], dataLength, calculator2, 1, 2, 4, true);
+	HMP::StackIdentifier stack3 = m->addPassiveStack(&data1[0], dataLength);
+	m->setCostEstimator(stack1, [](HMP::StackIndex n)->float { return float(n); });
+	m->enableCostLearning(stack2);
+	BOOST_CHECK_THROW(m->setCostEstimator(stack3, [](HMP::StackIndex)->float { return 1.0f; }), Exception);
+	BOOST_CHECK_THROW(m->enableCostLearning(stack3), Exception);
+
+	//learned costs are only available from the second calculation onward
+	for (int step = 0; step < 2; ++step)
+	{
+		resetdata();
+		m->calculate({ stack1, stack2 });
+		for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], float(i + 1));
+		for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data2[i], float(i + 1));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MasterStackImplicitAffinity)
+{
+	const int dataLength = 256;
+	float data1[dataLength];
+	float data2[dataLength];
+
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1](int n)->void { data1[n] += float(n + 1); };
+	std::function<void(HMP::StackIndex)> calculator2 = [&data2](int n)->void { std::this_thread::sleep_for(std::chrono::microseconds(20 * n)); data2[n] += float(n + 1); };
+
+	HMP::StackIdentifier stack1 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, 1, 2, 4, true);
+	HMP::StackIdentifier stack2 = m->addMasterStackImplicit(&data2[0], dataLength, calculator2, 1, 2, 4, true);
+	HMP::StackIdentifier stack3 = m->addPassiveStack(&data1[0], dataLength);
+	m->enableAffinity(stack1);
+	m->enableAffinity(stack2);
+	m->enableCostLearning(stack2);
+	BOOST_CHECK_THROW(m->enableAffinity(stack3), Exception);
+
+	//home ranges are derived from the previous calculation from the second calculation onward
+	for (int step = 0; step < 3; ++step)
+	{
+		for (int i = 0; i < dataLength; ++i)
+		{
+			data1[i] = 0.0f;
+			data2[i] = 0.0f;
+		}
+		m->calculate({ stack1, stack2 });
+		for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], float(i + 1));
+		for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data2[i], float(i + 1));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(SlaveStack)
 {
 	const int dataLength = 8;
@@ -169,7 +262,7 @@ BOOST_AUTO_TEST_CASE(SlaveStack)
 		}
 	};
 
-	std::function<void(int)> calculator1 = [&data1,&data2](int n)->void { 
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1,&data2](int n)->void { 
 		std::this_thread::sleep_for(std::chrono::milliseconds(50)); 
 		data1[2 * n] = float((2 * n) * (2 * n)); 
 		data1[2 * n + 1] = float((2 * n + 1) * (2 * n + 1)); 
@@ -213,4 +306,89 @@ BOOST_AUTO_TEST_CASE(PassiveStack)
 	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], float(i * i));
 }
 
+BOOST_AUTO_TEST_CASE(PassiveStackReducedPrecision)
+{
+	const int dataLength = 16;
+	float data1[dataLength];
+	float data2[dataLength];
+	int data3[dataLength];
+
+	for (int i = 0; i < dataLength; ++i)
+	{
+		data1[i] = 0.0f;
+		data2[i] = 0.0f;
+	}
+
+	HMP::StackIdentifier stack1 = m->addPassiveStack(&data1[0], dataLength, FloatFormat::Float16);
+	HMP::StackIdentifier stack2 = m->addPassiveStack(&data2[0], dataLength, FloatFormat::BFloat16);
+	BOOST_CHECK_THROW(m->addPassiveStack(&data3[0], dataLength, FloatFormat::Float16), Exception);
+
+	if (MPIFixture::rank == 0)
+	{
+		for (int i = 0; i < dataLength; ++i)
+		{
+			data1[i] = 0.1f * float(i);
+			data2[i] = -0.1f * float(i);
+		}
+	}
+	m->broadcast({ stack1, stack2 });
+
+	//values are rounded on all ranks, including the server rank
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], FloatCodec::round(0.1f * float(i), FloatFormat::Float16));
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data2[i], FloatCodec::round(-0.1f * float(i), FloatFormat::BFloat16));
+}
+
+BOOST_AUTO_TEST_CASE(PassiveStackNodeShared)
+{
+	const int dataLength = 16;
+	NodeSharedArray data1(dataLength);
+	HMP::StackIdentifier stack1 = m->addPassiveStack(data1.data(), dataLength, FloatFormat::Float32, true);
+
+	//only the node leaders receive the broadcast, all other ranks read the shared memory in place
+	data1.synchronize();
+	if (MPIFixture::rank == 0)
+	{
+		for (int i = 0; i < dataLength; ++i) data1.data()[i] = float(i * i);
+	}
+	m->broadcast(stack1);
+	data1.synchronize();
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1.data()[i], float(i * i));
+}
+
+BOOST_AUTO_TEST_CASE(ReleaseStack)
+{
+	const int dataLength = 8;
+	float data1[dataLength];
+	float data2[dataLength];
+	float data3[dataLength];
+
+	std::function<void(HMP::StackIndex)> calculator1 = [&data1, &data2](int n)->void {
+		data1[n] = float(n * n);
+		data2[n] = float(n * n * n);
+	};
+	std::function<void(HMP::StackIndex)> calculator3 = [&data3](int n)->void { data3[n] = float(-n); };
+
+	HMP::StackIdentifier stack1 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, 1, 1, 4, true);
+	m->addSlaveStack(&data2[0], dataLength, stack1);
+	HMP::StackIdentifier stack3 = m->addMasterStackImplicit(&data3[0], dataLength, calculator3, 1, 1, 4, true);
+
+	//releasing a master stack releases its slave stacks as well, while the identifiers of the remaining stacks stay valid
+	m->releaseStack(stack1);
+	m->releaseStack(stack1);
+	BOOST_CHECK_THROW(m->releaseStack(stack3 + 1), Exception);
+
+	for (int i = 0; i < dataLength; ++i) data1[i] = data2[i] = data3[i] = 0.0f;
+	m->calculateAll();
+	m->broadcastAll();
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], 0.0f);
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data2[i], 0.0f);
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data3[i], float(-i));
+
+	//new stacks are registered with fresh identifiers
+	HMP::StackIdentifier stack4 = m->addMasterStackImplicit(&data1[0], dataLength, calculator1, 1, 1, 4, true);
+	BOOST_CHECK_GT(stack4, stack3);
+	m->calculate(stack4);
+	for (int i = 0; i < dataLength; ++i) BOOST_CHECK_EQUAL(data1[i], float(i * i));
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
@@ -0,0 +1,92 @@
+#define BOOST_TEST_MODULE "PropagatorCacheTest"
+#include <boost/test/included/unit_test.hpp>
+#include "SU2/SU2VertexSingleParticle.hpp"
+#include "PropagatorCache.hpp"
+
+class SpinParser
+{
+public:
+	SpinParser(FrequencyDiscretization *f)
+	{
+		FrgCommon::_frequency = f;
+	}
+
+	~SpinParser()
+	{
+		delete FrgCommon::_frequency;
+	}
+};
+
+struct PropagatorCacheFixture
+{
+	PropagatorCacheFixture()
+	{
+		//construct frequency discretization
+		Log::log << Log::setDisplayLogLevel(Log::LogLevel::None);
+		std::vector<float> values({ 0.1f, 0.3f, 1.0f, 2.0f, 5.0f });
+		spinParser = new SpinParser(new FrequencyDiscretization(values));
+
+		//construct self-energy and its flow
+		selfEnergy = new SU2VertexSingleParticle;
+		selfEnergyFlow = new SU2VertexSingleParticle;
+		for (int i = 0; i < selfEnergy->size; ++i)
+		{
+			selfEnergy->_data[i] = 0.3f / float(i + 1);
+			selfEnergyFlow->_data[i] = -0.7f * float(i + 1);
+		}
+
+		cutoff = 0.45f;
+		cache.update(cutoff, selfEnergy->_data, selfEnergyFlow->_data);
+	}
+
+	~PropagatorCacheFixture()
+	{
+		delete selfEnergy;
+		delete selfEnergyFlow;
+		delete spinParser;
+	}
+
+	float denominator(const float w) const
+	{
+		return w + selfEnergy->getValue(w);
+	}
+
+	SU2VertexSingleParticle *selfEnergy;
+	SU2VertexSingleParticle *selfEnergyFlow;
+	SpinParser *spinParser;
+	PropagatorCache cache;
+	float cutoff;
+};
+
+BOOST_FIXTURE_TEST_SUITE(PropagatorCacheTest, PropagatorCacheFixture);
+
+BOOST_AUTO_TEST_CASE(propagator)
+{
+	std::vector<float> w({ 0.0f, 0.05f, 0.1f, 0.2f, 0.3f, 0.45f, 1.0f, 1.5f, 5.0f, 7.0f });
+	for (float w1 : w)
+	{
+		for (float w2 : w)
+		{
+			for (float sign : { 1.0f, -1.0f })
+			{
+				BOOST_CHECK_EQUAL(cache.denominator(sign * w1), denominator(sign * w1));
+				BOOST_CHECK_EQUAL(cache.propagator(w1, sign * w2), 1.0f / (denominator(w1) * denominator(sign * w2)));
+
+				float denominatorW1 = denominator(sign * w1);
+				BOOST_CHECK_EQUAL(cache.kataninPropagator(sign * w1, w2), selfEnergyFlow->getValue(sign * w1) / (denominatorW1 * denominatorW1 * denominator(w2)));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(propagatorCutoff)
+{
+	for (auto w = FrgCommon::frequency().begin(); w != FrgCommon::frequency().end(); ++w)
+	{
+		BOOST_CHECK_EQUAL(cache.propagatorCutoff(*w), 1.0f / (denominator(cutoff) * denominator(cutoff + *w)));
+		BOOST_CHECK_EQUAL(cache.propagatorCutoff(-*w), 1.0f / (denominator(cutoff) * denominator(cutoff - *w)));
+	}
+	BOOST_CHECK_EQUAL(cache.propagatorCutoff(0.7f), 1.0f / (denominator(cutoff) * denominator(cutoff + 0.7f)));
+}
+
+BOOST_AUTO_TEST_SUITE_END();
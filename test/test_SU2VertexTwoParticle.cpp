@@ -117,6 +117,27 @@ BOOST_AUTO_TEST_CASE(ExpandIteratorFrequency)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(ExpandIteratorBatch)
+{
+	for (int64_t begin = 0; begin < v->sizeFrequency; begin += 7)
+	{
+		std::vector<float> s(v->sizeFrequency - begin), t(v->sizeFrequency - begin), u(v->sizeFrequency - begin);
+		v->expandIterators(begin, v->sizeFrequency, s.data(), t.data(), u.data());
+
+		for (int64_t i = begin; i < v->sizeFrequency; ++i)
+		{
+			float sRef = 0.0;
+			float tRef = 0.0;
+			float uRef = 0.0;
+			v->expandIterator(i, sRef, tRef, uRef);
+
+			BOOST_CHECK_EQUAL(s[i - begin], sRef);
+			BOOST_CHECK_EQUAL(t[i - begin], tRef);
+			BOOST_CHECK_EQUAL(u[i - begin], uRef);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(getValueSymmetry)
 {
 	for (int i = 0; i < v->size; ++i)
@@ -280,4 +301,59 @@ BOOST_AUTO_TEST_CASE(getValueSuperbundle)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(getValueSuperbundleExchangedCopy)
+{
+	for (int i = 0; i < v->size; ++i)
+	{
+		v->getValueRef(i, SU2VertexTwoParticle::Symmetry::Spin) = float(i);
+		v->getValueRef(i, SU2VertexTwoParticle::Symmetry::Density) = float(i) + 1.0f;
+	}
+	v->enableExchangedCopy();
+	v->updateExchangedCopy();
+
+	auto ab = v->generateAccessBuffer(-1.1f, 2.2f, 3.3f);
+	BOOST_TEST(ab.siteExchange);
+	ValueSuperbundle<float, 2> b(FrgCommon::lattice().size);
+	v->getValueSuperbundle(ab, b);
+
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid)
+	{
+		BOOST_CHECK_CLOSE(b.bundle(0)[rid], v->getValue(FrgCommon::lattice().zero(), FrgCommon::lattice().fromParametrization(rid), -1.1f, 2.2f, 3.3f, SU2VertexTwoParticle::Symmetry::Spin, SU2VertexTwoParticle::FrequencyChannel::None), 0.0001);
+		BOOST_CHECK_CLOSE(b.bundle(1)[rid], v->getValue(FrgCommon::lattice().zero(), FrgCommon::lattice().fromParametrization(rid), -1.1f, 2.2f, 3.3f, SU2VertexTwoParticle::Symmetry::Density, SU2VertexTwoParticle::FrequencyChannel::None), 0.0001);
+	}
+
+	//modified vertex values are read via the inverted site table once the copy is invalidated
+	for (int i = 0; i < v->size; ++i) v->getValueRef(i, SU2VertexTwoParticle::Symmetry::Spin) = float(2 * i);
+	v->invalidateExchangedCopy();
+	v->getValueSuperbundle(ab, b);
+
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid) BOOST_CHECK_CLOSE(b.bundle(0)[rid], v->getValue(FrgCommon::lattice().zero(), FrgCommon::lattice().fromParametrization(rid), -1.1f, 2.2f, 3.3f, SU2VertexTwoParticle::Symmetry::Spin, SU2VertexTwoParticle::FrequencyChannel::None), 0.0001);
+}
+
+BOOST_AUTO_TEST_CASE(getValueSuperbundleCompact)
+{
+	SU2VertexTwoParticle compact(SU2VertexTwoParticle::Distribution::Replicated, 0, FloatFormat::BFloat16);
+	for (int i = 0; i < v->size; ++i)
+	{
+		compact.getValueRef(i, SU2VertexTwoParticle::Symmetry::Spin) = 0.1f * float(i);
+		compact.getValueRef(i, SU2VertexTwoParticle::Symmetry::Density) = 0.1f * float(i) + 1.0f;
+		v->getValueRef(i, SU2VertexTwoParticle::Symmetry::Spin) = FloatCodec::round(0.1f * float(i), FloatFormat::BFloat16);
+		v->getValueRef(i, SU2VertexTwoParticle::Symmetry::Density) = FloatCodec::round(0.1f * float(i) + 1.0f, FloatFormat::BFloat16);
+	}
+
+	//compactly stored vertex reads like a single precision vertex holding rounded values
+	auto ab = v->generateAccessBuffer(1.1f, 2.2f, 3.3f);
+	ValueSuperbundle<float, 2> b(FrgCommon::lattice().size);
+	ValueSuperbundle<float, 2> bCompact(FrgCommon::lattice().size);
+	v->getValueSuperbundle(ab, b);
+	compact.getValueSuperbundle(ab, bCompact);
+
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid)
+	{
+		BOOST_CHECK_CLOSE(bCompact.bundle(0)[rid], b.bundle(0)[rid], 0.0001);
+		BOOST_CHECK_CLOSE(bCompact.bundle(1)[rid], b.bundle(1)[rid], 0.0001);
+		BOOST_CHECK_CLOSE(compact.getValue(FrgCommon::lattice().zero(), FrgCommon::lattice().fromParametrization(rid), 1.1f, 2.2f, 3.3f, SU2VertexTwoParticle::Symmetry::Spin, SU2VertexTwoParticle::FrequencyChannel::None), b.bundle(0)[rid], 0.0001);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
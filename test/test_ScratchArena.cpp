@@ -0,0 +1,99 @@
+#define BOOST_TEST_MODULE "ScratchArenaTest"
+#include <boost/test/included/unit_test.hpp>
+#include <cstdint>
+#include "lib/ScratchArena.hpp"
+#include "lib/ValueBundle.hpp"
+
+BOOST_AUTO_TEST_SUITE(ScratchArenaTest)
+
+BOOST_AUTO_TEST_CASE(alignment)
+{
+	ScratchArena arena;
+	ScratchArena::Scope scope(arena);
+	for (size_t size : { size_t(1), size_t(3), size_t(64), size_t(100), size_t(4096) })
+	{
+		void *memory = arena.allocate(size);
+		BOOST_TEST(reinterpret_cast<uintptr_t>(memory) % SimdKernels::alignment == 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(scopeReuse)
+{
+	ScratchArena arena;
+	void *first;
+	{
+		ScratchArena::Scope scope(arena);
+		first = arena.allocate(1000);
+		BOOST_TEST(arena.allocate(1000) != first);
+	}
+	{
+		ScratchArena::Scope scope(arena);
+		BOOST_TEST(arena.allocate(1000) == first);
+	}
+	BOOST_TEST(arena.capacity() == ScratchArena::minimalBlockSize);
+}
+
+BOOST_AUTO_TEST_CASE(nestedScopes)
+{
+	ScratchArena arena;
+	ScratchArena::Scope outerScope(arena);
+	float *outer = static_cast<float *>(arena.allocate(16 * sizeof(float)));
+	for (int i = 0; i < 16; ++i) outer[i] = float(i);
+
+	void *inner;
+	{
+		ScratchArena::Scope innerScope(arena);
+		inner = arena.allocate(16 * sizeof(float));
+		BOOST_TEST(inner != static_cast<void *>(outer));
+	}
+	BOOST_TEST(arena.allocate(16 * sizeof(float)) == inner);
+	for (int i = 0; i < 16; ++i) BOOST_TEST(outer[i] == float(i));
+}
+
+BOOST_AUTO_TEST_CASE(growth)
+{
+	ScratchArena arena;
+	{
+		ScratchArena::Scope scope(arena);
+		float *small = static_cast<float *>(arena.allocate(sizeof(float)));
+		*small = 1.0f;
+		float *large = static_cast<float *>(arena.allocate(2 * ScratchArena::minimalBlockSize));
+		large[0] = 2.0f;
+		BOOST_TEST(*small == 1.0f);
+		BOOST_TEST(arena.capacity() == 3 * ScratchArena::minimalBlockSize);
+	}
+
+	//blocks are merged once the arena is empty, such that the same allocations fit into a single block
+	BOOST_TEST(arena.capacity() == 3 * ScratchArena::minimalBlockSize);
+	ScratchArena::Scope scope(arena);
+	char *small = static_cast<char *>(arena.allocate(sizeof(float)));
+	char *large = static_cast<char *>(arena.allocate(2 * ScratchArena::minimalBlockSize));
+	BOOST_TEST(large - small == std::ptrdiff_t(SimdKernels::alignment));
+	BOOST_TEST(arena.capacity() == 3 * ScratchArena::minimalBlockSize);
+}
+
+BOOST_AUTO_TEST_CASE(valueSuperbundle)
+{
+	ScratchArena &arena = ScratchArena::local();
+	ScratchArena::Scope scope(arena);
+
+	ValueSuperbundle<float, 3> a(37, arena);
+	ValueSuperbundle<float, 3> b(37, arena);
+	for (int n = 0; n < 3; ++n)
+	{
+		BOOST_TEST(reinterpret_cast<uintptr_t>(a.bundle(n).data()) % SimdKernels::alignment == 0);
+		for (int i = 0; i < 37; ++i)
+		{
+			BOOST_TEST(a.bundle(n)[i] == 0.0f);
+			b.bundle(n)[i] = float(i);
+		}
+	}
+	a += b;
+	a *= 2.0f;
+	for (int n = 0; n < 3; ++n)
+	{
+		for (int i = 0; i < 37; ++i) BOOST_TEST(a.bundle(n)[i] == 2.0f * float(i));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END();
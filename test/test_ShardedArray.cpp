@@ -0,0 +1,144 @@
+#define BOOST_TEST_MODULE "ShardedArrayTest"
+#include <thread>
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include "lib/ShardedArray.hpp"
+
+#ifndef DISABLE_MPI
+#include "mpi.h"
+#endif
+
+struct MPIFixture
+{
+	MPIFixture()
+	{
+		#ifndef DISABLE_MPI
+		int argc = boost::unit_test::framework::master_test_suite().argc;
+		char **argv = boost::unit_test::framework::master_test_suite().argv;
+		int threadSupport;
+		MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &threadSupport);
+		MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+		#endif
+	}
+
+	~MPIFixture()
+	{
+		#ifndef DISABLE_MPI
+		MPI_Finalize();
+		#endif
+	}
+
+	static int rank;
+};
+int MPIFixture::rank = 0;
+
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+//fill all local lines with their global value index
+void fillArray(ShardedArray &array)
+{
+	array.synchronize();
+	for (int64_t i = 0; i < array.localSize(); ++i) array.data()[i] = float(array.begin() * array.lineSize() + i);
+	array.synchronize();
+}
+
+BOOST_AUTO_TEST_SUITE(ShardedArrayTest);
+
+BOOST_AUTO_TEST_CASE(Partition)
+{
+	ShardedArray array(37, 5, 4);
+	BOOST_CHECK_EQUAL(array.lineCount(), 37);
+	BOOST_CHECK_EQUAL(array.lineSize(), 5);
+	BOOST_CHECK_EQUAL(array.localSize(), (array.end() - array.begin()) * 5);
+
+	//ranges of all ranks are contiguous and cover all lines
+	int commSize = 1;
+	#ifndef DISABLE_MPI
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	#endif
+	BOOST_CHECK_EQUAL(array.lineBegin(0), 0);
+	BOOST_CHECK_EQUAL(array.lineBegin(commSize), 37);
+	BOOST_CHECK_EQUAL(array.begin(), array.lineBegin(MPIFixture::rank));
+	BOOST_CHECK_EQUAL(array.end(), array.lineBegin(MPIFixture::rank + 1));
+	for (int64_t line = 0; line < array.lineCount(); ++line)
+	{
+		int owner = array.owner(line);
+		BOOST_CHECK(line >= array.lineBegin(owner) && line < array.lineBegin(owner + 1));
+	}
+
+	//values are initialized to zero
+	for (int64_t i = 0; i < array.localSize(); ++i) BOOST_CHECK_EQUAL(array.data()[i], 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(LineAccess)
+{
+	//direct access and cached access with frequent evictions
+	for (int cacheSize : { 0, 3 })
+	{
+		ShardedArray array(23, 7, cacheSize);
+		fillArray(array);
+
+		std::vector<float> buffer(array.lineSize());
+		for (int repetition = 0; repetition < 2; ++repetition)
+		{
+			for (int64_t line = 0; line < array.lineCount(); ++line)
+			{
+				const float *values = array.line(line, buffer.data());
+				for (int j = 0; j < array.lineSize(); ++j) BOOST_CHECK_EQUAL(values[j], float(line * array.lineSize() + j));
+			}
+			for (int64_t i = array.lineCount() * array.lineSize() - 1; i >= 0; i -= 3) BOOST_CHECK_EQUAL(array.value(i), float(i));
+		}
+
+		//modifications are visible after synchronization
+		array.synchronize();
+		for (int64_t i = 0; i < array.localSize(); ++i) array.data()[i] = -array.data()[i];
+		array.synchronize();
+		for (int64_t i = 0; i < array.lineCount() * array.lineSize(); ++i) BOOST_CHECK_EQUAL(array.value(i), -float(i));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BulkRead)
+{
+	ShardedArray array(19, 4, 2);
+	fillArray(array);
+
+	//blocks which span the ranges of multiple ranks
+	int64_t size = array.lineCount() * array.lineSize();
+	std::vector<float> buffer(size);
+	array.read(0, size, buffer.data());
+	for (int64_t i = 0; i < size; ++i) BOOST_CHECK_EQUAL(buffer[i], float(i));
+
+	array.read(3, size - 5, buffer.data());
+	for (int64_t i = 0; i < size - 5; ++i) BOOST_CHECK_EQUAL(buffer[i], float(i + 3));
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentAccess)
+{
+	ShardedArray array(64, 9, 5);
+	fillArray(array);
+
+	//read all lines and scattered values from multiple threads concurrently, such that threads contend for the same cache slots
+	const int threadCount = 4;
+	std::vector<int> errors(threadCount, 0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; ++t)
+	{
+		threads.push_back(std::thread([&, t]()
+		{
+			std::vector<float> buffer(array.lineSize());
+			for (int64_t line = t; line < t + 3 * array.lineCount(); ++line)
+			{
+				int64_t l = line % array.lineCount();
+				const float *values = array.line(l, buffer.data());
+				for (int j = 0; j < array.lineSize(); ++j) if (values[j] != float(l * array.lineSize() + j)) ++errors[t];
+				int64_t i = (l * array.lineSize() + 5 * line) % (array.lineCount() * array.lineSize());
+				if (array.value(i) != float(i)) ++errors[t];
+			}
+		}));
+	}
+	for (auto &t : threads) t.join();
+	for (int t = 0; t < threadCount; ++t) BOOST_CHECK_EQUAL(errors[t], 0);
+	array.synchronize();
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -121,6 +121,27 @@ BOOST_AUTO_TEST_CASE(ExpandIteratorFrequency)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(ExpandIteratorBatch)
+{
+	for (int64_t begin = 0; begin < v->sizeFrequency; begin += 7)
+	{
+		std::vector<float> s(v->sizeFrequency - begin), t(v->sizeFrequency - begin), u(v->sizeFrequency - begin);
+		v->expandIterators(begin, v->sizeFrequency, s.data(), t.data(), u.data());
+
+		for (int64_t i = begin; i < v->sizeFrequency; ++i)
+		{
+			float sRef = 0.0;
+			float tRef = 0.0;
+			float uRef = 0.0;
+			v->expandIterator(i, sRef, tRef, uRef);
+
+			BOOST_CHECK_EQUAL(s[i - begin], sRef);
+			BOOST_CHECK_EQUAL(t[i - begin], tRef);
+			BOOST_CHECK_EQUAL(u[i - begin], uRef);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(getValueSymmetry)
 {
 	for (int i = 0; i < v->size; ++i) v->getValueRef(i) = float(i);
@@ -251,4 +272,27 @@ BOOST_AUTO_TEST_CASE(getValueSuperbundle)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(getValueSuperbundleExchangedCopy)
+{
+	for (int i = 0; i < v->size; ++i) v->getValueRef(i) = float(i);
+	v->enableExchangedCopy();
+	v->updateExchangedCopy();
+
+	auto ab = v->generateAccessBuffer(-1.1f, 2.2f, 3.3f);
+	BOOST_TEST(ab.pairExchange);
+	ValueSuperbundle<float, 16> b(FrgCommon::lattice().size);
+	v->getValueSuperbundle(ab, b);
+
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid)
+	{
+		for (int s1 = 0; s1 < 4; ++s1)
+		{
+			for (int s2 = 0; s2 < 4; ++s2)
+			{
+				BOOST_CHECK_CLOSE(b.bundle(4 * s1 + s2)[rid], v->getValue(FrgCommon::lattice().zero(), FrgCommon::lattice().fromParametrization(rid), -1.1f, 2.2f, 3.3f, static_cast<SpinComponent>(s1), static_cast<SpinComponent>(s2), TRIVertexTwoParticle::FrequencyChannel::None), 0.0001);
+			}
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
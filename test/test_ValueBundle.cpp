@@ -1,5 +1,8 @@
 #define BOOST_TEST_MODULE "ValueBundleTest"
 #include <boost/test/included/unit_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 #include "lib/ValueBundle.hpp"
 
 
@@ -135,4 +138,81 @@ BOOST_AUTO_TEST_CASE(ValueSuperbundleArithmetic)
 	for (int i = 0; i < dataSize; ++i) BOOST_CHECK_EQUAL(s1.bundle(0)[i], float(2.0f * i));
 	for (int i = 0; i < dataSize; ++i) BOOST_CHECK_EQUAL(s1.bundle(1)[i], float(2.0f * i));
 }
+BOOST_AUTO_TEST_CASE(ValueSuperbundleAlignment)
+{
+	ValueSuperbundle<float, 3> s(37);
+	for (int i = 0; i < 3; ++i) BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(s.bundle(i).data()) % SimdKernels::alignment, 0);
+}
+
+BOOST_AUTO_TEST_CASE(SimdKernelsInstructionSets)
+{
+	BOOST_CHECK(SimdKernels::isSupported(SimdKernels::InstructionSet::Scalar));
+	BOOST_CHECK(SimdKernels::isSupported(SimdKernels::instructionSet()));
+
+	//compare all supported instruction sets bitwise against the scalar implementation, including unaligned operands and remainders
+	const int64_t sizes[] = { 0, 1, 7, 16, 33, 257 };
+	for (int64_t size : sizes)
+	{
+		std::vector<float> x1(size + 1), x2(size + 1), y0(size + 1);
+		for (int64_t i = 0; i <= size; ++i)
+		{
+			x1[i] = 0.1f * float(i) - 1.3f;
+			x2[i] = 1.7f / float(i + 3);
+			y0[i] = 0.3f * float(i % 11) + 0.01f;
+		}
+
+		for (int o = 0; o < SimdKernels::numberOfOperations; ++o)
+		{
+			std::vector<float> reference(y0.begin() + 1, y0.end());
+			SimdKernels::kernel(static_cast<SimdKernels::Operation>(o), SimdKernels::InstructionSet::Scalar)(reference.data(), x1.data() + 1, x2.data() + 1, 0.7f, size);
+
+			for (int s = 1; s < SimdKernels::numberOfInstructionSets; ++s)
+			{
+				SimdKernels::InstructionSet instructionSet = static_cast<SimdKernels::InstructionSet>(s);
+				if (!SimdKernels::isSupported(instructionSet)) continue;
+
+				std::vector<float> y(y0.begin() + 1, y0.end());
+				SimdKernels::kernel(static_cast<SimdKernels::Operation>(o), instructionSet)(y.data(), x1.data() + 1, x2.data() + 1, 0.7f, size);
+				BOOST_CHECK(memcmp(y.data(), reference.data(), size * sizeof(float)) == 0);
+			}
+		}
+	}
+}
+BOOST_AUTO_TEST_CASE(ValueBundleExpressions)
+{
+	const int dataSize = 37;
+	ValueSuperbundle<float, 4> operands(dataSize);
+	for (int b = 0; b < 4; ++b)
+	{
+		for (int i = 0; i < dataSize; ++i) operands.bundle(b)[i] = 0.1f * float(i) + 0.37f * float(b) - 1.0f;
+	}
+	ValueBundle<float> &a = operands.bundle(0);
+	ValueBundle<float> &b = operands.bundle(1);
+	ValueBundle<float> &c = operands.bundle(2);
+	ValueBundle<float> &d = operands.bundle(3);
+	const float s = 0.3f;
+
+	//fused expressions must be bitwise identical to the equivalent sequence of individual operations
+	ValueSuperbundle<float, 2> result(dataSize);
+	for (int i = 0; i < dataSize; ++i) result.bundle(0)[i] = result.bundle(1)[i] = 0.5f * float(i);
+
+	result.bundle(0).multSub(0.5f, a, b);
+	result.bundle(0).multAdd(c, d);
+	result.bundle(0).multAdd(c, 0.25f * s);
+	result.bundle(0).multSub(s, b);
+	result.bundle(0) += d;
+	result.bundle(1) -= 0.5f * a * b - c * d - c * (0.25f * s) + s * b - d;
+	BOOST_CHECK(memcmp(result.bundle(0).data(), result.bundle(1).data(), dataSize * sizeof(float)) == 0);
+
+	result.bundle(0).multAdd(a, b);
+	result.bundle(0).multSub(c, d);
+	result.bundle(0).multSub(2.0f, a, d);
+	result.bundle(1) += a * b - c * d - 2.0f * a * d;
+	BOOST_CHECK(memcmp(result.bundle(0).data(), result.bundle(1).data(), dataSize * sizeof(float)) == 0);
+
+	//explicit parentheses and negation are evaluated as written
+	result.reset();
+	result.bundle(0) += -(a * (b + c)) + d * 2.0f;
+	for (int i = 0; i < dataSize; ++i) BOOST_CHECK_EQUAL(result.bundle(0)[i], -(a[i] * (b[i] + c[i])) + d[i] * 2.0f);
+}
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file
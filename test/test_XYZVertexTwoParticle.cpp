@@ -125,6 +125,27 @@ BOOST_AUTO_TEST_CASE(ExpandIteratorFrequency)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(ExpandIteratorBatch)
+{
+	for (int64_t begin = 0; begin < v->sizeFrequency; begin += 7)
+	{
+		std::vector<float> s(v->sizeFrequency - begin), t(v->sizeFrequency - begin), u(v->sizeFrequency - begin);
+		v->expandIterators(begin, v->sizeFrequency, s.data(), t.data(), u.data());
+
+		for (int64_t i = begin; i < v->sizeFrequency; ++i)
+		{
+			float sRef = 0.0;
+			float tRef = 0.0;
+			float uRef = 0.0;
+			v->expandIterator(i, sRef, tRef, uRef);
+
+			BOOST_CHECK_EQUAL(s[i - begin], sRef);
+			BOOST_CHECK_EQUAL(t[i - begin], tRef);
+			BOOST_CHECK_EQUAL(u[i - begin], uRef);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(getValueSymmetry)
 {
 	for (int i = 0; i < v->size; ++i)
@@ -269,4 +290,30 @@ BOOST_AUTO_TEST_CASE(getValueSuperbundle)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(getValueSuperbundleExchangedCopy)
+{
+	for (int i = 0; i < v->size; ++i)
+	{
+		v->getValueRef(i, SpinComponent::X) = float(i);
+		v->getValueRef(i, SpinComponent::Y) = float(i + 1);
+		v->getValueRef(i, SpinComponent::Z) = float(i + 2);
+		v->getValueRef(i, SpinComponent::None) = float(i + 3);
+	}
+	v->enableExchangedCopy();
+	v->updateExchangedCopy();
+
+	auto ab = v->generateAccessBuffer(-1.1f, 2.2f, 3.3f);
+	BOOST_TEST(ab.siteExchange);
+	ValueSuperbundle<float, 4> b(FrgCommon::lattice().size);
+	v->getValueSuperbundle(ab, b);
+
+	for (int rid = 0; rid < FrgCommon::lattice().size; ++rid)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			BOOST_CHECK_CLOSE(b.bundle(i)[rid], v->getValue(FrgCommon::lattice().zero(), FrgCommon::lattice().fromParametrization(rid), -1.1f, 2.2f, 3.3f, static_cast<SpinComponent>(i), XYZVertexTwoParticle::FrequencyChannel::None), 0.0001);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END();
\ No newline at end of file